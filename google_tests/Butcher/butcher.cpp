@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <iostream>
+#include <limits>
 #include <random>
 
 #include <network_butcher/Butcher/butcher.h>
@@ -16,6 +17,7 @@ namespace
 
   using type_weight             = double;
   using type_collection_weights = std::map<std::pair<Node_Id_Type, Node_Id_Type>, type_weight>;
+  using type_transmission       = std::function<Time_Type(Edge_Type const &, std::size_t, std::size_t)>;
 
   using basic_type   = int;
   using Input        = Test_Class<int>;
@@ -40,6 +42,12 @@ namespace
   auto basic_transmission(std::size_t, std::size_t)
     -> std::function<type_weight(Edge_Type const &, std::size_t, std::size_t)>;
 
+  auto
+  compare_with_single_search(Butcher<GraphType> const              &butcher,
+                             type_transmission const               &transmission,
+                             parameters::Parameters const          &params,
+                             std::vector<Weighted_Real_Path> const &expected) -> std::vector<Weighted_Real_Path>;
+
   struct path_comparison
   {
     bool
@@ -116,6 +124,182 @@ namespace
     ASSERT_EQ(eppstein, lazy_eppstein);
   }
 
+  /// Apply Butcher to the Eppstein graph with several starting and ending devices. The single search must find the same
+  /// partitionings of the separate searches for every (starting, ending) pair
+  TEST(ButcherTest, compute_k_shortest_paths_multi_terminal)
+  {
+    std::size_t num_devices = 3;
+    std::size_t k           = 50;
+
+    auto        butcher          = basic_butcher();
+    auto const &graph            = butcher.get_graph();
+    auto const  transmission_fun = basic_transmission(num_devices, graph.get_nodes().size());
+
+    auto params                                             = eppstein_parameters(k, num_devices);
+    params.block_graph_generation_params.starting_device_ids = {2, 0, 1};
+    params.block_graph_generation_params.ending_device_ids   = {0, 2};
+
+    auto const res = butcher.compute_k_shortest_path_multi_terminal(transmission_fun, params);
+
+    std::vector<Seconds_Type> lengths;
+    for (std::size_t starting_device = 0; starting_device < num_devices; ++starting_device)
+      {
+        for (std::size_t ending_device : {0, 2})
+          {
+            auto single_params                                             = eppstein_parameters(1000, num_devices);
+            single_params.block_graph_generation_params.starting_device_id = starting_device;
+            single_params.block_graph_generation_params.ending_device_id   = ending_device;
+
+            auto const it = res.best_per_pair.find(std::make_pair(starting_device, ending_device));
+            ASSERT_NE(it, res.best_per_pair.cend());
+
+            auto const single_res = compare_with_single_search(butcher, transmission_fun, single_params, {it->second});
+            EXPECT_EQ(it->second.second.front().first, starting_device);
+            EXPECT_EQ(it->second.second.back().first, ending_device);
+
+            for (auto const &path : single_res)
+              lengths.push_back(path.first);
+          }
+      }
+
+    EXPECT_EQ(res.best_per_pair.size(), 6);
+
+    std::sort(lengths.begin(), lengths.end());
+    lengths.resize(k);
+
+    ASSERT_EQ(res.paths.size(), k);
+    for (std::size_t i = 0; i < k; ++i)
+      EXPECT_EQ(res.paths[i].first, lengths[i]);
+  }
+
+  /// Apply Butcher to the Eppstein graph with several starting and ending devices, looking for the best partitioning
+  /// only. The best partitioning of every (starting, ending) pair must be found anyway
+  TEST(ButcherTest, compute_k_shortest_paths_multi_terminal_single_path)
+  {
+    std::size_t num_devices = 3;
+
+    auto        butcher          = basic_butcher();
+    auto const &graph            = butcher.get_graph();
+    auto const  transmission_fun = basic_transmission(num_devices, graph.get_nodes().size());
+
+    auto params                                              = eppstein_parameters(1, num_devices);
+    params.block_graph_generation_params.starting_device_ids = {0, 1, 2};
+    params.block_graph_generation_params.ending_device_ids   = {0, 1, 2};
+
+    auto const res = butcher.compute_k_shortest_path_multi_terminal(transmission_fun, params);
+
+    ASSERT_EQ(res.paths.size(), 1);
+    ASSERT_EQ(res.best_per_pair.size(), num_devices * num_devices);
+
+    for (auto const &[pair, path] : res.best_per_pair)
+      {
+        auto single_params                                             = eppstein_parameters(1, num_devices);
+        single_params.block_graph_generation_params.starting_device_id = pair.first;
+        single_params.block_graph_generation_params.ending_device_id   = pair.second;
+
+        compare_with_single_search(butcher, transmission_fun, single_params, {path});
+        EXPECT_LE(res.paths.front().first, path.first);
+      }
+  }
+
+  /// Apply Butcher to a model with two nodes and several starting and ending devices. The block graph doesn't depend
+  /// on the devices, thus the result must be the one of a single search
+  TEST(ButcherTest, compute_k_shortest_paths_multi_terminal_two_nodes)
+  {
+    std::size_t num_devices = 3;
+
+    std::vector<Node_type> nodes;
+    nodes.emplace_back(std::move(Content_Builder<Input>().set_output({{"X0", 0}})).build());
+    nodes.emplace_back(std::move(Content_Builder<Input>().set_input({{"X0", 0}}).set_output({{"X1", 1}})).build());
+
+    GraphType graph(num_devices, std::move(nodes));
+    for (std::size_t k = 0; k < num_devices; ++k)
+      graph.set_weight(k, std::make_pair(0, 1), 1000. / std::pow(2, k));
+
+    Butcher    butcher(std::move(graph));
+    auto const transmission_fun = basic_transmission(num_devices, 2);
+
+    auto params                                              = eppstein_parameters(10, num_devices);
+    params.block_graph_generation_params.starting_device_ids = {2, 0, 1};
+    params.block_graph_generation_params.ending_device_ids   = {0, 2};
+
+    auto const res = butcher.compute_k_shortest_path_multi_terminal(transmission_fun, params);
+
+    auto const single_res = compare_with_single_search(butcher, transmission_fun, params, res.paths);
+    ASSERT_EQ(res.paths.size(), single_res.size());
+
+    ASSERT_EQ(res.best_per_pair.size(), 1);
+    EXPECT_EQ(res.best_per_pair.cbegin()->second, single_res.front());
+  }
+
+  /// Apply Butcher to the Eppstein graph with several transmission scenarios at once. Every scenario must find the same
+  /// partitionings of a separate search
+  TEST(ButcherTest, compute_k_shortest_paths_batch)
+  {
+    std::size_t num_devices = 3;
+    std::size_t k           = 1000;
+
+    auto        butcher          = basic_butcher();
+    auto const &graph            = butcher.get_graph();
+    auto const  transmission_fun = basic_transmission(num_devices, graph.get_nodes().size());
+
+    std::vector<type_transmission> scenarios{
+      transmission_fun,
+      [&transmission_fun](Edge_Type const &edge, std::size_t first, std::size_t second) {
+        return transmission_fun(edge, first, second) / 4.;
+      },
+      [](Edge_Type const &, std::size_t, std::size_t) { return 0.; }};
+
+    auto const params = eppstein_parameters(k, num_devices);
+    auto const res    = butcher.compute_k_shortest_paths_batch(scenarios, params);
+
+    ASSERT_EQ(res.size(), scenarios.size());
+    for (std::size_t i = 0; i < scenarios.size(); ++i)
+      {
+        auto const single_res = compare_with_single_search(butcher, scenarios[i], params, res[i]);
+        ASSERT_EQ(res[i].size(), single_res.size());
+
+        std::set<Weighted_Real_Path, path_comparison> batch, single;
+        batch.insert(res[i].begin(), res[i].end());
+        single.insert(single_res.begin(), single_res.end());
+
+        EXPECT_EQ(batch, single);
+      }
+
+    // Cheaper transmissions lead to shorter paths
+    EXPECT_LT(res[1].front().first, res[0].front().first);
+    EXPECT_LE(res[2].front().first, res[1].front().first);
+  }
+
+
+  /// Apply Butcher to the Eppstein graph with saturated transmission weights (e.g., the infinite times of a null
+  /// bandwidth). With fixed-point weights, the sums along the paths must not overflow: the partitionings that keep
+  /// every node on the starting device must still come first
+  TEST(ButcherTest, compute_k_shortest_paths_saturated_weights)
+  {
+    std::size_t num_devices = 3;
+
+    auto       butcher  = basic_butcher();
+    auto const infinite = to_time_type(std::numeric_limits<Seconds_Type>::infinity());
+
+    type_transmission const transmission_fun = [infinite](Edge_Type const &, std::size_t first, std::size_t second) {
+      return first == second ? Time_Type{0} : infinite;
+    };
+
+    auto const res = butcher.compute_k_shortest_path(transmission_fun, eppstein_parameters(1000, num_devices));
+
+    ASSERT_FALSE(res.empty());
+    EXPECT_LT(res.front().first, to_seconds(infinite));
+
+    for (std::size_t i = 0; i < res.size(); ++i)
+      {
+        EXPECT_GE(res[i].first, 0.);
+        if (i > 0)
+          {
+            EXPECT_LE(res[i - 1].first, res[i].first);
+          }
+      }
+  }
 
   auto
   basic_graph(std::size_t dev) -> GraphType
@@ -230,6 +414,24 @@ namespace
     return res;
   }
 
+  /// It performs a single search (through compute_k_shortest_path) and it checks that its first partitionings have the
+  /// same lengths of the expected ones, in the same order
+  /// \return The partitionings found by the single search
+  auto
+  compare_with_single_search(Butcher<GraphType> const              &butcher,
+                             type_transmission const               &transmission,
+                             parameters::Parameters const          &params,
+                             std::vector<Weighted_Real_Path> const &expected) -> std::vector<Weighted_Real_Path>
+  {
+    auto res = butcher.compute_k_shortest_path(transmission, params);
+    EXPECT_GE(res.size(), expected.size());
+
+    for (std::size_t i = 0; i < std::min(res.size(), expected.size()); ++i)
+      EXPECT_EQ(res[i].first, expected[i].first);
+
+    return res;
+  }
+
   auto
   path_comparison::operator()(const network_butcher::types::Weighted_Real_Path &rhs,
                               const network_butcher::types::Weighted_Real_Path &lhs) const -> bool
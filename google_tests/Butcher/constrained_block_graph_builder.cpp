@@ -312,47 +312,47 @@ namespace
     auto const block_graph = builder.construct_block_graph();
 
     // Node 0 should be fully connected with the next one
-    std::set<Node_Id_Type> tmp{1, 2};
+    Neighbour_Id_Collection_Type tmp{1, 2};
     ASSERT_EQ(block_graph.get_output_nodes(0), tmp);
 
     // Nodes 1 and 2 should be connected with Node 0 (in), 3,4 (out)
-    tmp = std::set<Node_Id_Type>{3, 4};
-    ASSERT_EQ(block_graph.get_input_nodes(1), std::set<Node_Id_Type>{0});
-    ASSERT_EQ(block_graph.get_input_nodes(2), std::set<Node_Id_Type>{0});
+    tmp = Neighbour_Id_Collection_Type{3, 4};
+    ASSERT_EQ(block_graph.get_input_nodes(1), Neighbour_Id_Collection_Type{0});
+    ASSERT_EQ(block_graph.get_input_nodes(2), Neighbour_Id_Collection_Type{0});
     ASSERT_EQ(block_graph.get_output_nodes(1), tmp);
     ASSERT_EQ(block_graph.get_output_nodes(2), tmp);
 
 
     // Nodes 3 and 4 should be connected with Nodes 1,2 (in), 5,6 (out)
-    tmp = std::set<Node_Id_Type>{1, 2};
+    tmp = Neighbour_Id_Collection_Type{1, 2};
     ASSERT_EQ(block_graph.get_input_nodes(3), tmp);
     ASSERT_EQ(block_graph.get_input_nodes(4), tmp);
 
-    tmp = std::set<Node_Id_Type>{5, 6};
+    tmp = Neighbour_Id_Collection_Type{5, 6};
     ASSERT_EQ(block_graph.get_output_nodes(3), tmp);
     ASSERT_EQ(block_graph.get_output_nodes(4), tmp);
 
 
     // Nodes 5 and 6 should be connected with Nodes 3,4 (in), 7,8 (out)
-    tmp = std::set<Node_Id_Type>{3, 4};
+    tmp = Neighbour_Id_Collection_Type{3, 4};
     ASSERT_EQ(block_graph.get_input_nodes(5), tmp);
     ASSERT_EQ(block_graph.get_input_nodes(6), tmp);
 
-    tmp = std::set<Node_Id_Type>{7, 8};
+    tmp = Neighbour_Id_Collection_Type{7, 8};
     ASSERT_EQ(block_graph.get_output_nodes(5), tmp);
     ASSERT_EQ(block_graph.get_output_nodes(6), tmp);
 
     // Nodes 7 and 8 should be connected with Nodes 5,6 (in), 9 (out)
-    tmp = std::set<Node_Id_Type>{5, 6};
+    tmp = Neighbour_Id_Collection_Type{5, 6};
     ASSERT_EQ(block_graph.get_input_nodes(7), tmp);
     ASSERT_EQ(block_graph.get_input_nodes(8), tmp);
 
-    tmp = std::set<Node_Id_Type>{9};
+    tmp = Neighbour_Id_Collection_Type{9};
     ASSERT_EQ(block_graph.get_output_nodes(7), tmp);
     ASSERT_EQ(block_graph.get_output_nodes(8), tmp);
 
     // Node 9 should be connected with Nodes 7,8 (in)
-    tmp = std::set<Node_Id_Type>{7, 8};
+    tmp = Neighbour_Id_Collection_Type{7, 8};
     ASSERT_EQ(block_graph.get_input_nodes(9), tmp);
   }
 
@@ -369,7 +369,7 @@ namespace
     auto const block_graph = builder.construct_block_graph();
 
     // Check output neighbours for node 0
-    std::set<Node_Id_Type> tmp{};
+    Neighbour_Id_Collection_Type tmp{};
     for (auto const &neighbour : bandwidth->get_output_nodes(params.block_graph_generation_params.starting_device_id))
       {
         tmp.insert(neighbour + 1);
@@ -382,11 +382,11 @@ namespace
       {
         if (tmp.contains(i))
           {
-            ASSERT_EQ(block_graph.get_input_nodes(i), std::set<Node_Id_Type>{0});
+            ASSERT_EQ(block_graph.get_input_nodes(i), Neighbour_Id_Collection_Type{0});
           }
         else
           {
-            ASSERT_EQ(block_graph.get_input_nodes(i), std::set<Node_Id_Type>{});
+            ASSERT_EQ(block_graph.get_input_nodes(i), Neighbour_Id_Collection_Type{});
           }
       }
 
@@ -426,11 +426,11 @@ namespace
       {
         if (tmp.contains(i))
           {
-            ASSERT_EQ(block_graph.get_output_nodes(i), std::set<Node_Id_Type>{17});
+            ASSERT_EQ(block_graph.get_output_nodes(i), Neighbour_Id_Collection_Type{17});
           }
         else
           {
-            ASSERT_EQ(block_graph.get_output_nodes(i), std::set<Node_Id_Type>{});
+            ASSERT_EQ(block_graph.get_output_nodes(i), Neighbour_Id_Collection_Type{});
           }
       }
   }
@@ -450,7 +450,7 @@ namespace
     auto const block_graph = builder.construct_block_graph();
 
     // Check output neighbours for node 0
-    std::set<Node_Id_Type> tmp{};
+    Neighbour_Id_Collection_Type tmp{};
     for (auto const &neighbour : bandwidth->get_output_nodes(params.block_graph_generation_params.starting_device_id))
       {
         tmp.insert(neighbour + 1);
@@ -464,11 +464,11 @@ namespace
       {
         if (tmp.contains(i))
           {
-            ASSERT_EQ(block_graph.get_input_nodes(i), std::set<Node_Id_Type>{0});
+            ASSERT_EQ(block_graph.get_input_nodes(i), Neighbour_Id_Collection_Type{0});
           }
         else
           {
-            ASSERT_EQ(block_graph.get_input_nodes(i), std::set<Node_Id_Type>{});
+            ASSERT_EQ(block_graph.get_input_nodes(i), Neighbour_Id_Collection_Type{});
           }
       }
 
@@ -509,11 +509,11 @@ namespace
       {
         if (tmp.contains(i))
           {
-            ASSERT_EQ(block_graph.get_output_nodes(i), std::set<Node_Id_Type>{17});
+            ASSERT_EQ(block_graph.get_output_nodes(i), Neighbour_Id_Collection_Type{17});
           }
         else
           {
-            ASSERT_EQ(block_graph.get_output_nodes(i), std::set<Node_Id_Type>{});
+            ASSERT_EQ(block_graph.get_output_nodes(i), Neighbour_Id_Collection_Type{});
           }
       }
   }
@@ -571,18 +571,18 @@ namespace
 
     auto const block_graph = builder.construct_block_graph();
 
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{0, 1}), 1234.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{0, 2}), 1234.2);
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{0, 1}), to_time_type(1234.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{0, 2}), to_time_type(1234.2));
 
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{1, 3}), 5.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{1, 4}), 5.2);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{2, 3}), 5.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{2, 4}), 5.2);
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{1, 3}), to_time_type(5.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{1, 4}), to_time_type(5.2));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{2, 3}), to_time_type(5.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{2, 4}), to_time_type(5.2));
 
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{3, 5}), 6.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{3, 6}), 6.2);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{4, 5}), 6.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{4, 6}), 6.2);
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{3, 5}), to_time_type(6.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{3, 6}), to_time_type(6.2));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{4, 5}), to_time_type(6.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{4, 6}), to_time_type(6.2));
   }
 
   /// Check if the operation weights are correctly set (block multiple)
@@ -607,18 +607,18 @@ namespace
 
     auto const block_graph = builder.construct_block_graph();
 
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{0, 1}), 1234.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{0, 2}), 1234.3);
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{0, 1}), to_time_type(1234.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{0, 2}), to_time_type(1234.3));
 
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{1, 3}), 5.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{1, 4}), 5.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{2, 3}), 5.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{2, 4}), 5.1);
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{1, 3}), to_time_type(5.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{1, 4}), to_time_type(5.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{2, 3}), to_time_type(5.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{2, 4}), to_time_type(5.1));
 
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{3, 5}), 6.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{3, 6}), 6.6);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{4, 5}), 6.1);
-    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{4, 6}), 6.6);
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{3, 5}), to_time_type(6.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{3, 6}), to_time_type(6.6));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{4, 5}), to_time_type(6.1));
+    ASSERT_FLOAT_EQ(block_graph.get_weight(std::pair{4, 6}), to_time_type(6.6));
   }
 
 
@@ -745,10 +745,10 @@ namespace
     res.block_graph_generation_params.use_bandwidth_to_manage_connections = true;
 
     g_type::Neighbours_Type deps(4);
-    deps[0] = std::make_pair(std::set<Node_Id_Type>{0}, std::set<Node_Id_Type>{0, 1, 3});
-    deps[1] = std::make_pair(std::set<Node_Id_Type>{0, 1, 2}, std::set<Node_Id_Type>{1, 2});
-    deps[2] = std::make_pair(std::set<Node_Id_Type>{1, 2}, std::set<Node_Id_Type>{1, 2, 3});
-    deps[3] = std::make_pair(std::set<Node_Id_Type>{0, 2, 3}, std::set<Node_Id_Type>{3});
+    deps[0] = std::make_pair(Neighbour_Id_Collection_Type{0}, Neighbour_Id_Collection_Type{0, 1, 3});
+    deps[1] = std::make_pair(Neighbour_Id_Collection_Type{0, 1, 2}, Neighbour_Id_Collection_Type{1, 2});
+    deps[2] = std::make_pair(Neighbour_Id_Collection_Type{1, 2}, Neighbour_Id_Collection_Type{1, 2, 3});
+    deps[3] = std::make_pair(Neighbour_Id_Collection_Type{0, 2, 3}, Neighbour_Id_Collection_Type{3});
 
     res.weights_params.bandwidth = std::make_unique<g_type>(g_type::Node_Collection_Type(4), std::move(deps));
 
@@ -63,6 +63,50 @@ namespace
     ASSERT_EQ(lhs, rhs);
   }
 
+  /// Check that the columnar store of the nodes agrees with the memory usages computed on the nodes
+  TEST(ComputerTests, NodeColumnsGraphCustomClass)
+  {
+    auto graph_cons = basic_graph();
+    for (auto &node : graph_cons)
+      {
+        node.name = "node_" + std::to_string(node.get_id());
+
+        // The inner nodes share the same operation id
+        if (node.get_id() > 0 && node.get_id() + 1 < graph_cons.size())
+          {
+            auto const &content = node.content;
+            node.content        = Content_type(content.get_input(),
+                                               content.get_output(),
+                                               content.get_parameters(),
+                                               content.get_attributes(),
+                                               std::string("conv"));
+          }
+      }
+
+    auto const columns = Computer_memory::compute_node_columns(graph_cons);
+    ASSERT_EQ(columns.size(), graph_cons.size());
+
+    auto const input_memory  = Computer_memory::compute_nodes_memory_usage_input(graph_cons);
+    auto const output_memory = Computer_memory::compute_nodes_memory_usage_output(graph_cons);
+    auto const params_memory = Computer_memory::compute_nodes_memory_usage_parameters(graph_cons);
+
+    EXPECT_TRUE(std::ranges::equal(columns.get_input_memory(), input_memory));
+    EXPECT_TRUE(std::ranges::equal(columns.get_output_memory(), output_memory));
+    EXPECT_TRUE(std::ranges::equal(columns.get_parameters_memory(), params_memory));
+
+    for (Node_Id_Type id = 0; id < graph_cons.size(); ++id)
+      {
+        EXPECT_EQ(columns.get_name(id), graph_cons[id].name);
+        EXPECT_EQ(columns.get_operation_name(id), graph_cons[id].content.get_operation_id());
+      }
+    EXPECT_EQ(columns.get_operation_id(1), columns.get_operation_id(2));
+
+    EXPECT_EQ(Computer_memory::compute_memory_usage_input(columns),
+              Computer_memory::compute_memory_usage_input(graph_cons));
+    EXPECT_EQ(Computer_memory::compute_memory_usage_parameters(columns),
+              Computer_memory::compute_memory_usage_parameters(graph_cons));
+  }
+
 
   auto
   basic_graph() -> Graph_type
@@ -29,7 +29,7 @@ namespace
     importer.import_weights(
       [](const Converted_Onnx_Graph_Type::Node_Type &node) { return node.content.get_operation_id() == "conv"; });
 
-    ASSERT_DOUBLE_EQ(graph.get_weight(0, {72, 73}), 0.018818040739131837);
+    ASSERT_DOUBLE_EQ(graph.get_weight(0, {72, 73}), to_time_type(0.018818040739131837));
   }
 
   /// Check if Csv_Weight_Importer work as expected
@@ -50,8 +50,8 @@ namespace
     importer.import_weights(
       [](const Converted_Onnx_Graph_Type::Node_Type &node) { return node.content.get_operation_id() == "conv"; });
 
-    EXPECT_DOUBLE_EQ(graph.get_weight(0, {1, 2}), 0.000177);
-    ASSERT_DOUBLE_EQ(graph.get_weight(1, {1, 2}), 0.000249);
+    EXPECT_DOUBLE_EQ(graph.get_weight(0, {1, 2}), to_time_type(0.000177));
+    ASSERT_DOUBLE_EQ(graph.get_weight(1, {1, 2}), to_time_type(0.000249));
   }
 
   /// Check if Csv_Weight_Importer work as expected
@@ -72,11 +72,11 @@ namespace
                                      ',');
     importer.import_weights();
 
-    EXPECT_DOUBLE_EQ(graph.get_weight({1, 3}), 5.1);
-    EXPECT_DOUBLE_EQ(graph.get_weight({1, 4}), 5.2);
+    EXPECT_DOUBLE_EQ(graph.get_weight({1, 3}), to_time_type(5.1));
+    EXPECT_DOUBLE_EQ(graph.get_weight({1, 4}), to_time_type(5.2));
 
-    EXPECT_DOUBLE_EQ(graph.get_weight({0, 1}), 1234.1);
-    EXPECT_DOUBLE_EQ(graph.get_weight({0, 2}), 1234.2);
+    EXPECT_DOUBLE_EQ(graph.get_weight({0, 1}), to_time_type(1234.1));
+    EXPECT_DOUBLE_EQ(graph.get_weight({0, 2}), to_time_type(1234.2));
   }
 
   /// Check if Csv_Weight_Importer work as expected
@@ -97,11 +97,11 @@ namespace
                                      ',');
     importer.import_weights();
 
-    EXPECT_DOUBLE_EQ(graph.get_weight({1, 3}), 5.1);
-    EXPECT_DOUBLE_EQ(graph.get_weight({1, 4}), 5.2);
+    EXPECT_DOUBLE_EQ(graph.get_weight({1, 3}), to_time_type(5.1));
+    EXPECT_DOUBLE_EQ(graph.get_weight({1, 4}), to_time_type(5.2));
 
-    EXPECT_DOUBLE_EQ(graph.get_weight({0, 1}), 1234.1);
-    EXPECT_DOUBLE_EQ(graph.get_weight({0, 2}), 1234.2);
+    EXPECT_DOUBLE_EQ(graph.get_weight({0, 1}), to_time_type(1234.1));
+    EXPECT_DOUBLE_EQ(graph.get_weight({0, 2}), to_time_type(1234.2));
   }
 
   auto
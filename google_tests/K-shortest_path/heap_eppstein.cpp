@@ -1,4 +1,12 @@
 #include <network_butcher/K-shortest_path/heap_eppstein.h>
+#include <network_butcher/K-shortest_path/heap_selection.h>
+#include <network_butcher/K-shortest_path/min_max_heap.h>
+
+#include <algorithm>
+#include <bit>
+#include <random>
+#include <set>
+
 #include <gtest/gtest.h>
 
 /// Check if the implementation of the heap is correct
@@ -171,5 +179,85 @@ namespace
       }
   }
 
+  /// Check if the heap selection of Frederickson selects the smallest elements of a heap-ordered tree
+  TEST(HeapSelectionTest, Frederickson)
+  {
+    // An implicit 3-ary tree: the children of i are 3i+1, 3i+2 and 3i+3. Every key is not smaller than the key of its
+    // parent
+    std::size_t const num_elements = 5000;
+
+    std::vector<int> keys(num_elements);
+    for (std::size_t i = 1; i < num_elements; ++i)
+      keys[i] = keys[(i - 1) / 3] + static_cast<int>((i * 7919) % 13);
+
+    auto sorted_keys = keys;
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+
+    std::size_t num_expanded = 0;
+
+    auto const key    = [&keys](std::size_t i) { return keys[i]; };
+    auto const expand = [&num_expanded](std::size_t i, auto const &push) {
+      ++num_expanded;
+      for (std::size_t child = 3 * i + 1; child <= 3 * i + 3 && child < num_elements; ++child)
+        push(child);
+    };
+
+    for (std::size_t k : {0, 1, 2, 3, 10, 100, 1000, 4999, 5000, 10000})
+      {
+        num_expanded = 0;
 
+        auto const res = Heap_Selection::frederickson(std::size_t{0}, k, key, expand);
+
+        ASSERT_EQ(std::min(k, num_elements), res.size());
+
+        for (std::size_t i = 0; i < res.size(); ++i)
+          ASSERT_EQ(sorted_keys[i], keys[res[i]]);
+
+        // Every element is selected at most once
+        ASSERT_EQ(res.size(), std::set<std::size_t>(res.cbegin(), res.cend()).size());
+
+        // Only O(k) elements are expanded
+        ASSERT_LE(num_expanded, 3 * k + 4 * std::bit_width(k));
+      }
+  }
+
+  /// Check if Min_Max_Heap produces both the smallest and the largest elements, as a sorted multiset
+  TEST(HeapSelectionTest, MinMaxHeap)
+  {
+    std::mt19937                       generator(42);
+    std::uniform_int_distribution<int> operation(0, 2);
+    std::uniform_int_distribution<int> value(0, 100);
+
+    Min_Max_Heap<int>  heap;
+    std::multiset<int> expected;
+
+    for (std::size_t i = 0; i < 20000; ++i)
+      {
+        auto const op = operation(generator);
+
+        if (op == 0 || expected.empty())
+          {
+            auto const element = value(generator);
+
+            heap.push(element);
+            expected.insert(element);
+          }
+        else if (op == 1)
+          {
+            ASSERT_EQ(*expected.cbegin(), heap.min());
+
+            heap.pop_min();
+            expected.erase(expected.cbegin());
+          }
+        else
+          {
+            ASSERT_EQ(*expected.crbegin(), heap.max());
+
+            heap.pop_max();
+            expected.erase(std::prev(expected.cend()));
+          }
+
+        ASSERT_EQ(expected.size(), heap.size());
+      }
+  }
 } // namespace
\ No newline at end of file
@@ -1,6 +1,15 @@
 #include <network_butcher/Network/graph_traits.h>
+#include <network_butcher/K-shortest_path/csr_weighted_graph.h>
+#include <network_butcher/K-shortest_path/kastar.h>
 #include <network_butcher/K-shortest_path/keppstein.h>
+#include <network_butcher/K-shortest_path/keppstein_frederickson.h>
 #include <network_butcher/K-shortest_path/keppstein_lazy.h>
+#include <network_butcher/K-shortest_path/kfinder_factory.h>
+#include <network_butcher/K-shortest_path/kyen.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
 
 #include "../test_class.h"
 #include "../test_graph.h"
@@ -28,6 +37,15 @@ namespace
   auto
   eppstein_graph() -> Graph_type;
 
+  /// It builds the (only distance) KFinders registered in the factory, together with KFinder_Eppstein_Frederickson
+  /// \param graph The graph
+  /// \param root The root node id
+  /// \param sink The sink node id
+  /// \return The pairs of (method name, KFinder)
+  auto
+  distance_kfinders(Graph_type const &graph, Node_Id_Type root, Node_Id_Type sink)
+    -> std::vector<std::pair<std::string, std::unique_ptr<KFinder<Graph_type, true>>>>;
+
   auto
   test_graph() -> Test_Graph<basic_type>;
 
@@ -63,6 +81,85 @@ namespace
       }
   }
 
+  /// Checks if KFinder_Eppstein_Frederickson works correctly with the graph from Eppstein's paper
+  TEST(KFinderTest, EppsteinFredericksonOriginalNetwork)
+  {
+    auto const                    graph = eppstein_graph();
+    KFinder_Eppstein_Frederickson kfinder(graph, graph.get_nodes().front().get_id(), graph.get_nodes().back().get_id());
+
+    std::vector<type_weight> real_sol = {55., 58., 59., 61., 62., 64., 65., 68., 68., 71.};
+
+    // There are only 10 paths
+    auto const res = kfinder.compute(100);
+
+    ASSERT_EQ(real_sol.size(), res.size());
+
+    for (std::size_t j = 0; j < res.size(); ++j)
+      {
+        auto const &path = res[j];
+
+        decltype(path.length) weight = 0.;
+        for (std::size_t i = 0; i < path.path.size() - 1; ++i)
+          {
+            ASSERT_TRUE(graph.get_output_nodes(path.path[i]).contains(path.path[i + 1]));
+            weight += graph.get_weight(std::make_pair(path.path[i], path.path[i + 1]));
+          }
+
+        ASSERT_EQ(graph.get_nodes().front().get_id(), path.path.front());
+        ASSERT_EQ(graph.get_nodes().back().get_id(), path.path.back());
+
+        ASSERT_EQ(weight, path.length);
+        ASSERT_EQ(real_sol[j], path.length);
+      }
+
+    for (std::size_t k = 1; k <= real_sol.size(); ++k)
+      {
+        auto const partial = kfinder.compute(k);
+
+        ASSERT_EQ(k, partial.size());
+        for (std::size_t j = 0; j < k; ++j)
+          ASSERT_EQ(real_sol[j], partial[j].length);
+      }
+  }
+
+  /// Checks if KFinder_Yen works correctly with the graph from Eppstein's paper
+  TEST(KFinderTest, YenOriginalNetwork)
+  {
+    auto const  graph = eppstein_graph();
+    KFinder_Yen kfinder(graph, graph.get_nodes().front().get_id(), graph.get_nodes().back().get_id());
+
+    std::vector<type_weight> real_sol = {55., 58., 59., 61., 62., 64., 65., 68., 68., 71.};
+
+    // There are only 10 paths
+    auto const res = kfinder.compute(100);
+
+    ASSERT_EQ(real_sol.size(), res.size());
+
+    for (std::size_t j = 0; j < res.size(); ++j)
+      {
+        auto const &path = res[j];
+
+        decltype(path.length) weight = 0.;
+        for (std::size_t i = 0; i < path.path.size() - 1; ++i)
+          {
+            ASSERT_TRUE(graph.get_output_nodes(path.path[i]).contains(path.path[i + 1]));
+            weight += graph.get_weight(std::make_pair(path.path[i], path.path[i + 1]));
+          }
+
+        ASSERT_EQ(graph.get_nodes().front().get_id(), path.path.front());
+        ASSERT_EQ(graph.get_nodes().back().get_id(), path.path.back());
+
+        ASSERT_EQ(weight, path.length);
+        ASSERT_EQ(real_sol[j], path.length);
+      }
+
+    auto enumerator = kfinder.enumerate();
+    for (auto const &path : res)
+      ASSERT_EQ(path.path, enumerator->next()->path);
+
+    ASSERT_FALSE(enumerator->next().has_value());
+  }
+
   /// Checks if KFinder_Lazy_Eppstein works correctly with the graph from Eppstein's paper
   TEST(KFinderTest, LazyEppsteinOriginalNetwork)
   {
@@ -139,6 +236,683 @@ namespace
       }
   }
 
+  /// Checks if KFinder_Eppstein and KFinder_Lazy_Eppstein work correctly with the CSR graph
+  TEST(KFinderTest, EppsteinCsrOriginalNetwork)
+  {
+    auto const graph = eppstein_graph();
+
+    KFinder_Eppstein<Graph_type, false, Csr_Weighted_Graph<Graph_type>> kfinder(
+      graph, graph.get_nodes().front().get_id(), graph.get_nodes().back().get_id());
+    KFinder_Lazy_Eppstein<Graph_type, false, Csr_Weighted_Graph<Graph_type>> lazy_kfinder(
+      graph, graph.get_nodes().front().get_id(), graph.get_nodes().back().get_id());
+
+    std::vector<type_weight> real_sol = {55., 58., 59., 61., 62., 64., 65., 68., 68., 71.};
+
+    for (auto const &res : {kfinder.compute(real_sol.size()), lazy_kfinder.compute(real_sol.size())})
+      {
+        ASSERT_EQ(real_sol.size(), res.size());
+
+        for (std::size_t j = 0; j < res.size(); ++j)
+          {
+            auto const &path = res[j];
+
+            decltype(path.length) weight = 0.;
+            for (std::size_t i = 0; i < path.path.size() - 1; ++i)
+              {
+                ASSERT_TRUE(graph.get_output_nodes(path.path[i]).contains(path.path[i + 1]));
+                weight += graph.get_weight(std::make_pair(path.path[i], path.path[i + 1]));
+              }
+
+            ASSERT_EQ(weight, path.length);
+            ASSERT_EQ(real_sol[j], path.length);
+          }
+      }
+  }
+
+  /// Checks if the CSR graph handles parallel edges like the standard Weighted_Graph
+  TEST(KFinderTest, EppsteinCsrParallelEdges)
+  {
+    using Parallel_Graph_type = types::WGraph<true, types::Node, unsigned long long int>;
+    using Standard_type       = Weighted_Graph<Parallel_Graph_type,
+                                         false,
+                                         Parallel_Graph_type::Node_Type,
+                                         Parallel_Graph_type::Node_Collection_Type,
+                                         unsigned long long int>;
+    using Csr_type            = Csr_Weighted_Graph<Parallel_Graph_type, false, unsigned long long int>;
+
+    Parallel_Graph_type::Neighbours_Type deps(4);
+    std::vector<std::pair<Edge_Type, unsigned long long int>> edges{
+      {{0, 1}, 3}, {{0, 1}, 1}, {{0, 2}, 2}, {{1, 2}, 1}, {{1, 3}, 7}, {{1, 3}, 4}, {{2, 3}, 5}, {{2, 3}, 2}};
+
+    for (auto const &[edge, weight] : edges)
+      {
+        deps[edge.first].second.insert(edge.second);
+        deps[edge.second].first.insert(edge.first);
+      }
+
+    Parallel_Graph_type graph(std::vector<types::Node>(4), deps);
+    for (auto const &[edge, weight] : edges)
+      graph.set_weight(edge, weight);
+
+    Csr_type const csr_graph(graph);
+    ASSERT_EQ(std::vector<unsigned long long int>({1, 3}),
+              std::vector<unsigned long long int>(csr_graph.get_weight({0, 1}).begin(),
+                                                  csr_graph.get_weight({0, 1}).end()));
+    ASSERT_EQ(std::vector<unsigned long long int>({2, 5}),
+              std::vector<unsigned long long int>(csr_graph.reverse().get_weight({3, 2}).begin(),
+                                                  csr_graph.reverse().get_weight({3, 2}).end()));
+
+    KFinder_Eppstein<Parallel_Graph_type, true, Standard_type> standard(graph, 0, 3);
+    KFinder_Eppstein<Parallel_Graph_type, true, Csr_type>      csr(graph, 0, 3);
+    KFinder_Lazy_Eppstein<Parallel_Graph_type, true, Csr_type> lazy_csr(graph, 0, 3);
+    KFinder_Yen<Parallel_Graph_type, true, Csr_type>           yen_csr(graph, 0, 3);
+
+    auto const expected = standard.compute(20);
+
+    ASSERT_EQ(expected, csr.compute(20));
+    ASSERT_EQ(expected, lazy_csr.compute(20));
+    ASSERT_EQ(expected, yen_csr.compute(20));
+  }
+
+  /// Checks if the enumerators produce the same paths as compute, one at a time, until there are no more paths
+  TEST(KFinderTest, EppsteinEnumerate)
+  {
+    auto const graph = eppstein_graph();
+    auto const root  = graph.get_nodes().front().get_id();
+    auto const sink  = graph.get_nodes().back().get_id();
+
+    KFinder_Eppstein      kfinder(graph, root, sink);
+    KFinder_Lazy_Eppstein lazy_kfinder(graph, root, sink);
+
+    // The graph has less than 1000 paths, thus compute returns all of them
+    auto const expected = kfinder.compute(1000);
+    ASSERT_LT(expected.size(), 1000);
+
+    for (auto const &enumerator : {kfinder.enumerate(), lazy_kfinder.enumerate()})
+      {
+        std::size_t j = 0;
+        for (auto path = enumerator->next(); path; path = enumerator->next(), ++j)
+          {
+            ASSERT_LT(j, expected.size());
+            ASSERT_EQ(expected[j].length, path->length);
+            ASSERT_EQ(expected[j].path, path->path);
+          }
+
+        ASSERT_EQ(expected.size(), j);
+        ASSERT_FALSE(enumerator->next());
+      }
+
+    // The enumerator doesn't depend on the KFinder that produced it
+    auto enumerator =
+      KFinder_Factory<Graph_type, true>::Instance().create("lazy_eppstein", graph, root, sink)->enumerate();
+
+    for (auto const &path : expected)
+      ASSERT_EQ(path.length, enumerator->next());
+
+    ASSERT_FALSE(enumerator->next());
+
+    // If the sink cannot be reached, there are no paths
+    KFinder_Eppstein unreachable(graph, sink, root);
+    ASSERT_FALSE(unreachable.enumerate()->next());
+  }
+
+  /// Checks if the KFinders can extend a previous result, sharing the cached search among compute, compute_lengths
+  /// and the enumerators
+  TEST(KFinderTest, EppsteinResumableK)
+  {
+    auto const graph = eppstein_graph();
+    auto const root  = graph.get_nodes().front().get_id();
+    auto const sink  = graph.get_nodes().back().get_id();
+
+    // The graph has exactly 10 paths
+    auto const expected = KFinder_Eppstein(graph, root, sink).compute(10);
+    ASSERT_EQ(10, expected.size());
+
+    KFinder_Eppstein      kfinder(graph, root, sink);
+    KFinder_Lazy_Eppstein lazy_kfinder(graph, root, sink);
+
+    for (Basic_KEppstein<Graph_type, false> const *finder :
+         std::vector<Basic_KEppstein<Graph_type, false> const *>{&kfinder, &lazy_kfinder})
+      {
+        for (std::size_t K : {1, 3, 2, 7, 10})
+          {
+            auto const res = finder->compute(K);
+
+            ASSERT_EQ(K, res.size());
+            for (std::size_t j = 0; j < K; ++j)
+              {
+                ASSERT_EQ(expected[j].length, res[j].length);
+                ASSERT_EQ(expected[j].path, res[j].path);
+              }
+
+            auto const lengths = finder->compute_lengths(K);
+            ASSERT_EQ(K, lengths.size());
+            for (std::size_t j = 0; j < K; ++j)
+              ASSERT_EQ(expected[j].length, lengths[j]);
+          }
+
+        // The enumerator restarts from the shortest path, reusing the cached paths
+        auto const enumerator = finder->enumerate();
+        for (auto const &path : expected)
+          ASSERT_EQ(path.path, enumerator->next()->path);
+
+        ASSERT_FALSE(enumerator->next());
+        ASSERT_EQ(expected.size(), finder->compute(20).size());
+
+        finder->reset();
+        ASSERT_EQ(expected.back().length, finder->compute(10).back().length);
+      }
+  }
+
+  /// Checks if the compact collections of paths produced by the KFinders describe the same paths as compute
+  TEST(KFinderTest, EppsteinPathTrie)
+  {
+    auto const graph = eppstein_graph();
+    auto const root  = graph.get_nodes().front().get_id();
+    auto const sink  = graph.get_nodes().back().get_id();
+
+    // The graph has exactly 10 paths (and it's acyclic, thus they're all loopless)
+    auto const expected = KFinder_Eppstein(graph, root, sink).compute(10);
+    ASSERT_EQ(10, expected.size());
+
+    std::set<std::vector<Node_Id_Type>> expected_paths;
+    for (auto const &path : expected)
+      expected_paths.insert(path.path);
+
+    // The collection doesn't depend on Only_Distance
+    for (auto const &[method, kfinder] : distance_kfinders(graph, root, sink))
+      {
+        ASSERT_TRUE(kfinder->compute_path_trie(0).empty());
+
+        auto const trie = kfinder->compute_path_trie(20);
+        ASSERT_EQ(expected.size(), trie.size());
+
+        // The Eppstein algorithms store a single sidetrack per path (the shortest path has none): the other sidetracks
+        // are shared with the previous paths
+        if (method != "yen")
+          {
+            ASSERT_EQ(expected.size() - 1, trie.num_sidetracks());
+          }
+
+        std::set<std::vector<Node_Id_Type>> paths;
+        for (std::size_t j = 0; j < trie.size(); ++j)
+          {
+            auto const path = trie.explicit_path(j);
+
+            ASSERT_EQ(expected[j].length, trie.length(j));
+            ASSERT_EQ(expected[j].length, path.length);
+
+            paths.insert(path.path);
+          }
+
+        // Paths with the same length may be produced in a different order
+        ASSERT_EQ(expected_paths, paths);
+        ASSERT_EQ(expected.front().path, trie.explicit_paths().front().path);
+      }
+
+    // The shortest path tree is shared with the cached search, that is kept alive by the collection
+    auto trie = KFinder_Eppstein(graph, root, sink).compute_path_trie(10);
+    ASSERT_EQ(expected.back().path, trie.explicit_path(9).path);
+  }
+
+  /// Checks if the KFinders stop at the given bound on the length of the paths, without affecting the following searches
+  TEST(KFinderTest, EppsteinLengthBound)
+  {
+    auto const graph = eppstein_graph();
+    auto const root  = graph.get_nodes().front().get_id();
+    auto const sink  = graph.get_nodes().back().get_id();
+
+    std::vector<Time_Type> const real_sol = {55, 58, 59, 61, 62, 64, 65, 68, 68, 71};
+
+    using Length_Bound = Templated_Length_Bound<Time_Type>;
+
+    // Within 10% of the optimum, i.e., not longer than 60.5
+    Length_Bound relative;
+    relative.max_relative_gap = 0.1;
+
+    Length_Bound absolute;
+    absolute.max_length = 68.;
+
+    Length_Bound too_short;
+    too_short.max_length = 50.;
+
+    ASSERT_FALSE(Length_Bound().bounded());
+    ASSERT_EQ(std::numeric_limits<Time_Type>::max(), Length_Bound().limit(55.));
+    ASSERT_DOUBLE_EQ(static_cast<Time_Type>(60.5L), relative.limit(55)); // Truncated with fixed-point weights
+
+    for (auto const &[method, kfinder] : distance_kfinders(graph, root, sink))
+      {
+        ASSERT_EQ(std::vector<Time_Type>({55, 58, 59}), kfinder->compute_bounded(100, relative));
+        ASSERT_EQ(std::vector<Time_Type>({55, 58}), kfinder->compute_bounded(2, relative));
+        ASSERT_TRUE(kfinder->compute_bounded(100, too_short).empty());
+
+        // The paths with the same length as the bound are included
+        ASSERT_EQ(9, kfinder->compute_path_trie(100, absolute).size());
+
+        // A following search without bound extends the previous one
+        ASSERT_EQ(real_sol, kfinder->compute(100));
+        ASSERT_EQ(std::vector<Time_Type>({55, 58, 59}), kfinder->compute_bounded(100, relative));
+      }
+  }
+
+  /// Checks if the bounded queue produces the same paths as the cached search, without affecting it
+  TEST(KFinderTest, EppsteinBoundedQueue)
+  {
+    auto const graph = eppstein_graph();
+    auto const root  = graph.get_nodes().front().get_id();
+    auto const sink  = graph.get_nodes().back().get_id();
+
+    // The graph has exactly 10 paths
+    auto const expected = KFinder_Eppstein(graph, root, sink).compute(10);
+    ASSERT_EQ(10, expected.size());
+
+    Templated_Length_Bound<Time_Type> relative;
+    relative.max_relative_gap = 0.1;
+
+    KFinder_Eppstein      kfinder(graph, root, sink);
+    KFinder_Lazy_Eppstein lazy_kfinder(graph, root, sink);
+
+    for (Basic_KEppstein<Graph_type, false> *finder :
+         std::vector<Basic_KEppstein<Graph_type, false> *>{&kfinder, &lazy_kfinder})
+      {
+        finder->set_bounded_queue(true);
+
+        for (std::size_t K : {1, 2, 3, 7, 10, 20})
+          {
+            auto const res     = finder->compute(K);
+            auto const lengths = finder->compute_lengths(K);
+            auto const trie    = finder->compute_path_trie(K);
+
+            ASSERT_EQ(std::min(K, expected.size()), res.size());
+            ASSERT_EQ(res.size(), lengths.size());
+            ASSERT_EQ(res.size(), trie.size());
+
+            for (std::size_t j = 0; j < res.size(); ++j)
+              {
+                ASSERT_EQ(expected[j].length, res[j].length);
+                ASSERT_EQ(expected[j].length, lengths[j]);
+                ASSERT_EQ(res[j].path, trie.explicit_path(j).path);
+              }
+          }
+
+        // The paths with the same length may be produced in a different order
+        auto res = finder->compute(10);
+        auto const path_less = [](auto const &lhs, auto const &rhs) { return lhs.path < rhs.path; };
+
+        auto sorted_expected = expected;
+        std::sort(res.begin(), res.end(), path_less);
+        std::sort(sorted_expected.begin(), sorted_expected.end(), path_less);
+
+        for (std::size_t j = 0; j < res.size(); ++j)
+          ASSERT_EQ(sorted_expected[j].path, res[j].path);
+
+        ASSERT_EQ(std::vector<Time_Type>({55, 58, 59}), finder->compute_lengths(100, relative));
+
+        // The enumerators still use the cached search
+        auto const enumerator = finder->enumerate();
+        for (auto const &path : expected)
+          ASSERT_EQ(path.path, enumerator->next()->path);
+
+        ASSERT_FALSE(enumerator->next());
+
+        finder->set_bounded_queue(false);
+        ASSERT_EQ(expected.back().path, finder->compute(10).back().path);
+      }
+  }
+
+  /// Checks if the (parallel) construction of the H_outs of KFinder_Eppstein works correctly on a graph large enough
+  /// to be split among several tasks
+  TEST(KFinderTest, EppsteinLargeGraph)
+  {
+    using Parallel_Graph_type = types::WGraph<true, types::Node, unsigned long long int>;
+    using Standard_type       = Weighted_Graph<Parallel_Graph_type,
+                                         false,
+                                         Parallel_Graph_type::Node_Type,
+                                         Parallel_Graph_type::Node_Collection_Type,
+                                         unsigned long long int>;
+
+    std::size_t const num_nodes = 5000;
+
+    std::mt19937                                          generator(42);
+    std::uniform_int_distribution<std::size_t>            jump(1, 20);
+    std::uniform_int_distribution<unsigned long long int> weight(1, 100);
+
+    Parallel_Graph_type::Neighbours_Type                      deps(num_nodes);
+    std::vector<std::pair<Edge_Type, unsigned long long int>> edges;
+
+    for (std::size_t tail = 0; tail + 1 < num_nodes; ++tail)
+      {
+        for (std::size_t i = 0; i < 3; ++i)
+          {
+            auto const head = std::min(num_nodes - 1, tail + (i == 0 ? 1 : jump(generator)));
+            edges.push_back({{tail, head}, weight(generator)});
+
+            deps[tail].second.insert(head);
+            deps[head].first.insert(tail);
+          }
+      }
+
+    Parallel_Graph_type graph(std::vector<types::Node>(num_nodes), deps);
+    for (auto const &[edge, edge_weight] : edges)
+      graph.set_weight(edge, edge_weight);
+
+    KFinder_Eppstein<Parallel_Graph_type, true, Standard_type>      kfinder(graph, 0, num_nodes - 1);
+    KFinder_Lazy_Eppstein<Parallel_Graph_type, true, Standard_type> lazy_kfinder(graph, 0, num_nodes - 1);
+
+    auto const res = kfinder.compute(500);
+
+    ASSERT_EQ(500, res.size());
+    ASSERT_TRUE(std::is_sorted(res.cbegin(), res.cend()));
+    ASSERT_EQ(lazy_kfinder.compute(500), res);
+
+    KFinder_Eppstein_Frederickson<Parallel_Graph_type, true, Standard_type> frederickson_kfinder(graph,
+                                                                                                0,
+                                                                                                num_nodes - 1);
+
+    for (std::size_t k : {1, 2, 37, 500})
+      ASSERT_EQ(frederickson_kfinder.compute(k), std::vector(res.cbegin(), std::next(res.cbegin(), k)));
+
+    // The bounded queue never holds more than the missing paths
+    kfinder.set_bounded_queue(true);
+    lazy_kfinder.set_bounded_queue(true);
+
+    for (std::size_t k : {1, 2, 37, 500})
+      {
+        ASSERT_EQ(kfinder.compute(k), std::vector(res.cbegin(), std::next(res.cbegin(), k)));
+        ASSERT_EQ(lazy_kfinder.compute(k), std::vector(res.cbegin(), std::next(res.cbegin(), k)));
+      }
+
+    // The graph is acyclic: the loopless paths found by Yen are the same
+    KFinder_Yen<Parallel_Graph_type, true, Standard_type> yen_kfinder(graph, 0, num_nodes - 1);
+    ASSERT_EQ(yen_kfinder.compute(500), res);
+  }
+
+  TEST(KFinderTest, EppsteinWideGraph)
+  {
+    using Parallel_Graph_type = types::WGraph<true, types::Node, unsigned long long int>;
+    using Standard_type       = Weighted_Graph<Parallel_Graph_type,
+                                         false,
+                                         Parallel_Graph_type::Node_Type,
+                                         Parallel_Graph_type::Node_Collection_Type,
+                                         unsigned long long int>;
+
+    // Two layers of width nodes between the root and the sink: the levels of the shortest path tree are wide enough
+    // to be processed in parallel
+    std::size_t const width     = 600;
+    std::size_t const num_nodes = 2 * width + 2;
+    std::size_t const sink      = num_nodes - 1;
+
+    std::mt19937                                          generator(7);
+    std::uniform_int_distribution<std::size_t>            layer(0, width - 1);
+    std::uniform_int_distribution<unsigned long long int> weight(1, 100);
+
+    Parallel_Graph_type::Neighbours_Type                      deps(num_nodes);
+    std::vector<std::pair<Edge_Type, unsigned long long int>> edges;
+
+    auto const add_edge = [&](std::size_t tail, std::size_t head) {
+      if (deps[tail].second.insert(head).second)
+        {
+          deps[head].first.insert(tail);
+          edges.push_back({{tail, head}, weight(generator)});
+        }
+    };
+
+    for (std::size_t i = 0; i < width; ++i)
+      {
+        add_edge(0, 1 + i);
+        add_edge(1 + width + i, sink);
+
+        for (std::size_t j = 0; j < 3; ++j)
+          add_edge(1 + i, 1 + width + layer(generator));
+      }
+
+    Parallel_Graph_type graph(std::vector<types::Node>(num_nodes), deps);
+    for (auto const &[edge, edge_weight] : edges)
+      graph.set_weight(edge, edge_weight);
+
+    KFinder_Eppstein<Parallel_Graph_type, true, Standard_type>      kfinder(graph, 0, sink);
+    KFinder_Lazy_Eppstein<Parallel_Graph_type, true, Standard_type> lazy_kfinder(graph, 0, sink);
+
+    auto const res = kfinder.compute(1000);
+
+    ASSERT_EQ(1000, res.size());
+    ASSERT_TRUE(std::is_sorted(res.cbegin(), res.cend()));
+    ASSERT_EQ(lazy_kfinder.compute(1000), res);
+  }
+
+  TEST(KFinderTest, LazyEppsteinDeepGraph)
+  {
+    using Parallel_Graph_type = types::WGraph<true, types::Node, unsigned long long int>;
+    using Standard_type       = Weighted_Graph<Parallel_Graph_type,
+                                         false,
+                                         Parallel_Graph_type::Node_Type,
+                                         Parallel_Graph_type::Node_Collection_Type,
+                                         unsigned long long int>;
+
+    // A long chain with a few shortcuts: the shortest path tree is as deep as the graph
+    std::size_t const num_nodes = 100000;
+
+    Parallel_Graph_type::Neighbours_Type                      deps(num_nodes);
+    std::vector<std::pair<Edge_Type, unsigned long long int>> edges;
+
+    for (std::size_t tail = 0; tail + 1 < num_nodes; ++tail)
+      {
+        edges.push_back({{tail, tail + 1}, 1});
+        deps[tail].second.insert(tail + 1);
+        deps[tail + 1].first.insert(tail);
+
+        if (tail % 1000 == 0 && tail + 2 < num_nodes)
+          {
+            edges.push_back({{tail, tail + 2}, 3 + tail / 1000});
+            deps[tail].second.insert(tail + 2);
+            deps[tail + 2].first.insert(tail);
+          }
+      }
+
+    Parallel_Graph_type graph(std::vector<types::Node>(num_nodes), deps);
+    for (auto const &[edge, edge_weight] : edges)
+      graph.set_weight(edge, edge_weight);
+
+    KFinder_Eppstein<Parallel_Graph_type, true, Standard_type>      kfinder(graph, 0, num_nodes - 1);
+    KFinder_Lazy_Eppstein<Parallel_Graph_type, true, Standard_type> lazy_kfinder(graph, 0, num_nodes - 1);
+
+    auto const res = lazy_kfinder.compute(20);
+
+    ASSERT_EQ(20, res.size());
+    ASSERT_EQ(num_nodes - 1, res.front());
+    ASSERT_EQ(num_nodes - 1 + 1, res[1]);
+    ASSERT_EQ(kfinder.compute(20), res);
+  }
+
+  /// Checks that KFinder_Yen only produces loopless paths when the graph has cycles
+  TEST(KFinderTest, YenLooplessPaths)
+  {
+    using Parallel_Graph_type = types::WGraph<true, types::Node, unsigned long long int>;
+    using Standard_type       = Weighted_Graph<Parallel_Graph_type,
+                                         false,
+                                         Parallel_Graph_type::Node_Type,
+                                         Parallel_Graph_type::Node_Collection_Type,
+                                         unsigned long long int>;
+
+    Parallel_Graph_type::Neighbours_Type deps(4);
+    std::vector<std::pair<Edge_Type, unsigned long long int>> edges{
+      {{0, 1}, 1}, {{1, 2}, 1}, {{2, 1}, 1}, {{1, 3}, 5}, {{2, 3}, 1}, {{2, 3}, 4}};
+
+    for (auto const &[edge, weight] : edges)
+      {
+        deps[edge.first].second.insert(edge.second);
+        deps[edge.second].first.insert(edge.first);
+      }
+
+    Parallel_Graph_type graph(std::vector<types::Node>(4), deps);
+    for (auto const &[edge, weight] : edges)
+      graph.set_weight(edge, weight);
+
+    KFinder_Yen<Parallel_Graph_type, false, Standard_type> kfinder(graph, 0, 3);
+
+    // The walks through the cycle 1 -> 2 -> 1 are not produced
+    auto const res = kfinder.compute(10);
+
+    ASSERT_EQ(3, res.size());
+
+    ASSERT_EQ(3, res[0].length);
+    ASSERT_EQ(std::vector<Node_Id_Type>({0, 1, 2, 3}), res[0].path);
+
+    // The second path of length 6 uses the heavier edge from 2 to 3
+    ASSERT_EQ(6, res[1].length);
+    ASSERT_EQ(6, res[2].length);
+    ASSERT_EQ(std::set<std::vector<Node_Id_Type>>({{0, 1, 2, 3}, {0, 1, 3}}),
+              std::set<std::vector<Node_Id_Type>>({res[1].path, res[2].path}));
+
+    KFinder_Eppstein<Parallel_Graph_type, true, Standard_type> eppstein(graph, 0, 3);
+    ASSERT_EQ(10, eppstein.compute(10).size());
+  }
+
+  /// Checks if KFinder_A_Star works correctly with the graph from Eppstein's paper (guided by the exact distances)
+  TEST(KFinderTest, AStarOriginalNetwork)
+  {
+    auto const graph = eppstein_graph();
+    auto const root  = graph.get_nodes().front().get_id();
+    auto const sink  = graph.get_nodes().back().get_id();
+
+    KFinder_A_Star kfinder(graph, root, sink);
+
+    std::vector<type_weight> real_sol = {55., 58., 59., 61., 62., 64., 65., 68., 68., 71.};
+
+    // There are only 10 paths
+    auto const res = kfinder.compute(100);
+
+    ASSERT_EQ(real_sol.size(), res.size());
+
+    for (std::size_t j = 0; j < res.size(); ++j)
+      {
+        auto const &path = res[j];
+
+        decltype(path.length) weight = 0.;
+        for (std::size_t i = 0; i < path.path.size() - 1; ++i)
+          {
+            ASSERT_TRUE(graph.get_output_nodes(path.path[i]).contains(path.path[i + 1]));
+            weight += graph.get_weight(std::make_pair(path.path[i], path.path[i + 1]));
+          }
+
+        ASSERT_EQ(root, path.path.front());
+        ASSERT_EQ(sink, path.path.back());
+
+        ASSERT_EQ(weight, path.length);
+        ASSERT_EQ(real_sol[j], path.length);
+      }
+
+    auto enumerator = kfinder.enumerate();
+    for (auto const &path : res)
+      ASSERT_EQ(path.path, enumerator->next()->path);
+
+    ASSERT_FALSE(enumerator->next().has_value());
+
+    // Every edge is stored in the collection, but the common prefixes are shared
+    auto const trie = kfinder.compute_path_trie(10);
+    ASSERT_EQ(res.size(), trie.size());
+
+    for (std::size_t j = 0; j < trie.size(); ++j)
+      ASSERT_EQ(res[j].path, trie.explicit_path(j).path);
+
+    // The bounds must match the graph
+    ASSERT_THROW(kfinder.set_lower_bounds({0, 0}), std::invalid_argument);
+  }
+
+  /// Checks that KFinder_A_Star, guided by the lower bounds of a layered graph, finds the same paths of Eppstein
+  TEST(KFinderTest, AStarLayeredGraph)
+  {
+    using Layered_Graph_type = types::WGraph<false, types::Node, unsigned long long int>;
+    using Standard_type      = Weighted_Graph<Layered_Graph_type,
+                                         false,
+                                         Layered_Graph_type::Node_Type,
+                                         Layered_Graph_type::Node_Collection_Type,
+                                         unsigned long long int>;
+
+    std::size_t const num_layers  = 100;
+    std::size_t const num_devices = 3;
+    std::size_t const num_nodes   = 2 + num_layers * num_devices;
+
+    std::mt19937                                          generator(42);
+    std::uniform_int_distribution<unsigned long long int> weight(1, 100);
+
+    // The first and the last node are layers on their own
+    std::vector<std::size_t> layers(num_nodes);
+    for (std::size_t node = 1; node + 1 < num_nodes; ++node)
+      layers[node] = 1 + (node - 1) / num_devices;
+    layers.back() = num_layers + 1;
+
+    Layered_Graph_type::Neighbours_Type                       deps(num_nodes);
+    std::vector<std::pair<Edge_Type, unsigned long long int>> edges;
+
+    for (std::size_t tail = 0; tail + 1 < num_nodes; ++tail)
+      {
+        for (std::size_t head = tail + 1; head < num_nodes; ++head)
+          {
+            if (layers[head] == layers[tail] + 1)
+              {
+                edges.push_back({{tail, head}, weight(generator)});
+
+                deps[tail].second.insert(head);
+                deps[head].first.insert(tail);
+              }
+          }
+      }
+
+    Layered_Graph_type graph(std::vector<types::Node>(num_nodes), deps);
+    for (auto const &[edge, edge_weight] : edges)
+      graph.set_weight(edge, edge_weight);
+
+    Standard_type const weighted_graph(graph);
+
+    // An edge inside a layer makes the bounds invalid
+    ASSERT_FALSE(Shortest_path_finder::layered_lower_bounds(weighted_graph,
+                                                            std::vector<std::size_t>(num_nodes, 0),
+                                                            num_nodes - 1)
+                   .has_value());
+
+    auto bounds = Shortest_path_finder::layered_lower_bounds(weighted_graph, layers, num_nodes - 1);
+    ASSERT_TRUE(bounds.has_value());
+
+    // The bounds never exceed the exact distances
+    auto const distances = Shortest_path_finder::shortest_path_tree(weighted_graph.reverse(), num_nodes - 1).second;
+    for (std::size_t node = 0; node < num_nodes; ++node)
+      ASSERT_LE((*bounds)[node], distances[node]);
+
+    KFinder_Eppstein<Layered_Graph_type, true, Standard_type> eppstein(graph, 0, num_nodes - 1);
+    KFinder_A_Star<Layered_Graph_type, true, Standard_type>   kfinder(graph, 0, num_nodes - 1);
+    kfinder.set_lower_bounds(std::move(*bounds));
+
+    auto const res = eppstein.compute(50);
+
+    for (std::size_t k : {1, 2, 5, 50})
+      ASSERT_EQ(kfinder.compute(k), std::vector(res.cbegin(), std::next(res.cbegin(), k)));
+
+    Standard_type::Weight_Type const max_length = res.front() + 5;
+
+    Templated_Length_Bound<Standard_type::Weight_Type> bound;
+    bound.max_length = max_length;
+
+    ASSERT_EQ(kfinder.compute_bounded(100, bound), eppstein.compute_bounded(100, bound));
+  }
+
+  auto
+  distance_kfinders(Graph_type const &graph, Node_Id_Type root, Node_Id_Type sink)
+    -> std::vector<std::pair<std::string, std::unique_ptr<KFinder<Graph_type, true>>>>
+  {
+    std::vector<std::pair<std::string, std::unique_ptr<KFinder<Graph_type, true>>>> res;
+
+    auto &factory = KFinder_Factory<Graph_type, true>::Instance();
+    for (std::string const method : {"eppstein", "lazy_eppstein", "yen"})
+      res.emplace_back(method, factory.create(method, graph, root, sink));
+
+    res.emplace_back("eppstein_frederickson",
+                     std::make_unique<KFinder_Eppstein_Frederickson<Graph_type, true>>(graph, root, sink));
+
+    return res;
+  }
+
+
   auto
   eppstein_graph() -> Graph_type
   {
@@ -223,7 +997,11 @@ namespace
 
     for (std::size_t i = 0; i < built_graph.size(); ++i)
       {
-        dependencies[i] = std::make_pair(built_graph.get_input_nodes(i), built_graph.get_output_nodes(i));
+        auto const &inputs  = built_graph.get_input_nodes(i);
+        auto const &outputs = built_graph.get_output_nodes(i);
+
+        dependencies[i] = std::make_pair(std::set<std::size_t>(inputs.cbegin(), inputs.cend()),
+                                         std::set<std::size_t>(outputs.cbegin(), outputs.cend()));
       }
 
     weights.emplace(std::make_pair(0, 1), 2);
@@ -1,11 +1,15 @@
 #include <network_butcher/Network/graph_traits.h>
 
+#include <network_butcher/K-shortest_path/csr_weighted_graph.h>
 #include <network_butcher/K-shortest_path/shortest_path_finder.h>
 
 #include "../test_class.h"
 #include "../test_graph.h"
 #include <gtest/gtest.h>
 
+#include <random>
+#include <tuple>
+
 /// Checks if the shortest path finder works correctly
 
 namespace
@@ -34,6 +38,12 @@ namespace
   auto
   test_graph() -> Test_Graph<basic_type>;
 
+  using Integer_Graph_type = types::WGraph<false, types::Node, unsigned long long int>;
+
+  auto
+  random_integer_graph(std::size_t num_nodes, std::size_t num_edges, unsigned long long int max_weight)
+    -> Integer_Graph_type;
+
   /// Checks if Dijkstra works correctly
   TEST(ShortestPathFinderTest, DijkstraSourceSink)
   {
@@ -58,6 +68,170 @@ namespace
     ASSERT_EQ(res.first, theoretical_res);
   }
 
+  /// Checks if Dijkstra works correctly with the CSR graph
+  TEST(ShortestPathFinderTest, DijkstraCsr)
+  {
+    auto const graph = basic_graph();
+
+    Csr_Weighted_Graph<Graph_type> csr_graph(graph);
+
+    auto res = Shortest_path_finder::dijkstra(csr_graph, 0);
+    auto rev = Shortest_path_finder::dijkstra(csr_graph.reverse(), 6);
+
+    ASSERT_EQ(res.first, std::vector<Node_Id_Type>({0, 2, 0, 1, 3, 2, 5}));
+    ASSERT_EQ(rev.first, std::vector<Node_Id_Type>({2, 3, 5, 4, 5, 6, 6}));
+
+    ASSERT_EQ(res, Shortest_path_finder::dijkstra(Weighted_Graph_type<false>(graph), 0));
+    ASSERT_EQ(rev, Shortest_path_finder::dijkstra(Weighted_Graph_type<true>(graph), 6));
+  }
+
+  /// Checks if Dijkstra works correctly with the pairing heap
+  TEST(ShortestPathFinderTest, DijkstraPairingHeap)
+  {
+    using Queue_Type = Shortest_path_finder::Dijkstra_Pairing_Heap<Time_Type>;
+
+    auto const graph = basic_graph();
+
+    Weighted_Graph_type<false> const weighted_graph(graph);
+
+    auto res = Shortest_path_finder::dijkstra<Weighted_Graph_type<false>, Queue_Type>(weighted_graph, 0);
+    auto rev = Shortest_path_finder::dijkstra<Weighted_Graph_type<true>, Queue_Type>(weighted_graph.reverse(), 6);
+
+    ASSERT_EQ(res, Shortest_path_finder::dijkstra(Weighted_Graph_type<false>(graph), 0));
+    ASSERT_EQ(rev, Shortest_path_finder::dijkstra(Weighted_Graph_type<true>(graph), 6));
+  }
+
+  /// Checks if the priority queues produce the same distances on a random graph with integer weights
+  TEST(ShortestPathFinderTest, DijkstraQueuesIntegerWeights)
+  {
+    using Weighted_Type = Weighted_Graph<Integer_Graph_type,
+                                         false,
+                                         Integer_Graph_type::Node_Type,
+                                         Integer_Graph_type::Node_Collection_Type,
+                                         unsigned long long int>;
+    using Weight_Type   = Weighted_Type::Weight_Type;
+
+    for (auto const &max_weight : {1ull, 10ull, 1000000000ull})
+      {
+        auto const    graph = random_integer_graph(500, 4000, max_weight);
+        Weighted_Type weighted_graph(graph);
+
+        auto const res = Shortest_path_finder::dijkstra(weighted_graph, 0);
+        auto const pairing =
+          Shortest_path_finder::dijkstra<Weighted_Type, Shortest_path_finder::Dijkstra_Pairing_Heap<Weight_Type>>(
+            weighted_graph, 0);
+        auto const radix =
+          Shortest_path_finder::dijkstra<Weighted_Type, Shortest_path_finder::Dijkstra_Radix_Heap<Weight_Type>>(
+            weighted_graph, 0);
+
+        // Both the set and the pairing heap break ties through the node id
+        ASSERT_EQ(res, pairing);
+
+        // The radix heap may choose a different (but equivalent) shortest path tree
+        ASSERT_EQ(res.second, radix.second);
+        for (std::size_t i = 1; i < graph.size(); ++i)
+          {
+            if (radix.second[i] != std::numeric_limits<Weight_Type>::max())
+              {
+                ASSERT_EQ(radix.second[i],
+                          radix.second[radix.first[i]] + graph.get_weight(std::make_pair(radix.first[i], i)));
+              }
+          }
+      }
+  }
+
+  /// Checks if the linear time shortest path tree matches Dijkstra on an acyclic graph
+  TEST(ShortestPathFinderTest, DagShortestPathTree)
+  {
+    auto const graph = eppstein_graph();
+
+    Weighted_Graph_type<false> const weighted_graph(graph);
+    Csr_Weighted_Graph<Graph_type>   csr_graph(graph);
+
+    auto const res = Shortest_path_finder::dag_shortest_path_tree(weighted_graph, 0);
+    auto const rev = Shortest_path_finder::dag_shortest_path_tree(weighted_graph.reverse(), 11);
+
+    ASSERT_EQ(res, Shortest_path_finder::dijkstra(weighted_graph, 0));
+    ASSERT_EQ(rev, Shortest_path_finder::dijkstra(weighted_graph.reverse(), 11));
+
+    ASSERT_EQ(res, Shortest_path_finder::shortest_path_tree(weighted_graph, 0));
+    ASSERT_EQ(rev, Shortest_path_finder::shortest_path_tree(csr_graph.reverse(), 11));
+
+    // Node 4 cannot reach node 1
+    ASSERT_EQ(Shortest_path_finder::dag_shortest_path_tree(weighted_graph, 4).second[1],
+              std::numeric_limits<Time_Type>::max());
+  }
+
+  /// Checks if the shortest path tree falls back to Dijkstra when the graph has a cycle
+  TEST(ShortestPathFinderTest, ShortestPathTreeCyclic)
+  {
+    auto const graph = basic_graph();
+
+    Weighted_Graph_type<false> const weighted_graph(graph);
+
+    ASSERT_THROW(std::ignore = Shortest_path_finder::dag_shortest_path_tree(weighted_graph, 0), std::logic_error);
+
+    ASSERT_EQ(Shortest_path_finder::shortest_path_tree(weighted_graph, 0),
+              Shortest_path_finder::dijkstra(weighted_graph, 0));
+    ASSERT_EQ(Shortest_path_finder::shortest_path_tree(weighted_graph.reverse(), 6),
+              Shortest_path_finder::dijkstra(weighted_graph.reverse(), 6));
+  }
+
+  /// Checks the shortest path tree of a graph declared as topologically sorted (the block graph)
+  TEST(ShortestPathFinderTest, ShortestPathTreeBlockGraph)
+  {
+    static_assert(Topologically_Sorted_Graph<Block_Graph_Type>::value);
+
+    auto const graph = eppstein_graph();
+
+    Block_Graph_Type::Node_Collection_Type nodes(graph.size(), Block_Graph_Type::Node_Type({0, nullptr}));
+    Block_Graph_Type::Neighbours_Type      dependencies;
+
+    for (std::size_t i = 0; i < graph.size(); ++i)
+      {
+        dependencies.emplace_back(graph.get_input_nodes(i), graph.get_output_nodes(i));
+      }
+
+    Block_Graph_Type block_graph(std::move(nodes), std::move(dependencies));
+    for (std::size_t i = 0; i < graph.size(); ++i)
+      {
+        for (auto const &j : graph.get_output_nodes(i))
+          {
+            block_graph.set_weight({i, j}, graph.get_weight({i, j}));
+          }
+      }
+
+    Weighted_Graph<Block_Graph_Type> const weighted_graph(block_graph);
+
+    ASSERT_EQ(Shortest_path_finder::shortest_path_tree(weighted_graph, 0),
+              Shortest_path_finder::dijkstra(weighted_graph, 0));
+    ASSERT_EQ(Shortest_path_finder::shortest_path_tree(weighted_graph.reverse(), 11),
+              Shortest_path_finder::dijkstra(weighted_graph.reverse(), 11));
+    ASSERT_EQ(Shortest_path_finder::shortest_path_tree(weighted_graph.reverse(), 3).second[8],
+              std::numeric_limits<Time_Type>::max());
+  }
+
+  /// Checks that a graph declared as topologically sorted whose node ids are not a topological order is rejected
+  TEST(ShortestPathFinderTest, ShortestPathTreeBlockGraphUnsorted)
+  {
+    Block_Graph_Type::Node_Collection_Type nodes(3, Block_Graph_Type::Node_Type({0, nullptr}));
+    Block_Graph_Type::Neighbours_Type      dependencies;
+
+    // 0 -> 2 -> 1
+    dependencies.emplace_back(Neighbour_Id_Collection_Type{}, Neighbour_Id_Collection_Type{2});
+    dependencies.emplace_back(Neighbour_Id_Collection_Type{2}, Neighbour_Id_Collection_Type{});
+    dependencies.emplace_back(Neighbour_Id_Collection_Type{0}, Neighbour_Id_Collection_Type{1});
+
+    Block_Graph_Type block_graph(std::move(nodes), std::move(dependencies));
+    block_graph.set_weight({0, 2}, 1);
+    block_graph.set_weight({2, 1}, 1);
+
+    Weighted_Graph<Block_Graph_Type> const weighted_graph(block_graph);
+
+    ASSERT_THROW(std::ignore = Shortest_path_finder::shortest_path_tree(weighted_graph, 0), std::logic_error);
+    ASSERT_THROW(std::ignore = Shortest_path_finder::shortest_path_tree(weighted_graph.reverse(), 1), std::logic_error);
+  }
+
   auto
   basic_graph() -> Graph_type
   {
@@ -180,7 +354,11 @@ namespace
 
     for (std::size_t i = 0; i < built_graph.size(); ++i)
       {
-        dependencies[i] = std::make_pair(built_graph.get_input_nodes(i), built_graph.get_output_nodes(i));
+        auto const &inputs  = built_graph.get_input_nodes(i);
+        auto const &outputs = built_graph.get_output_nodes(i);
+
+        dependencies[i] = std::make_pair(std::set<std::size_t>(inputs.cbegin(), inputs.cend()),
+                                         std::set<std::size_t>(outputs.cbegin(), outputs.cend()));
       }
 
     weights.emplace(std::make_pair(0, 1), 2);
@@ -204,4 +382,34 @@ namespace
 
     return res;
   }
+
+  auto
+  random_integer_graph(std::size_t num_nodes, std::size_t num_edges, unsigned long long int max_weight)
+    -> Integer_Graph_type
+  {
+    std::default_random_engine                           random_engine{42};
+    std::uniform_int_distribution<Node_Id_Type>           node_generator(0, num_nodes - 1);
+    std::uniform_int_distribution<unsigned long long int> weight_generator(0, max_weight);
+
+    Integer_Graph_type::Neighbours_Type dependencies(num_nodes);
+    for (std::size_t i = 0; i < num_edges; ++i)
+      {
+        auto const tail = node_generator(random_engine);
+        auto const head = node_generator(random_engine);
+
+        dependencies[tail].second.insert(head);
+        dependencies[head].first.insert(tail);
+      }
+
+    Integer_Graph_type graph(std::vector<types::Node>(num_nodes), std::move(dependencies));
+    for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+      {
+        for (auto const &head : graph.get_output_nodes(tail))
+          {
+            graph.set_weight(std::make_pair(tail, head), weight_generator(random_engine));
+          }
+      }
+
+    return graph;
+  }
 } // namespace
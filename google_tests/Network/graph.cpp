@@ -1,6 +1,8 @@
 #include <network_butcher/Network/graph.h>
+#include <network_butcher/Network/wgraph.h>
 #include "../test_class.h"
 #include <gtest/gtest.h>
+#include <tuple>
 
 // Quick tests to verify that no crash happens due to the graph construction (if everything works properly)
 
@@ -42,4 +44,151 @@ namespace
     Graph_type graph(nodes);
   }
 
+  // Checks that the names of the IO collections are interned once and that the collections are keyed by their ids
+  TEST(GraphTests, InternedIoCollections)
+  {
+    auto &symbols = Symbol_Table::global();
+
+    auto const x_id = symbols.intern("GraphTests_X");
+    EXPECT_EQ(symbols.intern("GraphTests_X"), x_id);
+    EXPECT_EQ(symbols.get_name(x_id), "GraphTests_X");
+    EXPECT_FALSE(symbols.find("GraphTests_missing").has_value());
+    EXPECT_THROW(std::ignore = symbols.get_name(static_cast<Symbol_Id_Type>(symbols.size())), std::out_of_range);
+
+    IO_collection collection{{"GraphTests_Y", 1}, {"GraphTests_X", 2}, {"GraphTests_Y", 3}};
+    EXPECT_EQ(collection.size(), 2);
+    EXPECT_FALSE(collection.emplace("GraphTests_X", 4).second);
+    EXPECT_EQ(collection.find(x_id)->second.data.size(), 2);
+    EXPECT_EQ(collection.find("GraphTests_Y")->second.data.size(), 1);
+    EXPECT_FALSE(collection.contains("GraphTests_missing"));
+    EXPECT_TRUE(std::is_sorted(collection.begin(), collection.end(), [](auto const &lhs, auto const &rhs) {
+      return lhs.first < rhs.first;
+    }));
+
+    std::vector<Node_type> nodes;
+    nodes.emplace_back(std::move(Content_Builder<Input>().set_output({{"GraphTests_X", 0}})).build());
+    nodes.emplace_back(std::move(Content_Builder<Input>().set_input({{"GraphTests_X", 0}})).build());
+
+    Graph_type const graph(nodes);
+    EXPECT_TRUE(graph.check_edge({0, 1}));
+    EXPECT_FALSE(graph.check_edge({1, 0}));
+  }
+
+  // Checks that the neighbours are stored sorted and without duplicates, whatever the insertion order
+  TEST(GraphTests, FlatNeighbours)
+  {
+    Neighbour_Id_Collection_Type neighbours{4, 1, 3, 1};
+    EXPECT_EQ(std::vector<Node_Id_Type>(neighbours.begin(), neighbours.end()), (std::vector<Node_Id_Type>{1, 3, 4}));
+
+    EXPECT_FALSE(neighbours.insert(3).second);
+    EXPECT_EQ(*neighbours.insert(neighbours.end(), 7), 7);
+    EXPECT_EQ(*neighbours.insert(neighbours.end(), 2), 2); // Wrong hint
+    EXPECT_EQ(neighbours.erase(3), 1);
+    EXPECT_EQ(neighbours.erase(5), 0);
+    EXPECT_EQ(std::vector<Node_Id_Type>(neighbours.begin(), neighbours.end()),
+              (std::vector<Node_Id_Type>{1, 2, 4, 7}));
+    EXPECT_EQ(*neighbours.crbegin(), 7);
+    EXPECT_TRUE(neighbours.contains(4));
+    EXPECT_FALSE(neighbours.contains(3));
+
+    Graph<CNode<Input>>::Neighbours_Type deps(3);
+    deps[0].second.insert({2, 1});
+    deps[1].first.insert(0);
+    deps[1].second.insert(2);
+    deps[2].first.insert({1, 0});
+
+    Graph<CNode<Input>> const graph(std::vector<CNode<Input>>(3), std::move(deps));
+    EXPECT_TRUE(graph.check_edge({0, 1}));
+    EXPECT_TRUE(graph.check_edge({0, 2}));
+    EXPECT_FALSE(graph.check_edge({1, 0}));
+    EXPECT_EQ(graph.get_input_nodes(2), (Neighbour_Id_Collection_Type{0, 1}));
+  }
+
+  // Checks that the weight views refer to the stored weights, sorted in ascending order
+  TEST(GraphTests, WeightViews)
+  {
+    using Parallel_Graph_type = WGraph<true, Node, Time_Type>;
+
+    Parallel_Graph_type::Neighbours_Type deps(3);
+    deps[0].second = {1, 2};
+    deps[1].first  = {0};
+    deps[1].second = {2};
+    deps[2].first  = {0, 1};
+
+    Parallel_Graph_type graph(std::vector<Node>(3), deps);
+    graph.set_weight({0, 1}, 3.);
+    graph.set_weight({0, 1}, 1.);
+    graph.set_weight({0, 1}, std::multiset<Time_Type>{4, 2});
+    graph.set_weight({1, 2}, 5.);
+
+    auto const view = graph.get_weights({0, 1});
+    EXPECT_EQ(std::vector<Time_Type>(view.begin(), view.end()), (std::vector<Time_Type>{1, 2, 3, 4}));
+    EXPECT_EQ(graph.get_weight({0, 1}), (std::multiset<Time_Type>{1, 2, 3, 4}));
+    EXPECT_EQ(graph.min_weight({0, 1}), 1.);
+    EXPECT_EQ(graph.min_weight({1, 2}), 5.);
+    EXPECT_THROW(std::ignore = graph.min_weight({0, 2}), std::runtime_error);
+
+    kfinder::Weighted_Graph<Parallel_Graph_type> const weighted_graph(graph);
+    EXPECT_EQ(weighted_graph.min_weight({0, 1}), 1.);
+    EXPECT_EQ(weighted_graph.reverse().min_weight({2, 1}), 5.);
+    EXPECT_EQ(&*weighted_graph.get_weight({1, 2}).begin(), &*graph.get_weights({1, 2}).begin());
+
+    MWGraph<false, Node, Time_Type> multi_graph(2, std::vector<Node>(3), deps);
+    multi_graph.set_weight(1, {0, 2}, 7.);
+    EXPECT_EQ(multi_graph.get_weights(1, {0, 2}).size(), 1);
+    EXPECT_EQ(multi_graph.min_weight(1, {0, 2}), 7.);
+    EXPECT_THROW(std::ignore = multi_graph.get_weights(0, {0, 2}), std::runtime_error);
+  }
+
+  // Checks that the weights are stored densely, addressed by the edge ids, and that they can be set concurrently
+  TEST(GraphTests, EdgeIndexedWeights)
+  {
+    std::size_t const num_nodes = 1000;
+
+    MWGraph<false, Node, Time_Type>::Neighbours_Type deps(num_nodes);
+    for (Node_Id_Type tail = 0; tail + 2 < num_nodes; ++tail)
+      {
+        for (auto const head : {tail + 1, tail + 2})
+          {
+            deps[tail].second.insert(head);
+            deps[head].first.insert(tail);
+          }
+      }
+
+    MWGraph<false, Node, Time_Type> graph(2, std::vector<Node>(num_nodes), deps);
+    ASSERT_EQ(graph.get_num_edges(), 2 * (num_nodes - 2));
+    EXPECT_EQ(graph.get_edge_id({0, 1}), 0);
+    EXPECT_EQ(graph.get_edge_id({0, 2}), 1);
+    EXPECT_EQ(graph.get_edge_id({1, 2}), 2);
+    EXPECT_THROW(std::ignore = graph.get_edge_id({2, 1}), std::runtime_error);
+
+    std::vector<Node_Id_Type> tails(num_nodes - 2);
+    std::iota(tails.begin(), tails.end(), 0);
+
+    auto const set_weights = [&graph](Node_Id_Type tail) {
+      for (auto const &head : graph.get_output_nodes(tail))
+        graph.set_weight(1, {tail, head}, static_cast<Time_Type>(tail + head));
+    };
+
+#if NETWORK_BUTCHER_PARALLEL_TBB
+    std::for_each(std::execution::par, tails.cbegin(), tails.cend(), set_weights);
+#else
+#  pragma omp parallel for default(none) shared(tails, set_weights)
+    for (std::size_t i = 0; i < tails.size(); ++i)
+      set_weights(tails[i]);
+#endif
+
+    auto const device_weights = graph.get_device_weights(1);
+    ASSERT_EQ(device_weights.size(), graph.get_num_edges());
+    for (Node_Id_Type tail = 0; tail + 2 < num_nodes; ++tail)
+      {
+        for (auto const head : {tail + 1, tail + 2})
+          {
+            ASSERT_TRUE(graph.check_weight(1, {tail, head}));
+            ASSERT_FALSE(graph.check_weight(0, {tail, head}));
+            ASSERT_EQ(device_weights[graph.get_edge_id({tail, head})], static_cast<Time_Type>(tail + head));
+          }
+      }
+  }
+
 } // namespace
\ No newline at end of file
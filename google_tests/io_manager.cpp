@@ -1,5 +1,7 @@
 #include <network_butcher/io_manager.h>
 #include <gtest/gtest.h>
+#include <cstring>
+#include <fstream>
 
 /// Checks if the various IO functions work properly.
 
@@ -21,8 +23,11 @@ namespace
 
     ASSERT_EQ(params.ksp_params.K, 12);
     ASSERT_EQ(params.ksp_params.method, parameters::KSP_Method::Lazy_Eppstein);
+    ASSERT_FALSE(params.ksp_params.max_relative_gap.has_value());
     ASSERT_EQ(params.block_graph_generation_params.starting_device_id, 0);
     ASSERT_EQ(params.block_graph_generation_params.ending_device_id, 0);
+    ASSERT_TRUE(params.block_graph_generation_params.starting_device_ids.empty());
+    ASSERT_TRUE(params.block_graph_generation_params.ending_device_ids.empty());
 
     ASSERT_EQ(params.block_graph_generation_params.memory_constraint, true);
     ASSERT_EQ(params.devices.size(), 2);
@@ -167,5 +172,167 @@ namespace
     Utilities::file_delete(exported_model);
   }
 
+  TEST(IOManagerTest, ImportOnnxSnapshot)
+  {
+    auto const snapshot_directory = Utilities::combine_path(base_path, "snapshots");
+
+    if (Utilities::directory_exists(snapshot_directory))
+      Utilities::directory_delete(snapshot_directory);
+
+    auto const [graph, model, map] = io::IO_Manager::import_from_onnx(graph_path, true, true, 2);
+
+    // The first import stores the snapshot, the second one reads it
+    auto const stored = io::IO_Manager::import_from_onnx_snapshot(graph_path, snapshot_directory, true, true, 2);
+
+    auto const model_hash    = io::Graph_Snapshot::compute_file_hash(graph_path);
+    auto const snapshot_path = io::Graph_Snapshot::get_snapshot_path(snapshot_directory, model_hash, true, true);
+    ASSERT_TRUE(Utilities::file_exists(snapshot_path));
+
+    auto const [snapshot_graph, snapshot_map] =
+      io::IO_Manager::import_from_onnx_snapshot(graph_path, snapshot_directory, true, true, 2);
+
+    ASSERT_EQ(snapshot_graph.size(), graph.size());
+    EXPECT_EQ(snapshot_graph.get_num_devices(), 2);
+    EXPECT_EQ(snapshot_map, map);
+    EXPECT_EQ(stored.link_id_nodeproto, map);
+
+    auto const same_collection = [](auto const &lhs, auto const &rhs) {
+      return std::ranges::equal(lhs, rhs, [](auto const &l, auto const &r) {
+        return l.first == r.first && l.second->get_name() == r.second->get_name() &&
+               l.second->get_shape() == r.second->get_shape() &&
+               l.second->compute_memory_usage() == r.second->compute_memory_usage() &&
+               l.second->is_initialized() == r.second->is_initialized();
+      });
+    };
+
+    for (Node_Id_Type id = 0; id < graph.size(); ++id)
+      {
+        auto const &node          = graph[id];
+        auto const &snapshot_node = snapshot_graph[id];
+
+        EXPECT_EQ(snapshot_node.name, node.name);
+        EXPECT_EQ(snapshot_node.content.get_operation_id(), node.content.get_operation_id());
+        EXPECT_EQ(snapshot_node.content.get_attributes(), node.content.get_attributes());
+        EXPECT_TRUE(same_collection(snapshot_node.content.get_input(), node.content.get_input()));
+        EXPECT_TRUE(same_collection(snapshot_node.content.get_output(), node.content.get_output()));
+        EXPECT_TRUE(same_collection(snapshot_node.content.get_parameters(), node.content.get_parameters()));
+        EXPECT_EQ(snapshot_graph.get_input_nodes(id), graph.get_input_nodes(id));
+        EXPECT_EQ(snapshot_graph.get_output_nodes(id), graph.get_output_nodes(id));
+      }
+
+    // A snapshot of a different model (or taken with different options) is ignored
+    EXPECT_FALSE(io::Graph_Snapshot::import_snapshot(snapshot_path, model_hash + 1, true, true, 2).has_value());
+    EXPECT_FALSE(io::Graph_Snapshot::import_snapshot(snapshot_path, model_hash, false, true, 2).has_value());
+
+    // A truncated snapshot is ignored
+    std::filesystem::resize_file(snapshot_path, std::filesystem::file_size(snapshot_path) / 2);
+    EXPECT_FALSE(io::Graph_Snapshot::import_snapshot(snapshot_path, model_hash, true, true, 2).has_value());
+
+    Utilities::directory_delete(snapshot_directory);
+  }
+
+  TEST(IOManagerTest, ImportOnnxCorruptedSnapshot)
+  {
+    auto const snapshot_directory = Utilities::combine_path(base_path, "corrupted_snapshots");
+
+    if (Utilities::directory_exists(snapshot_directory))
+      Utilities::directory_delete(snapshot_directory);
+
+    auto const [graph, map] = io::IO_Manager::import_from_onnx_snapshot(graph_path, snapshot_directory, true, true, 2);
+
+    auto const model_hash    = io::Graph_Snapshot::compute_file_hash(graph_path);
+    auto const snapshot_path = io::Graph_Snapshot::get_snapshot_path(snapshot_directory, model_hash, true, true);
+
+    std::string original;
+    {
+      std::ifstream file(snapshot_path, std::ios::binary);
+      original.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    auto const write_snapshot = [&snapshot_path](std::string const &content) {
+      std::ofstream(snapshot_path, std::ios::binary | std::ios::trunc) << content;
+    };
+
+    // The table of the interned names starts with the first name of the first node
+    auto const &content    = graph.get_nodes().front().content;
+    auto const &collection = content.get_input().empty() ? content.get_output() : content.get_input();
+    ASSERT_FALSE(collection.empty());
+
+    auto const &first_name = types::Symbol_Table::global().get_name(collection.begin()->first);
+
+    std::string entry(sizeof(std::uint64_t), '\0');
+    std::uint64_t const name_size = first_name.size();
+    std::memcpy(entry.data(), &name_size, sizeof(name_size));
+    entry += first_name;
+
+    auto const name_position = original.find(entry);
+    ASSERT_NE(name_position, std::string::npos);
+    ASSERT_GE(name_position, sizeof(std::uint64_t));
+
+    // A count larger than the snapshot is ignored (and nothing is allocated)
+    auto corrupted = original;
+    std::uint64_t const huge_count = std::uint64_t{1} << 60;
+    std::memcpy(corrupted.data() + name_position - sizeof(std::uint64_t), &huge_count, sizeof(huge_count));
+
+    write_snapshot(corrupted);
+    EXPECT_FALSE(io::Graph_Snapshot::import_snapshot(snapshot_path, model_hash, true, true, 2).has_value());
+
+    // The names of a snapshot that turns out to be invalid are not interned
+    std::string const fresh_name(first_name.size(), '#');
+    ASSERT_FALSE(types::Symbol_Table::global().find(fresh_name).has_value());
+
+    corrupted = original;
+    corrupted.replace(name_position + sizeof(std::uint64_t), fresh_name.size(), fresh_name);
+    corrupted.resize(corrupted.size() - sizeof(std::uint64_t));
+
+    write_snapshot(corrupted);
+    EXPECT_FALSE(io::Graph_Snapshot::import_snapshot(snapshot_path, model_hash, true, true, 2).has_value());
+    EXPECT_FALSE(types::Symbol_Table::global().find(fresh_name).has_value());
+
+    // The original snapshot is still valid
+    write_snapshot(original);
+    EXPECT_TRUE(io::Graph_Snapshot::import_snapshot(snapshot_path, model_hash, true, true, 2).has_value());
+
+    Utilities::directory_delete(snapshot_directory);
+  }
+
+  TEST(IOManagerTest, ImportOnnxUnwritableSnapshot)
+  {
+    auto const [graph, model, map] = io::IO_Manager::import_from_onnx(graph_path, true, true, 2);
+
+    auto const check_import = [&graph, &map](std::string const &snapshot_directory) {
+      auto const [imported_graph, imported_map] =
+        io::IO_Manager::import_from_onnx_snapshot(graph_path, snapshot_directory, true, true, 2);
+
+      ASSERT_EQ(imported_graph.size(), graph.size());
+      EXPECT_EQ(imported_graph.get_num_devices(), 2);
+      EXPECT_EQ(imported_map, map);
+    };
+
+    // The snapshot directory cannot be created (its parent is a file): the model is imported anyway
+    auto const unreachable_directory = Utilities::combine_path(graph_path, "snapshots");
+    ASSERT_NO_FATAL_FAILURE(check_import(unreachable_directory));
+    EXPECT_FALSE(Utilities::directory_exists(unreachable_directory));
+
+    // The snapshot cannot replace a (non-empty) directory with the same path: the model is imported anyway and no
+    // temporary file is left behind
+    auto const snapshot_directory = Utilities::combine_path(base_path, "unwritable_snapshots");
+
+    if (Utilities::directory_exists(snapshot_directory))
+      Utilities::directory_delete(snapshot_directory);
+
+    auto const model_hash    = io::Graph_Snapshot::compute_file_hash(graph_path);
+    auto const snapshot_path = io::Graph_Snapshot::get_snapshot_path(snapshot_directory, model_hash, true, true);
+
+    std::filesystem::create_directories(snapshot_path);
+    std::ofstream(Utilities::combine_path(snapshot_path, "placeholder")) << "placeholder";
+
+    ASSERT_NO_FATAL_FAILURE(check_import(snapshot_directory));
+    EXPECT_TRUE(std::filesystem::is_directory(snapshot_path));
+    EXPECT_FALSE(Utilities::file_exists(snapshot_path + ".tmp"));
+
+    Utilities::directory_delete(snapshot_directory);
+  }
+
 
 } // namespace
\ No newline at end of file
@@ -39,7 +39,7 @@ class network_butcher::kfinder::Weighted_Graph<Test_Graph<T>,
                                                t_Reversed,
                                                typename Test_Graph<T>::Node_Type,
                                                typename Test_Graph<T>::Node_Collection_Type,
-                                               long double> : Base_Weighted_Graph
+                                               network_butcher::Time_Type> : Base_Weighted_Graph
 {
 public:
   using Node_Id_Type = std::size_t;
@@ -58,11 +58,11 @@ public:
   {
     if constexpr (t_Reversed)
       {
-        return {graph.map_weight.find(std::make_pair(edge.second, edge.first))->second};
+        return {static_cast<Weight_Type>(graph.map_weight.find(std::make_pair(edge.second, edge.first))->second)};
       }
     else
       {
-        return {graph.map_weight.find(edge)->second};
+        return {static_cast<Weight_Type>(graph.map_weight.find(edge)->second)};
       }
   };
 
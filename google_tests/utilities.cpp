@@ -52,4 +52,19 @@ namespace
     ASSERT_EQ(Utilities::custom_to_string(std::make_tuple(501, 502)), "");
   }
 
+  TEST(UtilitiesTest, TimeTypeConversion)
+  {
+    EXPECT_EQ(to_seconds(to_time_type(0.25)), 0.25);
+    EXPECT_EQ(to_seconds(to_time_type(0.)), 0.);
+    EXPECT_LT(to_time_type(0.1), to_time_type(0.2));
+
+#if NETWORK_BUTCHER_FIXED_POINT_WEIGHTS
+    // The saturated weights leave room for their sums and for the maximum weight (used for the unreachable nodes)
+    auto const infinite = to_time_type(std::numeric_limits<Seconds_Type>::infinity());
+    EXPECT_EQ(infinite, max_time_weight);
+    EXPECT_EQ(to_time_type(-std::numeric_limits<Seconds_Type>::infinity()), -max_time_weight);
+    EXPECT_LT(infinite + infinite, std::numeric_limits<Time_Type>::max());
+#endif
+  }
+
 } // namespace
\ No newline at end of file
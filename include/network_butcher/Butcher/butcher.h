@@ -2,14 +2,18 @@
 #define NETWORK_BUTCHER_BUTCHER_H
 
 #include <algorithm>
+#include <deque>
 #include <forward_list>
 #include <memory>
+#include <numeric>
 
 #include <network_butcher/Butcher/constrained_block_graph_builder.h>
 #include <network_butcher/Butcher/path_converter.h>
 #include <network_butcher/Computer/computer_memory.h>
 #include <network_butcher/IO_Interaction/weight_importers.h>
+#include <network_butcher/K-shortest_path/csr_weighted_graph.h>
 #include <network_butcher/K-shortest_path/kfinder_factory.h>
+#include <network_butcher/K-shortest_path/scenario_weighted_graph.h>
 #include <network_butcher/Network/graph_traits.h>
 #include <network_butcher/Types/parameters.h>
 #include <network_butcher/Types/paths.h>
@@ -33,16 +37,50 @@ namespace network_butcher
     /// The graph to be partitioned
     network graph;
 
+    /// The columnar store of the nodes of the graph (with their memory usages). It's built once and shared by the
+    /// memory constraints of the block graphs
+    std::shared_ptr<types::Node_Columns const> node_columns;
+
+    /// It constructs the block graph (with its weights and constraints)
+    /// \param transmission_weights The transmission weights
+    /// \param params The program parameters
+    /// \param block_graph_generation_params The block graph generation parameters (they override the ones in params)
+    /// \param extra_constraints A collection of "extra" constraints that are applied to the block graph
+    /// \return The block graph
+    [[nodiscard]] auto
+    build_block_graph(
+      std::function<Time_Type(Edge_Type const &, std::size_t, std::size_t)> const &transmission_weights,
+      network_butcher::parameters::Parameters const                               &params,
+      network_butcher::parameters::Parameters::Block_Graph_Generation const       &block_graph_generation_params,
+      std::vector<std::unique_ptr<constraints::Graph_Constraint>> const           &extra_constraints) const
+      -> new_network;
+
+    /// It joins the block graphs built for different starting and ending devices in a single graph. The first node
+    /// is a virtual super source, connected (with null weights) to the first node of every starting graph; the last
+    /// node is a virtual super sink, connected to the last node of every ending graph. The other nodes don't depend on
+    /// the starting and the ending device, thus they're taken (once) from the first starting graph. The node ids are
+    /// still a topological order. The block graphs must have at least three nodes (it throws otherwise)
+    /// \param starting_graphs The block graphs built for the different starting devices
+    /// \param ending_graphs The block graphs built for the different ending devices
+    /// \return The joined graph
+    [[nodiscard]] static auto
+    join_terminals(std::vector<new_network const *> const &starting_graphs,
+                   std::vector<new_network const *> const &ending_graphs) -> new_network;
+
   public:
     /// Constructor
     /// \param g The input graph. It will be moved (if possible)
     explicit Butcher(network &&g)
-      : graph(std::move(g)){};
+      : graph(std::move(g))
+      , node_columns(
+          std::make_shared<types::Node_Columns const>(computer::Computer_memory::compute_node_columns(graph))){};
 
     /// Constructor
     /// \param g The input graph
     explicit Butcher(network const &g)
-      : graph(g){};
+      : graph(g)
+      , node_columns(
+          std::make_shared<types::Node_Columns const>(computer::Computer_memory::compute_node_columns(graph))){};
 
     /// Deleted copy  assignment operators (graphs may be big!)
     Butcher
@@ -68,7 +106,8 @@ namespace network_butcher
     }
 
 
-    /// Basic getter (though simple reference) for graph
+    /// Basic getter (though simple reference) for graph. Notice that the columnar store of the nodes is built by the
+    /// constructor: the tensors of the nodes shouldn't be changed through this reference
     /// \return Reference to the graph
     auto
     get_graph_ref() -> network &
@@ -77,6 +116,15 @@ namespace network_butcher
     }
 
 
+    /// Basic getter for the columnar store of the nodes of the graph
+    /// \return The columnar store of the nodes (shared pointer)
+    auto
+    get_node_columns() const -> std::shared_ptr<types::Node_Columns const> const &
+    {
+      return node_columns;
+    }
+
+
     /// This function performs the construction and the butchering of the block graph
     /// \param transmission_weights The transmission weights (i.e. the weight associated to the information transfer
     /// between two different devices)
@@ -91,21 +139,60 @@ namespace network_butcher
       network_butcher::parameters::Parameters const                               &params,
       std::vector<std::unique_ptr<constraints::Graph_Constraint>> const           &extra_constraints = {}) const
       -> std::vector<network_butcher::types::Weighted_Real_Path>;
+
+    /// It finds the best partitionings over the candidate starting and ending devices (starting_device_ids and
+    /// ending_device_ids in the block graph generation parameters) with a single search: the block graphs of the
+    /// different devices are joined through a virtual super source and a virtual super sink, thus the K best
+    /// partitionings are found by a single K shortest path search. The best partitioning of every connected
+    /// (starting, ending) pair is found through a shortest path tree (in topological order) for every starting device
+    /// \param transmission_weights The transmission weights (i.e. the weight associated to the information transfer
+    /// between two different devices)
+    /// \param params The program parameters
+    /// \param extra_constraints A collection of "extra" constraints that can be applied to the block graph after its
+    /// construction
+    /// \return The K best partitionings overall and the best partitioning for every (starting, ending) pair
+    auto
+    compute_k_shortest_path_multi_terminal(
+      std::function<Time_Type(Edge_Type const &, std::size_t, std::size_t)> const &transmission_weights,
+      network_butcher::parameters::Parameters const                               &params,
+      std::vector<std::unique_ptr<constraints::Graph_Constraint>> const           &extra_constraints = {}) const
+      -> network_butcher::types::Multi_Terminal_Real_Paths;
+
+    /// It finds the best partitionings for several transmission scenarios (e.g., different bandwidths) at once. The
+    /// block graph (and its operation weights) is built once, since its topology doesn't depend on the transmission
+    /// weights; the weights of the different scenarios are stored side by side on the shared topology and the K
+    /// shortest paths of the different scenarios are computed concurrently
+    /// \param transmission_weights The transmission weights of every scenario
+    /// \param params The program parameters
+    /// \param extra_constraints A collection of "extra" constraints that can be applied to the block graph after its
+    /// construction
+    /// \return The optimal partitions of every scenario (in the same order of transmission_weights)
+    auto
+    compute_k_shortest_paths_batch(
+      std::vector<std::function<Time_Type(Edge_Type const &, std::size_t, std::size_t)>> const &transmission_weights,
+      network_butcher::parameters::Parameters const                                            &params,
+      std::vector<std::unique_ptr<constraints::Graph_Constraint>> const &extra_constraints = {}) const
+      -> std::vector<std::vector<network_butcher::types::Weighted_Real_Path>>;
   };
 
 
   template <class GraphType>
   auto
-  Butcher<GraphType>::compute_k_shortest_path(
+  Butcher<GraphType>::build_block_graph(
     const std::function<Time_Type(const Edge_Type &, std::size_t, std::size_t)> &transmission_weights,
     const network_butcher::parameters::Parameters                               &params,
+    const network_butcher::parameters::Parameters::Block_Graph_Generation       &block_graph_generation_params,
     std::vector<std::unique_ptr<constraints::Graph_Constraint>> const           &extra_constraints) const
-    -> std::vector<network_butcher::types::Weighted_Real_Path>
+    -> new_network
   {
-    using namespace network_butcher::kfinder;
-
     // Prepare the builder for the block graph construction
-    Constrained_Block_Graph_Builder builder(graph, params, constraints::generate_constraint_function(params, graph));
+    Constrained_Block_Graph_Builder builder(graph,
+                                            block_graph_generation_params,
+                                            params.aMLLibrary_params,
+                                            params.weights_params,
+                                            params.model_params,
+                                            params.devices,
+                                            constraints::generate_constraint_function(params, graph, node_columns));
 
     // Assemble the weights in the block graph
     builder.construct_weights(transmission_weights);
@@ -117,21 +204,395 @@ namespace network_butcher
       }
 
     // The actual block graph construction is performed during this step
-    auto const new_graph = builder.construct_block_graph();
+    return builder.construct_block_graph();
+  }
+
+
+  template <class GraphType>
+  auto
+  Butcher<GraphType>::compute_k_shortest_path(
+    const std::function<Time_Type(const Edge_Type &, std::size_t, std::size_t)> &transmission_weights,
+    const network_butcher::parameters::Parameters                               &params,
+    std::vector<std::unique_ptr<constraints::Graph_Constraint>> const           &extra_constraints) const
+    -> std::vector<network_butcher::types::Weighted_Real_Path>
+  {
+    using namespace network_butcher::kfinder;
+
+    // Construct the block graph
+    auto const new_graph =
+      build_block_graph(transmission_weights, params, params.block_graph_generation_params, extra_constraints);
 
-    // Prepare the K-shortest path algorithm
-    auto kFinder = KFinder_Factory<new_network>::Instance().create(params.ksp_params.method,
-                                                                   new_graph,
-                                                                   new_graph.get_nodes().front().get_id(),
-                                                                   new_graph.get_nodes().back().get_id());
+    auto const root = new_graph.get_nodes().front().get_id();
+    auto const sink = new_graph.get_nodes().back().get_id();
 
-    // Find the shortest paths
-    auto const res = kFinder->compute(params.ksp_params.K);
+    // Prepare the K-shortest path algorithm. The block graph is frozen in the CSR format, since it will not be edited
+    // anymore
+    auto const kFinder = KFinder_Factory<new_network, false, Csr_Weighted_Graph<new_network>>::Instance().create(
+      params.ksp_params.method, new_graph, root, sink);
+
+    // The paths too far from the optimum are not required
+    typename std::decay_t<decltype(*kFinder)>::Length_Bound_Type bound;
+    bound.max_relative_gap = params.ksp_params.max_relative_gap;
+
+    // Find the shortest paths. They share the shortest path tree: the explicit paths are never constructed
+    auto const res = kFinder->compute_path_trie(params.ksp_params.K, bound);
 
     // Convert the result from the block graph to the original graph
     network_butcher::Utilities::Path_Converter converter(new_graph);
     return converter.convert_to_weighted_real_path(res);
   }
 
+
+  template <class GraphType>
+  auto
+  Butcher<GraphType>::join_terminals(std::vector<new_network const *> const &starting_graphs,
+                                     std::vector<new_network const *> const &ending_graphs) -> new_network
+  {
+    auto const &inner        = *starting_graphs.front();
+    auto const  num_nodes    = inner.size();
+
+    // The first and the last node must be distinct from the inner ones
+    if (num_nodes < 3)
+      {
+        throw std::invalid_argument("Butcher: the block graphs to join must have at least three nodes");
+      }
+
+    auto const  num_starting = starting_graphs.size();
+    auto const  num_ending   = ending_graphs.size();
+
+    // The first node of the i-th starting graph becomes the node 1 + i, the inner nodes are shifted by num_starting
+    // and the last node of the j-th ending graph follows them
+    auto const inner_id  = [num_starting](Node_Id_Type id) { return id + num_starting; };
+    auto const ending_id = [num_starting, num_nodes](std::size_t j) { return num_nodes - 1 + num_starting + j; };
+    auto const sink      = num_nodes + num_starting + num_ending - 1;
+
+    new_network::Node_Collection_Type nodes;
+    new_network::Neighbours_Type      dependencies(sink + 1);
+    nodes.reserve(sink + 1);
+
+    // The super source and the super sink don't contain any node of the original graph
+    nodes.emplace_back(
+      new_network::Node_Type::Content_Type{inner.get_nodes().front().content.first,
+                                           std::make_shared<Node_Id_Collection_Type>()});
+
+    for (std::size_t i = 0; i < num_starting; ++i)
+      {
+        auto const &block_graph = *starting_graphs[i];
+        nodes.push_back(block_graph.get_nodes().front());
+
+        dependencies[0].second.insert(1 + i);
+        dependencies[1 + i].first.insert(0);
+
+        for (auto const &head : block_graph.get_output_nodes(0))
+          {
+            dependencies[1 + i].second.insert(inner_id(head));
+            dependencies[inner_id(head)].first.insert(1 + i);
+          }
+      }
+
+    for (Node_Id_Type tail = 1; tail + 1 < num_nodes; ++tail)
+      {
+        nodes.push_back(inner.get_nodes()[tail]);
+
+        for (auto const &head : inner.get_output_nodes(tail))
+          {
+            if (head + 1 < num_nodes)
+              {
+                dependencies[inner_id(tail)].second.insert(inner_id(head));
+                dependencies[inner_id(head)].first.insert(inner_id(tail));
+              }
+          }
+      }
+
+    for (std::size_t j = 0; j < num_ending; ++j)
+      {
+        auto const &block_graph = *ending_graphs[j];
+        nodes.push_back(block_graph.get_nodes().back());
+
+        for (auto const &tail : block_graph.get_input_nodes(num_nodes - 1))
+          {
+            dependencies[inner_id(tail)].second.insert(ending_id(j));
+            dependencies[ending_id(j)].first.insert(inner_id(tail));
+          }
+
+        dependencies[ending_id(j)].second.insert(sink);
+        dependencies[sink].first.insert(ending_id(j));
+      }
+
+    nodes.emplace_back(
+      new_network::Node_Type::Content_Type{inner.get_nodes().back().content.first,
+                                           std::make_shared<Node_Id_Collection_Type>()});
+
+    new_network res(std::move(nodes), std::move(dependencies));
+
+    // Copy the weights
+    for (std::size_t i = 0; i < num_starting; ++i)
+      {
+        res.set_weight(std::make_pair(0, 1 + i), Time_Type{0});
+
+        for (auto const &head : starting_graphs[i]->get_output_nodes(0))
+          res.set_weight(std::make_pair(1 + i, inner_id(head)),
+                         starting_graphs[i]->get_weight(std::make_pair(0, head)));
+      }
+
+    for (Node_Id_Type tail = 1; tail + 1 < num_nodes; ++tail)
+      {
+        for (auto const &head : inner.get_output_nodes(tail))
+          {
+            if (head + 1 < num_nodes)
+              res.set_weight(std::make_pair(inner_id(tail), inner_id(head)),
+                             inner.get_weight(std::make_pair(tail, head)));
+          }
+      }
+
+    for (std::size_t j = 0; j < num_ending; ++j)
+      {
+        for (auto const &tail : ending_graphs[j]->get_input_nodes(num_nodes - 1))
+          res.set_weight(std::make_pair(inner_id(tail), ending_id(j)),
+                         ending_graphs[j]->get_weight(std::make_pair(tail, num_nodes - 1)));
+
+        res.set_weight(std::make_pair(ending_id(j), sink), Time_Type{0});
+      }
+
+    return res;
+  }
+
+
+  template <class GraphType>
+  auto
+  Butcher<GraphType>::compute_k_shortest_path_multi_terminal(
+    const std::function<Time_Type(const Edge_Type &, std::size_t, std::size_t)> &transmission_weights,
+    const network_butcher::parameters::Parameters                               &params,
+    std::vector<std::unique_ptr<constraints::Graph_Constraint>> const           &extra_constraints) const
+    -> network_butcher::types::Multi_Terminal_Real_Paths
+  {
+    using namespace network_butcher::kfinder;
+    using Path_Info = Templated_Path_Info<Time_Type>;
+
+    // The candidate devices (without duplicates)
+    auto const get_devices = [](std::vector<std::size_t> devices, std::size_t default_device) {
+      if (devices.empty())
+        return std::vector<std::size_t>{default_device};
+
+      std::sort(devices.begin(), devices.end());
+      devices.erase(std::unique(devices.begin(), devices.end()), devices.end());
+
+      return devices;
+    };
+
+    auto const &block_params     = params.block_graph_generation_params;
+    auto const  starting_devices = get_devices(block_params.starting_device_ids, block_params.starting_device_id);
+    auto const  ending_devices   = get_devices(block_params.ending_device_ids, block_params.ending_device_id);
+
+    // Only the edges from the first node and to the last node depend on the starting and the ending device: the block
+    // graph is built for every device, but the graphs are joined and searched once
+    std::deque<new_network>          block_graphs;
+    std::vector<new_network const *> starting_graphs;
+    std::vector<new_network const *> ending_graphs;
+
+    auto const add_block_graph = [&](std::size_t starting_device, std::size_t ending_device) {
+      auto device_params = block_params;
+
+      device_params.starting_device_id = starting_device;
+      device_params.ending_device_id   = ending_device;
+
+      block_graphs.push_back(build_block_graph(transmission_weights, params, device_params, extra_constraints));
+      return &block_graphs.back();
+    };
+
+    for (auto const &starting_device : starting_devices)
+      starting_graphs.push_back(add_block_graph(starting_device, ending_devices.front()));
+
+    ending_graphs.push_back(starting_graphs.front());
+    for (auto it = std::next(ending_devices.cbegin()); it != ending_devices.cend(); ++it)
+      ending_graphs.push_back(add_block_graph(starting_devices.front(), *it));
+
+    // If the model has less than three nodes, the block graph doesn't depend on the devices (all the nodes are
+    // assigned to the first device): there is nothing to join and a single search is enough
+    if (starting_graphs.front()->size() < 3)
+      {
+        auto const &block_graph = *starting_graphs.front();
+
+        auto const kFinder = KFinder_Factory<new_network, false, Csr_Weighted_Graph<new_network>>::Instance().create(
+          params.ksp_params.method, block_graph, 0, block_graph.size() - 1);
+
+        typename std::decay_t<decltype(*kFinder)>::Length_Bound_Type bound;
+        bound.max_relative_gap = params.ksp_params.max_relative_gap;
+
+        network_butcher::Utilities::Path_Converter        converter(block_graph);
+        network_butcher::types::Multi_Terminal_Real_Paths res;
+
+        res.paths = converter.convert_to_weighted_real_path(kFinder->compute_bounded(params.ksp_params.K, bound));
+
+        if (auto const best = kFinder->compute(1); !best.empty())
+          res.best_per_pair.emplace(std::make_pair(block_graph[best.front().path.front()].content.first,
+                                                   block_graph[best.front().path.back()].content.first),
+                                    converter.convert_to_weighted_real_path(best.front()));
+
+        return res;
+      }
+
+    auto const new_graph = join_terminals(starting_graphs, ending_graphs);
+    block_graphs.clear();
+
+    auto const sink = new_graph.size() - 1;
+
+    // The K best paths overall, from the super source to the super sink
+    auto const kFinder = KFinder_Factory<new_network, false, Csr_Weighted_Graph<new_network>>::Instance().create(
+      params.ksp_params.method, new_graph, 0, sink);
+
+    // The paths too far from the optimum are not required among the best ones
+    typename std::decay_t<decltype(*kFinder)>::Length_Bound_Type bound;
+    bound.max_relative_gap = params.ksp_params.max_relative_gap;
+
+    auto best_paths = kFinder->compute_bounded(params.ksp_params.K, bound);
+
+    // Remove the super source and the super sink
+    for (auto &path : best_paths)
+      {
+        path.path.pop_back();
+        path.path.erase(path.path.begin());
+      }
+
+    // The best path of every pair doesn't require the enumeration (it may rank arbitrarily low among the paths of the
+    // joined graph): the shortest path tree of every starting node gives the best path to every ending node. The node
+    // ids are a topological order, thus every tree is O(N+E)
+    std::map<std::pair<std::size_t, std::size_t>, Path_Info> best_per_pair;
+
+    Csr_Weighted_Graph<new_network> const weighted_graph(new_graph);
+    auto const                            ending_nodes = new_graph.get_input_nodes(sink);
+
+    for (std::size_t i = 0; i < starting_graphs.size(); ++i)
+      {
+        auto const starting_node = 1 + i;
+        auto const tree          = Shortest_path_finder::dag_shortest_path_tree(weighted_graph, starting_node);
+
+        for (auto const &ending_node : ending_nodes)
+          {
+            if (tree.second[ending_node] == std::numeric_limits<Time_Type>::max())
+              continue;
+
+            Path_Info info;
+            info.length = tree.second[ending_node];
+
+            for (auto node = ending_node; node != starting_node; node = tree.first[node])
+              info.path.push_back(node);
+            info.path.push_back(starting_node);
+
+            std::reverse(info.path.begin(), info.path.end());
+
+            best_per_pair.emplace(std::make_pair(new_graph[starting_node].content.first,
+                                                 new_graph[ending_node].content.first),
+                                  std::move(info));
+          }
+      }
+
+    // Convert the result from the block graph to the original graph
+    network_butcher::Utilities::Path_Converter converter(new_graph);
+    network_butcher::types::Multi_Terminal_Real_Paths res;
+
+    res.paths = converter.convert_to_weighted_real_path(best_paths);
+
+    for (auto const &[pair, path] : best_per_pair)
+      res.best_per_pair.emplace(pair, converter.convert_to_weighted_real_path(path));
+
+    return res;
+  }
+
+
+  template <class GraphType>
+  auto
+  Butcher<GraphType>::compute_k_shortest_paths_batch(
+    const std::vector<std::function<Time_Type(const Edge_Type &, std::size_t, std::size_t)>> &transmission_weights,
+    const network_butcher::parameters::Parameters                                            &params,
+    std::vector<std::unique_ptr<constraints::Graph_Constraint>> const &extra_constraints) const
+    -> std::vector<std::vector<network_butcher::types::Weighted_Real_Path>>
+  {
+    using namespace network_butcher::kfinder;
+    using Scenario_Graph_Type = Scenario_Graph<Weighted_Graph<new_network>>;
+
+    auto const num_scenarios = transmission_weights.size();
+
+    // Prepare the builder for the block graph construction. It's kept alive, since it's used to evaluate the
+    // transmission weights of the different scenarios
+    Constrained_Block_Graph_Builder builder(graph,
+                                            params.block_graph_generation_params,
+                                            params.aMLLibrary_params,
+                                            params.weights_params,
+                                            params.model_params,
+                                            params.devices,
+                                            constraints::generate_constraint_function(params, graph, node_columns));
+
+    // Only the operation weights are shared by the different scenarios
+    builder.construct_operation_weights();
+
+    for (auto &constraint : extra_constraints)
+      {
+        builder.add_constraint(constraint->copy());
+      }
+
+    // The constraints only remove edges: the topology doesn't depend on the transmission weights
+    auto const new_graph = builder.construct_block_graph();
+
+    Scenario_Weights<Weighted_Graph<new_network>> scenarios{Weighted_Graph<new_network>(new_graph)};
+    scenarios.resize(num_scenarios);
+
+    // Prepare the K-shortest path algorithms (one for every scenario)
+    std::vector<std::unique_ptr<KFinder<Scenario_Graph_Type, false, Weighted_Graph<Scenario_Graph_Type>>>> kFinders;
+    kFinders.reserve(num_scenarios);
+
+    for (std::size_t i = 0; i < num_scenarios; ++i)
+      {
+        kFinders.emplace_back(KFinder_Factory<Scenario_Graph_Type, false>::Instance().create(
+          params.ksp_params.method,
+          Scenario_Graph_Type{&scenarios, i},
+          new_graph.get_nodes().front().get_id(),
+          new_graph.get_nodes().back().get_id()));
+      }
+
+    std::vector<std::vector<network_butcher::types::Weighted_Real_Path>> res(num_scenarios);
+
+    auto const process_scenario = [&new_graph, &builder, &scenarios, &kFinders, &transmission_weights, &params, &res](
+                                    std::size_t i) {
+      // The weight of an edge is the sum of its operation weight and of its transmission weight in the scenario
+      scenarios.set_weights(i, [&](Edge_Type const &edge) {
+        auto weight = builder.transmission_weight(new_graph, edge, transmission_weights[i]);
+
+        if (new_graph.check_weight(edge))
+          weight += new_graph.get_weight(edge);
+
+        return weight;
+      });
+
+      // The paths too far from the optimum are not required
+      typename std::decay_t<decltype(*kFinders[i])>::Length_Bound_Type bound;
+      bound.max_relative_gap = params.ksp_params.max_relative_gap;
+
+      auto const paths = kFinders[i]->compute_path_trie(params.ksp_params.K, bound);
+
+      // Convert the result from the block graph to the original graph
+      network_butcher::Utilities::Path_Converter converter(new_graph);
+      res[i] = converter.convert_to_weighted_real_path(paths);
+    };
+
+#if NETWORK_BUTCHER_PARALLEL_TBB
+    std::vector<std::size_t> v(num_scenarios);
+    std::iota(v.begin(), v.end(), 0);
+
+    std::for_each(std::execution::par, v.cbegin(), v.cend(), process_scenario);
+#else
+#  pragma omp parallel default(none) shared(num_scenarios, process_scenario)
+    {
+#  pragma omp for
+      for (std::size_t i = 0; i < num_scenarios; ++i)
+        {
+          process_scenario(i);
+        }
+    }
+#endif
+
+    return res;
+  }
+
 } // namespace network_butcher
 #endif // NETWORK_BUTCHER_BUTCHER_H
\ No newline at end of file
@@ -165,6 +165,18 @@ namespace network_butcher
     construct_block_graph() const -> Block_Graph_Type;
 
 
+    /// It computes the transmission weight of an edge of the block graph with the given transmission function. It
+    /// doesn't modify the block graph: it's used to evaluate different transmission functions on the same block graph
+    /// \param new_graph The block graph
+    /// \param edge The edge
+    /// \param ts_weights The transmission function
+    /// \return The transmission weight of the edge
+    [[nodiscard]] auto
+    transmission_weight(Block_Graph_Type const       &new_graph,
+                        Edge_Type const              &edge,
+                        transmission_func_type const &ts_weights) const -> Time_Type;
+
+
     ~Constrained_Block_Graph_Builder() = default;
   };
 
@@ -492,7 +504,7 @@ namespace network_butcher
 
       // Inputs: first node, Outputs: following layer nodes
       {
-        new_dependencies.emplace_back(std::make_pair<Node_Id_Collection_Type, Node_Id_Collection_Type>({0}, {}));
+        new_dependencies.emplace_back(Neighbour_Id_Collection_Type{0}, Neighbour_Id_Collection_Type{});
         auto &out = new_dependencies.back().second;
         for (std::size_t k = 0; k < num_devices; ++k)
           out.insert(out.end(), 1 + num_devices + k);
@@ -902,8 +914,9 @@ namespace network_butcher
         }
     };
 
+    // Every node only sets the weights of the edges leaving it, thus the nodes can be processed concurrently
 #if NETWORK_BUTCHER_PARALLEL_TBB
-    std::for_each(nodes.cbegin(), nodes.cend(), process_node);
+    std::for_each(std::execution::par, nodes.cbegin(), nodes.cend(), process_node);
 #else
 #  pragma omp parallel default(none) shared(nodes, new_graph, graph, mode, process_node)
     {
@@ -918,108 +931,123 @@ namespace network_butcher
 
 
   template <typename GraphType>
-  void
-  Constrained_Block_Graph_Builder<GraphType>::apply_transmission_weights(Block_Graph_Type &new_graph) const
+  auto
+  Constrained_Block_Graph_Builder<GraphType>::transmission_weight(
+    Block_Graph_Type const       &new_graph,
+    Edge_Type const              &edge,
+    transmission_func_type const &ts_weights) const -> Time_Type
   {
     using namespace network_butcher::parameters;
 
-    auto const &nodes      = new_graph.get_nodes();
-    auto const &graph      = this->original_graph;
-    auto const &mode       = block_graph_generation_params.block_graph_mode;
-    auto const &ts_weights = transmission_weights;
+    auto const &graph = this->original_graph;
+    auto const &mode  = block_graph_generation_params.block_graph_mode;
 
-    auto const process_node = [&new_graph, &graph, &mode, &ts_weights](auto const &node) {
-      auto const &inputs = *node.content.second;
-      auto const  first  = node.get_id();
+    auto const &node   = new_graph[edge.first];
+    auto const &inputs = *node.content.second;
 
-      auto const in_device_id = node.content.first;
+    auto const in_device_id = node.content.first;
 
-      for (auto const &second : new_graph.get_output_nodes(first))
-        {
-          auto const &out_node = new_graph[second];
+    auto const &out_node = new_graph[edge.second];
+    // The device id of the output node (=0 starting device, >0 other device)
+    auto const out_device_id = out_node.content.first;
 
-          Edge_Type const edge = std::make_pair(first, second);
-          // The device id of the output node (=0 starting device, >0 other device)
-          auto const out_device_id = out_node.content.first;
+    // Look for the nodes of the original graph that are represented by the output node (in the
+    // linearized graph)
+    auto const &outputs = *out_node.content.second;
 
-          // Look for the nodes of the original graph that are represented by the output node (in the
-          // linearized graph)
-          auto const &outputs = *out_node.content.second;
+    Time_Type final_cost = 0.;
 
-          Time_Type final_cost = 0.;
+    // 1-1 correspondence
+    if (outputs.size() == 1 && inputs.size() == 1)
+      {
+        auto const &input  = *inputs.begin();
+        auto const &output = *outputs.begin();
 
-          // 1-1 correspondence
-          if (outputs.size() == 1 && inputs.size() == 1)
-            {
-              auto const &input  = *inputs.begin();
-              auto const &output = *outputs.begin();
+        auto const tmp_edge = std::make_pair(input, output);
 
-              auto const tmp_edge = std::make_pair(input, output);
+        final_cost = ts_weights(tmp_edge, in_device_id, out_device_id);
+      }
+    // (2+)-1 correspondence. The idea is that the input nodes must transmit to the output node the
+    // different values. Thus, the transmission cost is paid several times.
+    else if (outputs.size() == 1)
+      {
+        auto const &output = *outputs.begin();
+        // The inputs on the original graph of the output node have to
+        // transmit their values to the output node
+        for (auto const &input : graph.get_input_nodes(output))
+          {
+            final_cost += ts_weights(std::make_pair(input, output), in_device_id, out_device_id);
+          }
+      }
+    // 1-(2+). In this case, the input is sent to the device of the output nodes a single time.
+    // Thus, this transmission cost is taken into account only once.
+    else if (inputs.size() == 1)
+      {
+        auto const &input        = *inputs.begin();
+        auto const &comm_outputs = graph.get_output_nodes(input);
 
-              final_cost = ts_weights(tmp_edge, in_device_id, out_device_id);
-            }
-          // (2+)-1 correspondence. The idea is that the input nodes must transmit to the output node the
-          // different values. Thus, the transmission cost is paid several times.
-          else if (outputs.size() == 1)
-            {
-              auto const &output = *outputs.begin();
-              // The inputs on the original graph of the output node have to
-              // transmit their values to the output node
-              for (auto const &input : graph.get_input_nodes(output))
-                {
-                  final_cost += ts_weights(std::make_pair(input, output), in_device_id, out_device_id);
-                }
-            }
-          // 1-(2+). In this case, the input is sent to the device of the output nodes a single time.
-          // Thus, this transmission cost is taken into account only once.
-          else if (inputs.size() == 1)
-            {
-              auto const &input        = *inputs.begin();
-              auto const &comm_outputs = graph.get_output_nodes(input);
+        final_cost += ts_weights(std::make_pair(input, *comm_outputs.crbegin()), in_device_id, out_device_id);
+      }
+    // (2+)-(2+). In this case, there are two possibilities: either the block graph mode is classic
+    // (and the program should trow) or the block graph mode is input/output. In the latter case, we
+    // should consider the transmission of the "frontier" nodes of inputs and the overall execution
+    // cost for the outputs
+    else
+      {
+        // In classic mode, every edge can have at most one 2+ node.
+        if (mode == Block_Graph_Generation_Mode::classic)
+          {
+            throw std::logic_error("Constrained_Block_Graph_Builder::apply_transmission_weights: The edge (" +
+                                   std::to_string(edge.first) + ", " + std::to_string(edge.second) +
+                                   ") has both multiple inputs and outputs!");
+          }
+        // In input and output mode, every edge can have up to two 2+ nodes.
+        else
+          {
+            // This is the collection of the input nodes of every node contained in outputs
+            std::set<Node_Id_Type> output_node_inputs;
+            for (auto const &node_id : outputs)
+              {
+                auto const &tmp_nodes = graph.get_input_nodes(node_id);
+                output_node_inputs.insert(tmp_nodes.cbegin(), tmp_nodes.cend());
+              }
 
-              final_cost += ts_weights(std::make_pair(input, *comm_outputs.crbegin()), in_device_id, out_device_id);
-            }
-          // (2+)-(2+). In this case, there are two possibilities: either the block graph mode is classic
-          // (and the program should trow) or the block graph mode is input/output. In the latter case, we
-          // should consider the transmission of the "frontier" nodes of inputs and the overall execution
-          // cost for the outputs
-          else
-            {
-              // In classic mode, every edge can have at most one 2+ node.
-              if (mode == Block_Graph_Generation_Mode::classic)
-                {
-                  throw std::logic_error("Constrained_Block_Graph_Builder::apply_transmission_weights: The edge (" +
-                                         std::to_string(edge.first) + ", " + std::to_string(edge.second) +
-                                         ") has both multiple inputs and outputs!");
-                }
-              // In input and output mode, every edge can have up to two 2+ nodes.
-              else
-                {
-                  // This is the collection of the input nodes of every node contained in outputs
-                  std::set<Node_Id_Type> output_node_inputs;
-                  for (auto const &node_id : outputs)
-                    {
-                      auto const &tmp_nodes = graph.get_input_nodes(node_id);
-                      output_node_inputs.insert(tmp_nodes.cbegin(), tmp_nodes.cend());
-                    }
+            // This is the collection of nodes in inputs whose output tensors are fed to outputs
+            std::vector<Node_Id_Type> frontier_input(std::max(inputs.size(), output_node_inputs.size()));
+            auto const                close_frontier = std::set_intersection(output_node_inputs.cbegin(),
+                                                              output_node_inputs.cend(),
+                                                              inputs.cbegin(),
+                                                              inputs.cend(),
+                                                              frontier_input.begin());
 
-                  // This is the collection of nodes in inputs whose output tensors are fed to outputs
-                  std::vector<Node_Id_Type> frontier_input(std::max(inputs.size(), output_node_inputs.size()));
-                  auto const                close_frontier = std::set_intersection(output_node_inputs.cbegin(),
-                                                                    output_node_inputs.cend(),
-                                                                    inputs.cbegin(),
-                                                                    inputs.cend(),
-                                                                    frontier_input.begin());
+            // We have to consider the transmission cost for every node in the frontier_input
+            for (auto input_it = frontier_input.cbegin(); input_it != close_frontier; ++input_it)
+              {
+                final_cost += ts_weights(std::make_pair(*input_it, *graph.get_output_nodes(*input_it).crbegin()),
+                                         in_device_id,
+                                         out_device_id);
+              }
+          }
+      }
 
-                  // We have to consider the transmission cost for every node in the frontier_input
-                  for (auto input_it = frontier_input.cbegin(); input_it != close_frontier; ++input_it)
-                    {
-                      final_cost += ts_weights(std::make_pair(*input_it, *graph.get_output_nodes(*input_it).crbegin()),
-                                               in_device_id,
-                                               out_device_id);
-                    }
-                }
-            }
+    return final_cost;
+  }
+
+
+  template <typename GraphType>
+  void
+  Constrained_Block_Graph_Builder<GraphType>::apply_transmission_weights(Block_Graph_Type &new_graph) const
+  {
+    auto const &nodes = new_graph.get_nodes();
+
+    auto const process_node = [this, &new_graph](auto const &node) {
+      auto const first = node.get_id();
+
+      for (auto const &second : new_graph.get_output_nodes(first))
+        {
+          Edge_Type const edge = std::make_pair(first, second);
+
+          auto final_cost = transmission_weight(new_graph, edge, transmission_weights);
 
           if (new_graph.check_weight(edge))
             final_cost += new_graph.get_weight(edge);
@@ -1031,7 +1059,7 @@ namespace network_butcher
 #if NETWORK_BUTCHER_PARALLEL_TBB
     std::for_each(std::execution::par, nodes.cbegin(), nodes.cend(), process_node);
 #else
-#  pragma omp parallel default(none) shared(nodes, graph, new_graph, transmission_weights, mode, process_node)
+#  pragma omp parallel default(none) shared(nodes, process_node)
     {
 #  pragma omp for
       for (const auto &node : nodes)
@@ -53,20 +53,19 @@ namespace network_butcher::constraints
     /// The parameters
     parameters::Parameters const &params;
 
-    /// The original graph. Used to measure the memory usage of each layer of the model
+    /// The original graph. Used to find the neighbours of the nodes
     GraphType const &graph;
 
+    /// The columnar store of the nodes of the original graph. Used to measure the memory usage of each layer of the
+    /// model
+    std::shared_ptr<types::Node_Columns const> columns;
+
     /// Helper function used to estimate the memory usage of a group of nodes
     /// \param ids The set of nodes to "analyze"
-    /// \param input_memory The memory usage of all input nodes
-    /// \param output_memory The memory usage of all output nodes
-    /// \param params_memory The memory usage of all parameters nodes
+    /// \param columns The columnar store of the nodes of the original graph (with their memory usages)
     /// \return The pair of maximum memory of ios and of memory of parameters
     [[nodiscard]] auto
-    estimate_maximum_memory_usage(const std::set<Node_Id_Type>   &ids,
-                                  const std::vector<Memory_Type> &input_memory,
-                                  const std::vector<Memory_Type> &output_memory,
-                                  const std::vector<Memory_Type> &params_memory) const
+    estimate_maximum_memory_usage(const std::set<Node_Id_Type> &ids, types::Node_Columns const &columns) const
       -> std::tuple<Memory_Type, Memory_Type>;
 
     /// It will check if the constraint is applicable to the current graph
@@ -79,10 +78,14 @@ namespace network_butcher::constraints
     /// Constructor
     /// \param params The parameters
     /// \param graph The original graph
-    explicit Memory_Constraint(parameters::Parameters const &params, GraphType const &graph)
+    /// \param columns The columnar store of the nodes of the original graph (see compute_node_columns)
+    explicit Memory_Constraint(parameters::Parameters const                &params,
+                               GraphType const                             &graph,
+                               std::shared_ptr<types::Node_Columns const> columns)
       : Graph_Constraint()
       , params{params}
-      , graph{graph} {};
+      , graph{graph}
+      , columns{std::move(columns)} {};
 
     /// Removes the "unfeasible" paths due to memory constraints from the block graph
     /// \param graph The block graph
@@ -148,10 +151,6 @@ namespace network_butcher::constraints
     auto const &devices     = params.devices;
     auto const  num_devices = devices.size();
 
-    auto const input_memory  = network_butcher::computer::Computer_memory::compute_nodes_memory_usage_input(graph);
-    auto const output_memory = network_butcher::computer::Computer_memory::compute_nodes_memory_usage_output(graph);
-    auto const params_memory = network_butcher::computer::Computer_memory::compute_nodes_memory_usage_parameters(graph);
-
     std::vector<bool> available(num_devices, true);
     Memory_Type       memory_graph = 0;
 
@@ -190,13 +189,14 @@ namespace network_butcher::constraints
         if (new_node_content.size() == 1)
           {
             auto const &index = *new_node_content.cbegin();
-            response_fun_preload_parameters(i, params_memory[index], input_memory[index] + output_memory[index]);
+            response_fun_preload_parameters(i,
+                                            columns->get_parameters_memory(index),
+                                            columns->get_input_memory(index) + columns->get_output_memory(index));
           }
         else
           {
             // Get the IO memory usage and the parameters memory usage
-            auto const &[io_mem, param_mem] =
-              estimate_maximum_memory_usage(new_node_content, input_memory, output_memory, params_memory);
+            auto const &[io_mem, param_mem] = estimate_maximum_memory_usage(new_node_content, *columns);
 
             response_fun_preload_parameters(i, param_mem, io_mem);
           }
@@ -205,10 +205,8 @@ namespace network_butcher::constraints
 
   template <typename GraphType>
   auto
-  Memory_Constraint<GraphType>::estimate_maximum_memory_usage(const std::set<Node_Id_Type>   &ids,
-                                                              const std::vector<Memory_Type> &input_memory,
-                                                              const std::vector<Memory_Type> &output_memory,
-                                                              const std::vector<Memory_Type> &params_memory) const
+  Memory_Constraint<GraphType>::estimate_maximum_memory_usage(const std::set<Node_Id_Type> &ids,
+                                                              types::Node_Columns const    &columns) const
     -> std::tuple<Memory_Type, Memory_Type>
   {
     Memory_Type result_memory = 0, fixed_memory = 0;
@@ -219,6 +217,7 @@ namespace network_butcher::constraints
     std::size_t qty = 1;
 
     // Memory required by the parameters
+    auto const params_memory = columns.get_parameters_memory();
     fixed_memory =
       std::reduce(std::next(params_memory.begin(), *ids.cbegin()), std::next(params_memory.begin(), *ids.crbegin()));
 
@@ -234,8 +233,8 @@ namespace network_butcher::constraints
         auto const &parents  = graph.get_input_nodes(id);
         auto const &children = graph.get_output_nodes(id);
 
-        Memory_Type const &in_memory  = input_memory[id];
-        Memory_Type const &out_memory = output_memory[id];
+        Memory_Type const in_memory  = columns.get_input_memory(id);
+        Memory_Type const out_memory = columns.get_output_memory(id);
 
         // Compute the maximum memory required by any node
         result_memory = std::max(result_memory, in_memory + out_memory);
@@ -253,18 +252,21 @@ namespace network_butcher::constraints
   /// \tparam GraphType The graph type
   /// \param params The parameters of the program
   /// \param graph The original graph
+  /// \param columns The columnar store of the nodes of the original graph (see compute_node_columns)
   /// \return The generator function
   template <typename GraphType>
   auto
-  generate_constraint_function(parameters::Parameters const &params, GraphType const &graph)
+  generate_constraint_function(parameters::Parameters const                &params,
+                               GraphType const                             &graph,
+                               std::shared_ptr<types::Node_Columns const> columns)
     -> std::function<std::vector<std::unique_ptr<constraints::Graph_Constraint>>()>
   {
-    return [&params, &graph]() {
+    return [&params, &graph, columns = std::move(columns)]() {
       std::vector<std::unique_ptr<Graph_Constraint>> res;
 
       if (params.block_graph_generation_params.memory_constraint)
         {
-          res.push_back(std::make_unique<Memory_Constraint<GraphType>>(params, graph));
+          res.push_back(std::make_unique<Memory_Constraint<GraphType>>(params, graph, columns));
         }
 
       return res;
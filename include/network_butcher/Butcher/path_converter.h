@@ -1,9 +1,12 @@
 #ifndef NETWORK_BUTCHER_PATH_CONVERTER_H
 #define NETWORK_BUTCHER_PATH_CONVERTER_H
 
+#include <optional>
+
 #include <network_butcher/Network/graph_traits.h>
 
 #include <network_butcher/K-shortest_path/path_info.h>
+#include <network_butcher/K-shortest_path/path_trie.h>
 #include <network_butcher/Types/paths.h>
 
 namespace network_butcher::Utilities
@@ -17,6 +20,17 @@ namespace network_butcher::Utilities
     /// The block graph. Used to reconstruct the paths
     Block_Graph_Type const &graph;
 
+    /// It will convert a collection of paths of the block graph to a partitioning. The paths are converted in parallel
+    /// \tparam Path_Function The type of the function that describes a path
+    /// \param num_paths The number of paths
+    /// \param path_function The function that describes a path. It's called as path_function(i, visit): it must call
+    /// visit(node) for every node of the i-th path (in order) and it must return the length of the path
+    /// \return The different partitioning
+    template <typename Path_Function>
+    [[nodiscard]] auto
+    convert(std::size_t num_paths, Path_Function const &path_function) const
+      -> std::vector<network_butcher::types::Weighted_Real_Path>;
+
   public:
     /// It will prepare a Path_Converter
     /// \param graph A const reference to a block graph
@@ -30,6 +44,14 @@ namespace network_butcher::Utilities
     convert_to_weighted_real_path(std::vector<network_butcher::kfinder::Templated_Path_Info<Weight_Type>> const &paths)
       const -> std::vector<network_butcher::types::Weighted_Real_Path>;
 
+    /// It will convert a compact collection of paths of the block graph to a partitioning. The explicit paths are
+    /// never constructed
+    /// \param paths The compact collection of paths
+    /// \return The different partitioning
+    [[nodiscard]] auto
+    convert_to_weighted_real_path(network_butcher::kfinder::Templated_Path_Trie<Weight_Type> const &paths) const
+      -> std::vector<network_butcher::types::Weighted_Real_Path>;
+
     /// It will convert a path of the block graph to a partitioning
     /// \param path The path
     /// \return The related partitioning
@@ -43,7 +65,7 @@ namespace network_butcher::Utilities
   Path_Converter<Weight_Type>::convert_to_weighted_real_path(
     const kfinder::Templated_Path_Info<Weight_Type> &path) const -> network_butcher::types::Weighted_Real_Path
   {
-    return convert_to_weighted_real_path({path});
+    return convert_to_weighted_real_path(std::vector{path}).front();
   }
 
   template <typename Weight_Type>
@@ -52,83 +74,81 @@ namespace network_butcher::Utilities
     const std::vector<network_butcher::kfinder::Templated_Path_Info<Weight_Type>> &paths) const
     -> std::vector<network_butcher::types::Weighted_Real_Path>
   {
-    std::vector<network_butcher::types::Weighted_Real_Path> final_res(paths.size());
+    return convert(paths.size(), [&paths](std::size_t i, auto const &visit) {
+      for (auto const &node_id : paths[i].path)
+        visit(node_id);
 
-#if NETWORK_BUTCHER_PARALLEL_TBB
-    // Process the different paths into partitioning
-    std::transform(
-      std::execution::par, paths.cbegin(), paths.cend(), final_res.begin(), [&graph = graph](auto const &path) {
-        network_butcher::types::Real_Path res;
-        auto const                       &path_nodes = path.path;
+      return paths[i].length;
+    });
+  }
+
+  template <typename Weight_Type>
+  auto
+  Path_Converter<Weight_Type>::convert_to_weighted_real_path(
+    const network_butcher::kfinder::Templated_Path_Trie<Weight_Type> &paths) const
+    -> std::vector<network_butcher::types::Weighted_Real_Path>
+  {
+    return convert(paths.size(), [&paths](std::size_t i, auto const &visit) {
+      paths.for_each_node(i, visit);
 
-        if (!path_nodes.empty())
+      return paths.length(i);
+    });
+  }
+
+  template <typename Weight_Type>
+  template <typename Path_Function>
+  auto
+  Path_Converter<Weight_Type>::convert(std::size_t num_paths, Path_Function const &path_function) const
+    -> std::vector<network_butcher::types::Weighted_Real_Path>
+  {
+    std::vector<network_butcher::types::Weighted_Real_Path> final_res(num_paths);
+
+    // Process a single path into a partitioning
+    auto const process_path = [&graph = graph, &path_function, &final_res](std::size_t i) {
+      auto &res      = final_res[i];
+      auto &path_res = res.second;
+
+      // The device of the last partition
+      std::optional<std::size_t> current_model_device;
+
+      // Loop through the nodes of the path. The length is converted back to seconds
+      auto const length = path_function(i, [&graph, &path_res, &current_model_device](Node_Id_Type node_id) {
+        auto const &node = graph[node_id];
+
+        // Check if a new device is requested
+        if (node.content.first != current_model_device)
           {
-            std::size_t current_model_device = graph[path_nodes.front()].content.first;
-
-            res.emplace_back(current_model_device, std::set<Node_Id_Type>());
-
-            // Loop through the nodes of the path
-            for (auto const &node_id_new_graph : path_nodes)
-              {
-                auto const &node = graph[node_id_new_graph];
-
-                // Check if a new device is requested
-                if (node.content.first != current_model_device)
-                  {
-                    // Add a new partition
-                    current_model_device = node.content.first;
-                    res.emplace_back(current_model_device, std::set<Node_Id_Type>());
-                  }
-
-                // Add the current node to the last partition
-                res.back().second.insert(node.content.second->begin(), node.content.second->end());
-              }
+            // Add a new partition
+            current_model_device = node.content.first;
+            path_res.emplace_back(node.content.first, std::set<Node_Id_Type>());
           }
 
-        return network_butcher::types::Weighted_Real_Path{path.length, std::move(res)};
+        // Add the current node to the last partition
+        path_res.back().second.insert(node.content.second->begin(), node.content.second->end());
       });
+
+      res.first = to_seconds(static_cast<Time_Type>(length));
+    };
+
+#if NETWORK_BUTCHER_PARALLEL_TBB
+    std::vector<std::size_t> v(num_paths);
+    std::generate(v.begin(), v.end(), [n = 0]() mutable { return n++; });
+
+    // Process the different paths into partitioning
+    std::for_each(std::execution::par, v.cbegin(), v.cend(), process_path);
 #else
-#  pragma omp parallel default(none) shared(final_res, paths)
+#  pragma omp parallel default(none) shared(num_paths, process_path)
     {
 #  pragma omp for
-      for (std::size_t i = 0; i < paths.size(); ++i)
+      for (std::size_t i = 0; i < num_paths; ++i)
         {
-          auto const &path     = paths[i];
-          auto       &res      = final_res[i];
-          auto       &path_res = res.second;
-
-          res.first              = path.length;
-          auto const &path_nodes = path.path;
-
-          if (!path_nodes.empty())
-            {
-              // The first device id
-              std::size_t current_model_device = graph[path_nodes.front()].content.first;
-              path_res.emplace_back(current_model_device, std::set<Node_Id_Type>());
-
-              // Loop through the nodes of the path
-              for (auto const &node_id_new_graph : path_nodes)
-                {
-                  auto const &node = graph[node_id_new_graph];
-
-                  // Check if a new device is requested
-                  if (node.content.first != current_model_device)
-                    {
-                      // Add a new partition
-                      current_model_device = node.content.first;
-                      path_res.emplace_back(current_model_device, std::set<Node_Id_Type>());
-                    }
-
-                  // Add the current node to the last partition
-                  path_res.back().second.insert(node.content.second->begin(), node.content.second->end());
-                }
-            }
+          process_path(i);
         }
     }
 #endif
 
     return final_res;
-  } // namespace network_butcher::Utilities
+  }
 } // namespace network_butcher::Utilities
 
 #endif // NETWORK_BUTCHER_PATH_CONVERTER_H
@@ -5,6 +5,7 @@
 
 #include <network_butcher/utilities.h>
 #include <network_butcher/Network/wgraph.h>
+#include <network_butcher/Types/node_columns.h>
 
 namespace network_butcher::computer::Computer_memory
 {
@@ -266,6 +267,57 @@ namespace network_butcher::computer::Computer_memory
   }
 
 
+  template <typename T>
+  [[nodiscard]] auto
+  compute_node_columns(Contented_Graph_Type<T> const &graph) -> types::Node_Columns
+  {
+    auto const              &nodes = graph.get_nodes();
+    std::vector<Memory_Type> input_memory(nodes.size()), output_memory(nodes.size()), parameters_memory(nodes.size());
+
+    auto const fill = [&nodes, &input_memory, &output_memory, &parameters_memory](std::size_t i) {
+      auto const &content = nodes[i].content;
+
+      input_memory[i]      = compute_memory_usage_input(content);
+      output_memory[i]     = compute_memory_usage_output(content);
+      parameters_memory[i] = compute_memory_usage_parameters(content);
+    };
+
+#if NETWORK_BUTCHER_PARALLEL_TBB
+    std::vector<std::size_t> ids(nodes.size());
+    std::iota(ids.begin(), ids.end(), 0);
+
+    std::for_each(std::execution::par, ids.cbegin(), ids.cend(), fill);
+#else
+    #pragma omp parallel default(none) shared(nodes, fill)
+    {
+      #pragma omp for
+      for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+          fill(i);
+        }
+    }
+#endif
+
+    return types::Node_Columns(nodes, std::move(input_memory), std::move(output_memory), std::move(parameters_memory));
+  }
+
+
+  [[nodiscard]] inline auto
+  compute_memory_usage_input(types::Node_Columns const &columns) -> Memory_Type
+  {
+    auto const memory = columns.get_input_memory();
+    return std::reduce(memory.begin(), memory.end(), Memory_Type{0});
+  }
+
+
+  [[nodiscard]] inline auto
+  compute_memory_usage_parameters(types::Node_Columns const &columns) -> Memory_Type
+  {
+    auto const memory = columns.get_parameters_memory();
+    return std::reduce(memory.begin(), memory.end(), Memory_Type{0});
+  }
+
+
   template <typename T>
   [[nodiscard]] auto
   compute_memory_usage_input(Contented_Graph_Type<T> const &graph) -> Memory_Type
@@ -0,0 +1,97 @@
+#ifndef NETWORK_BUTCHER_GRAPH_SNAPSHOT_H
+#define NETWORK_BUTCHER_GRAPH_SNAPSHOT_H
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <network_butcher/Network/graph_traits.h>
+
+/// \namespace Graph_Snapshot It contains the functions used to store the converted graph of an onnx model in a binary
+/// snapshot and to read it back, so that the onnx model doesn't have to be parsed and converted every time.
+///
+/// A snapshot is made by a header (magic string, format version, content hash of the .onnx file and the padding
+/// options used by the import) followed by the string table of the interned tensor names, the tensors (name, memory
+/// usage of the element type, flags and shape), the nodes (name, operation id, attributes and the input, output and
+/// parameter tensors, referenced by their position in the previous tables), the neighbours of every node and the map
+/// linking the nodes to the nodes of the onnx model. Every entry is stored as a native (little-endian) fixed-width
+/// integer aligned to 8 bytes and every array is prefixed by its size, thus the file can be read in place (e.g., after
+/// mapping it in memory)
+namespace network_butcher::io::Graph_Snapshot
+{
+  /// The version of the snapshot format. Snapshots with a different version are ignored
+  inline constexpr std::uint32_t format_version = 1;
+
+  /// The extension of the snapshot files
+  inline constexpr char const *extension = ".nbsnap";
+
+  /// The content of a snapshot
+  struct Snapshot_Content_Type
+  {
+    /// The converted graph
+    Converted_Onnx_Graph_Type graph;
+
+    /// The map that associates every node of the graph to a node of the onnx model (through their ids)
+    std::map<Node_Id_Type, Node_Id_Type> link_id_nodeproto;
+  };
+
+
+  /// It computes the content hash (FNV-1a, 64 bits) of the given file
+  /// \param path The file path
+  /// \return The hash
+  auto
+  compute_file_hash(std::string const &path) -> std::uint64_t;
+
+
+  /// It returns the path of the snapshot of a model in the given directory. The name depends on the content hash of the
+  /// model and on the padding options, so that a different model (or a different import of it) gets a different file
+  /// \param snapshot_directory The directory containing the snapshots
+  /// \param model_hash The content hash of the .onnx file
+  /// \param add_input_padding Was the input padding node added?
+  /// \param add_output_padding Was the output padding node added?
+  /// \return The path of the snapshot
+  auto
+  get_snapshot_path(std::string const &snapshot_directory,
+                    std::uint64_t      model_hash,
+                    bool               add_input_padding,
+                    bool               add_output_padding) -> std::string;
+
+
+  /// It stores the converted graph in a snapshot. The file is first written to a temporary path and then renamed, so
+  /// that a snapshot is never read while partially written (the temporary file is removed if the export fails). It
+  /// will throw if the graph contains a tensor that is not a Dense_tensor or if the file cannot be written
+  /// \param path The path of the snapshot
+  /// \param model_hash The content hash of the .onnx file
+  /// \param add_input_padding Was the input padding node added?
+  /// \param add_output_padding Was the output padding node added?
+  /// \param graph The converted graph
+  /// \param link_id_nodeproto The map that associates every node of the graph to a node of the onnx model
+  void
+  export_snapshot(std::string const                          &path,
+                  std::uint64_t                               model_hash,
+                  bool                                        add_input_padding,
+                  bool                                        add_output_padding,
+                  Converted_Onnx_Graph_Type const            &graph,
+                  std::map<Node_Id_Type, Node_Id_Type> const &link_id_nodeproto);
+
+
+  /// It reads the converted graph from a snapshot. The tensor names are interned again in the global symbol table
+  /// \param path The path of the snapshot
+  /// \param model_hash The content hash of the .onnx file
+  /// \param add_input_padding Was the input padding node added?
+  /// \param add_output_padding Was the output padding node added?
+  /// \param num_devices The number of devices
+  /// \return The graph and the map associating its nodes to the nodes of the onnx model. If the snapshot doesn't exist,
+  /// if it was produced by a different version, for a different model or with different options or if it's corrupted,
+  /// nothing is returned (and none of its names is added to the Symbol_Table)
+  auto
+  import_snapshot(std::string const &path,
+                  std::uint64_t      model_hash,
+                  bool               add_input_padding,
+                  bool               add_output_padding,
+                  std::size_t        num_devices) -> std::optional<Snapshot_Content_Type>;
+} // namespace network_butcher::io::Graph_Snapshot
+
+#endif // NETWORK_BUTCHER_GRAPH_SNAPSHOT_H
@@ -1,13 +1,21 @@
 #ifndef NETWORK_BUTCHER_BASIC_KEPPSTEIN_H
 #define NETWORK_BUTCHER_BASIC_KEPPSTEIN_H
 
+#include <deque>
 #include <functional>
 #include <list>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
+#include <queue>
 #include <ranges>
+#include <type_traits>
+#include <unordered_map>
 #include <variant>
 
+#include <network_butcher/K-shortest_path/heap_selection.h>
 #include <network_butcher/K-shortest_path/heap_traits.h>
+#include <network_butcher/K-shortest_path/min_max_heap.h>
 #include <network_butcher/K-shortest_path/shortest_path_finder.h>
 
 #include <network_butcher/APSC/chrono.h>
@@ -33,6 +41,15 @@ namespace network_butcher::kfinder
     /// The type of the output of the algorithm
     using Output_Type = Parent_Type::Output_Type;
 
+    /// The type of the enumerator returned by enumerate
+    using Enumerator_Type = Parent_Type::Enumerator_Type;
+
+    /// The type of the compact collection of paths returned by compute_path_trie
+    using Path_Trie_Type = Parent_Type::Path_Trie_Type;
+
+    /// The type of the upper bound on the length of the paths
+    using Length_Bound_Type = Parent_Type::Length_Bound_Type;
+
   protected:
     /// Bring forward the graph
     using Parent_Type::graph;
@@ -58,6 +75,16 @@ namespace network_butcher::kfinder
     /// Type of the collection of H_out
     using H_out_collection = Templated_H_out_Collection<Weight_Type>;
 
+    /// Type of a single H_g
+    using H_g_Heap_Type = typename H_g_collection::value_type::value_type;
+
+    /// Type of a single H_out
+    using H_out_Heap_Type = typename H_out_collection::value_type::value_type;
+
+    /// Type of the arena owning all the nodes of the H_outs and H_gs generated by a single search. The nodes
+    /// are never deallocated one by one: the whole arena is released when it's destroyed
+    using Arena_Type = std::pmr::monotonic_buffer_resource;
+
     /// Type of collection of weights. Used to map edges to their sidetrack weights
     using Internal_Weight_Collection_Type = std::vector<std::multimap<Node_Id_Type, Weight_Type>>;
 
@@ -65,79 +92,74 @@ namespace network_butcher::kfinder
     using Dijkstra_Result_Type =
       network_butcher::kfinder::Shortest_path_finder::Templated_Dijkstra_Result_Type<Weight_Type>;
 
-    /// Type of the callback function used by general_algo_eppstein
-    using Callback_Function =
-      std::function<typename H_g_collection::const_iterator(H_g_collection &,
-                                                            H_out_collection &,
-                                                            Internal_Weight_Collection_Type const &,
-                                                            typename Dijkstra_Result_Type::first_type const &,
-                                                            Node_Id_Type,
-                                                            t_Weighted_Graph_Complete_Type const &)>;
+    /// Type of the callback function used by general_algo_eppstein. It returns the H_g of the given node
+    using Callback_Function = std::function<H_g_Heap_Type const *(H_g_collection &,
+                                                                   H_out_collection &,
+                                                                   Internal_Weight_Collection_Type const &,
+                                                                   typename Dijkstra_Result_Type::first_type const &,
+                                                                   Node_Id_Type,
+                                                                   t_Weighted_Graph_Complete_Type const &)>;
 
-    /// A struct that contains the information about a node in the D(G) graph
+    /// A struct that contains the information about a node in the D(G) graph. It's trivially copyable (two pointers)
     class D_G_Node
     {
     private:
       /// Node of H_g
-      H_g_collection::mapped_type ::Node_Type const *h_g_node;
+      H_g_Heap_Type::Node_Type const *h_g_node = nullptr;
 
       /// Node of H_out
-      H_out_collection ::mapped_type ::Node_Type const *h_out_node;
+      H_out_Heap_Type::Node_Type const *h_out_node = nullptr;
 
     public:
-      /// Constructs a D_G_Node from an H_g. No test is performed on h_g_it (D_G_Node assumes that it contains a valid
+      /// Constructs an invalid D_G_Node (used by the implicit paths without sidetracks)
+      D_G_Node() = default;
+
+      /// Constructs a D_G_Node from an H_g. No test is performed on h_g (D_G_Node assumes that it contains a valid
       /// heap). Perform the appropriate checks before calling the constructor
-      /// \param h_g_it The iterator to the h_g_it collection
-      explicit D_G_Node(H_g_collection::const_iterator const &h_g_it)
-        : h_g_node{h_g_it->second.get_head_node()}
+      /// \param h_g The H_g
+      explicit D_G_Node(H_g_Heap_Type const &h_g)
+        : h_g_node{h_g.get_head_node()}
         , h_out_node{nullptr} {};
 
       /// Constructs a D_G_Node from a node of H_g
       /// \param node The node of H_g
-      explicit D_G_Node(H_g_collection::mapped_type ::Node_Type const *node)
+      explicit D_G_Node(H_g_Heap_Type::Node_Type const *node)
         : h_g_node{node}
         , h_out_node{nullptr} {};
 
       /// Constructs a D_G_Node from a node of H_out
       /// \param node The node of H_out
-      explicit D_G_Node(H_out_collection::mapped_type ::Node_Type const *node)
+      explicit D_G_Node(H_out_Heap_Type::Node_Type const *node)
         : h_g_node{nullptr}
         , h_out_node{node} {};
 
 
-      /// It will produce the children of the given node in the D(G) graph
-      /// \return
-      [[nodiscard]] auto
-      get_children() const -> std::vector<D_G_Node>
+      /// It will call the given function for every child of the given node in the D(G) graph (up to 3 children). The
+      /// children are visited in place: no memory is allocated
+      /// \tparam Visit_Function The type of the function
+      /// \param visit The function called for every child
+      template <typename Visit_Function>
+      void
+      for_each_child(Visit_Function &&visit) const
       {
-        std::vector<D_G_Node> res;
-        if (!valid())
-          return res;
-
         if (h_out_node)
           {
-            auto const &node = h_out_node;
-
-            // Add all the H_out related children
-            for (auto const &child : node->get_children())
-              res.emplace_back(child);
+            // Visit all the H_out related children
+            for (auto const &child : h_out_node->get_children())
+              visit(D_G_Node(child));
           }
-        else
+        else if (h_g_node)
           {
-            auto const &node = h_g_node;
-
             // It should be a single child of the head of H_out
-            auto const &children = node->get_content()->get_head_node()->get_children();
+            auto const &children = h_g_node->get_content()->get_head_node()->get_children();
 
             if (!children.empty())
-              res.emplace_back(children.front());
+              visit(D_G_Node(children.front()));
 
-            // Add all the H_g related children
-            for (auto const &child : node->get_children())
-              res.emplace_back(child);
+            // Visit all the H_g related children
+            for (auto const &child : h_g_node->get_children())
+              visit(D_G_Node(child));
           }
-
-        return res;
       }
 
       /// Checks if either the node of H_g or H_out is not nullptr
@@ -168,11 +190,12 @@ namespace network_butcher::kfinder
       }
     };
 
-    /// Simple struct to represent an implicit path
+    /// Simple struct to represent an implicit path. It's trivially copyable (two D(G) node pointers, the pointer to the
+    /// previous path and the length), thus it's cheap to move in and out of the queue
     struct Implicit_Path_Info : Crtp_Greater<Implicit_Path_Info>
     {
-      /// The current sidetrack
-      std::optional<D_G_Node> current_sidetrack;
+      /// The current sidetrack. It's not valid if the path has no sidetracks (i.e., it's the shortest path)
+      D_G_Node current_sidetrack;
 
       /// Pointer to a previous path. The overall path is made by the concatenation of the previous path with
       /// current_sidetrack
@@ -193,7 +216,7 @@ namespace network_butcher::kfinder
       void
       compute_sidetracks(std::list<Edge_Info const *> &sidetracks) const
       {
-        if (!current_sidetrack)
+        if (!current_sidetrack.valid())
           {
             return;
           }
@@ -203,7 +226,7 @@ namespace network_butcher::kfinder
             previous_sidetracks->compute_sidetracks(sidetracks);
           }
 
-        sidetracks.push_back(&(current_sidetrack.value().get_head_content()));
+        sidetracks.push_back(&(current_sidetrack.get_head_content()));
       }
 
       /// Produce the list of sidetrack edges associated to the current path
@@ -211,7 +234,7 @@ namespace network_butcher::kfinder
       [[nodiscard]] auto
       compute_sidetracks() const -> std::list<Edge_Info const *>
       {
-        if (!current_sidetrack)
+        if (!current_sidetrack.valid())
           {
             return {};
           }
@@ -222,12 +245,151 @@ namespace network_butcher::kfinder
             previous_sidetracks->compute_sidetracks(sidetracks);
           }
 
-        sidetracks.push_back(&(current_sidetrack.value().get_head_content()));
+        sidetracks.push_back(&(current_sidetrack.get_head_content()));
 
         return sidetracks;
       }
     };
 
+    static_assert(std::is_trivially_copyable_v<Implicit_Path_Info>);
+
+    /// The state of a K shortest path search. It contains everything that is required to extract the next shortest
+    /// path: the shortest path tree, the heaps (with the arena owning their nodes), the priority queue of the D(G)
+    /// nodes and the implicit paths found so far. Since the heaps and the implicit paths point to each other, the state
+    /// can be neither copied nor moved. It's shared by the KFinder and by its enumerators: every access must be
+    /// performed while holding its mutex
+    struct Search_State
+    {
+      /// The mutex protecting the state
+      std::mutex mutex;
+
+      /// True if the heaps (and the queue) have been prepared by prepare_heaps
+      bool heaps_ready = false;
+
+      /// True if the paths are selected through bounded_queue_selection. It's fixed when the state is constructed
+      bool bounded_queue = false;
+
+      /// The graph
+      t_Weighted_Graph_Complete_Type graph;
+
+      /// The root node id
+      Node_Id_Type root;
+
+      /// The sink node id
+      Node_Id_Type sink;
+
+      /// The result of the Dijkstra algorithm (executed on the reversed graph, starting from the sink)
+      Dijkstra_Result_Type dij_res;
+
+      /// The sidetrack distances of every sidetrack edge
+      Internal_Weight_Collection_Type sidetrack_distances;
+
+      /// The arena owning the nodes of the heaps. It's declared before the heaps, so that it's destroyed after them
+      Arena_Type arena;
+
+      /// Additional arenas, used when the heaps are constructed in parallel (an arena cannot be shared among threads).
+      /// As the main arena, they are declared before the heaps
+      std::deque<Arena_Type> worker_arenas;
+
+      /// The H_out map
+      H_out_collection h_out;
+
+      /// The H_g map
+      H_g_collection h_g;
+
+      /// The (optional) callback function called every time a path is extracted (used to construct the H_gs on
+      /// demand)
+      Callback_Function callback_fun;
+
+      /// The implicit paths found so far. A deque is used since the queued paths point to its elements
+      std::deque<Implicit_Path_Info> found;
+
+      /// The queue of the candidate implicit paths
+      std::priority_queue<Implicit_Path_Info, std::vector<Implicit_Path_Info>, std::greater<>> queue;
+
+      /// Constructs the state of a search, given the shortest path tree. The heaps must be constructed by
+      /// prepare_heaps before extracting the second path
+      /// \param graph The graph
+      /// \param root The root node id
+      /// \param sink The sink node id
+      /// \param dij_res The result of the Dijkstra algorithm
+      /// \param bounded_queue True if the paths are selected through bounded_queue_selection
+      Search_State(t_Weighted_Graph_Complete_Type const &graph,
+                   Node_Id_Type                          root,
+                   Node_Id_Type                          sink,
+                   Dijkstra_Result_Type                  dij_res,
+                   bool                                  bounded_queue)
+        : bounded_queue(bounded_queue)
+        , graph(graph)
+        , root(root)
+        , sink(sink)
+        , dij_res(std::move(dij_res))
+      {}
+
+      Search_State(Search_State const &) = delete;
+
+      auto
+      operator=(Search_State const &) -> Search_State & = delete;
+    };
+
+    /// The implicit paths selected by a search
+    struct Selected_Paths
+    {
+      /// The storage of all the implicit paths generated during the selection. A deque is used since the implicit paths
+      /// point to its elements. It's empty if the paths are stored in the state of the search
+      std::deque<Implicit_Path_Info> storage;
+
+      /// The selected implicit paths (stored either in storage or in the state of the search), sorted by length
+      std::vector<Implicit_Path_Info const *> paths;
+    };
+
+    /// The enumerator of the Eppstein algorithms. It shares the state of the search with the KFinder that produced
+    /// it, but it doesn't depend on the KFinder itself. The paths already extracted by the KFinder (or by other
+    /// enumerators) are not extracted again
+    class Eppstein_Enumerator final : public Enumerator_Type
+    {
+    private:
+      /// The state of the search. If it's nullptr, there are no paths to produce
+      std::shared_ptr<Search_State> state;
+
+      /// The position (in state->found) of the next path to produce
+      std::size_t position = 0;
+
+    public:
+      /// It produces the next shortest path. O(log(k)), plus the path reconstruction
+      /// \return The next shortest path or std::nullopt if there are no more paths
+      [[nodiscard]] auto
+      next() -> std::optional<typename Enumerator_Type::Element_Type> override
+      {
+        if (!state)
+          return std::nullopt;
+
+        std::scoped_lock lock(state->mutex);
+
+        if (position == state->found.size() && next_implicit_path(*state) == nullptr)
+          return std::nullopt;
+
+        auto const &path = state->found[position++];
+
+        if constexpr (Only_Distance)
+          {
+            return path.length;
+          }
+        else
+          {
+            return explicit_path(*state, path);
+          }
+      }
+
+      /// Constructs the enumerator from the state of a search. The heaps of the state must be ready
+      /// \param state The state of the search
+      explicit Eppstein_Enumerator(std::shared_ptr<Search_State> state)
+        : state(std::move(state))
+      {}
+
+      ~Eppstein_Enumerator() override = default;
+    };
+
     /// Computes the sidetrack distances for all the different sidetrack edges
     /// \param dij_res The result of the Dijkstra algorithm
     /// \return The collection of sidetrack distances for the different edges
@@ -235,51 +397,208 @@ namespace network_butcher::kfinder
     sidetrack_distances(Dijkstra_Result_Type const &dij_res) const -> Internal_Weight_Collection_Type;
 
 
-    /// Helper function for the Eppstein algorithm. It converts a vector of implicit paths to a vector of explicit
-    /// paths
-    /// \param dij_res The result of the Dijkstra result
-    /// \param epp_res The collection of implicit paths
+    /// It produces the first deviatory path, i.e., the root of the path graph of the state. The heaps must be ready
+    /// \param state The state of the search
+    /// \return The first deviatory path or std::nullopt if there isn't any sidetrack edge
+    [[nodiscard]] static auto
+    first_deviation(Search_State &state) -> std::optional<Implicit_Path_Info>;
+
+
+    /// It produces the children of the given implicit path in the path graph: the paths obtained by replacing its last
+    /// sidetrack with one of its children in D(G) and the path obtained by adding the first sidetrack edge of the H_g
+    /// of the head of its last sidetrack. O(1), plus the construction of the H_g (if the heaps are built on demand)
+    /// \tparam Push_Function The type of the function called for every child
+    /// \param state The state of the search
+    /// \param path The implicit path. It must be stored in a stable position, since its children may point to it
+    /// \param push The function called for every child
+    template <typename Push_Function>
+    static void
+    expand(Search_State &state, Implicit_Path_Info &path, Push_Function const &push);
+
+
+    /// It extracts the next implicit path from the state of the search. The first extracted path is the shortest one.
+    /// The heaps must be ready (see prepare_heaps) to extract the other ones
+    /// \param state The state of the search
+    /// \return The next implicit path (stored in state.found) or nullptr if there are no more paths
+    static auto
+    next_implicit_path(Search_State &state) -> Implicit_Path_Info const *;
+
+
+    /// It converts an implicit path to an explicit path
+    /// \param state The state of the search
+    /// \param implicit_path The implicit path
+    /// \return The explicit path
+    [[nodiscard]] static auto
+    explicit_path(Search_State const &state, Implicit_Path_Info const &implicit_path) -> Path_Info;
+
+
+    /// Helper function for the Eppstein algorithm. It converts the given implicit paths to explicit paths
+    /// \param state The state of the search
+    /// \param implicit_paths The implicit paths to convert
     /// \return The shortest paths
     [[nodiscard]] auto
-    helper_eppstein(Dijkstra_Result_Type const &dij_res, std::vector<Implicit_Path_Info> const &epp_res) const
+    helper_eppstein(Search_State const &state, std::vector<Implicit_Path_Info const *> const &implicit_paths) const
       -> std::vector<Path_Info>;
 
 
     /// This function must be specialized by the different algorithms. It should prepare the required H_outs, H_gs
-    /// and, if needed, prepare the callback function and, finally, call the general_algo_eppstein function
-    /// \param K The number of shortest paths to compute
-    /// \param dij_res The result of the Dijkstra algorithm
-    /// \param sidetrack_distances The sidetrack distances of every sidetrack edge
-    /// \return The shortest paths (in explicit form)
-    [[nodiscard]] virtual auto
-    start(std::size_t                            K,
-          Dijkstra_Result_Type const            &dij_res,
-          Internal_Weight_Collection_Type const &sidetrack_distances) const -> Output_Type = 0;
+    /// and, if needed, the callback function, storing them in the state of the search
+    /// \param state The state of the search
+    virtual void
+    start(Search_State &state) const = 0;
+
+
+    /// It returns the cached state of the search, constructing it (i.e., executing the Dijkstra algorithm) if needed
+    /// \return The state of the search
+    [[nodiscard]] auto
+    search_state() const -> std::shared_ptr<Search_State>;
+
+
+    /// It constructs the heaps of the state (if they are not ready yet) and it pushes the first deviatory path into
+    /// the queue. The mutex of the state must be held
+    /// \param state The state of the search
+    void
+    prepare_heaps(Search_State &state) const;
+
+
+    /// The "general" structure of the Eppstein algorithms. It makes sure that the first K shortest paths (or all the
+    /// paths, if they are less than K) have been extracted from the state. Only the missing paths are extracted. The
+    /// extraction stops as soon as the next path is longer than the given limit. The mutex of the state must be held
+    /// \param K The number of shortest paths
+    /// \param state The state of the search
+    /// \param limit The maximum length of the extracted paths
+    void
+    general_algo_eppstein(std::size_t   K,
+                          Search_State &state,
+                          Weight_Type   limit = std::numeric_limits<Weight_Type>::max()) const;
+
+
+    /// It makes sure that the first K shortest paths that satisfy the given bound have been extracted from the state
+    /// (see general_algo_eppstein). The mutex of the state must be held
+    /// \param K The number of shortest paths
+    /// \param bound The upper bound on the length of the paths
+    /// \param state The state of the search
+    /// \return The number of paths (they're the first ones in state.found)
+    [[nodiscard]] auto
+    bounded_paths(std::size_t K, Length_Bound_Type const &bound, Search_State &state) const -> std::size_t;
+
+
+    /// It selects the first K shortest implicit paths of the state through the heap selection of Frederickson, instead
+    /// of extracting them one at a time from the priority queue of the state (see Heap_Selection::frederickson). The
+    /// paths found by general_algo_eppstein are neither used nor modified. The paths longer than the given limit are
+    /// pruned as soon as they're generated. The mutex of the state must be held
+    /// \param K The number of shortest paths
+    /// \param state The state of the search
+    /// \param limit The maximum length of the selected paths
+    /// \return The selected implicit paths, sorted by length
+    [[nodiscard]] auto
+    frederickson_selection(std::size_t   K,
+                           Search_State &state,
+                           Weight_Type   limit = std::numeric_limits<Weight_Type>::max()) const -> Selected_Paths;
 
 
-    /// The "general" structure of the Eppstein algorithms. It will construct the shortest paths
+    /// It selects the first K shortest implicit paths of the state through a priority queue that holds at most K - k
+    /// paths, where k is the number of paths extracted so far: when the queue is full, a new path either replaces the
+    /// longest queued path (if it's shorter) or it's discarded, since it cannot be among the first K shortest paths.
+    /// The paths found by general_algo_eppstein are neither used nor modified. The mutex of the state must be held.
+    /// O(K*log(K))
     /// \param K The number of shortest paths
-    /// \param dij_res The result of the dijkstra algorithm
-    /// \param sidetrack_distances The sidetrack distances of every edge
-    /// \param h_g The h_g map
-    /// \param h_out The h_out map
-    /// \param callback_fun A callback function called during the loop used to find the shortest paths
-    /// \return The (explicit) shortest paths
-    auto
-    general_algo_eppstein(std::size_t                            K,
-                          Dijkstra_Result_Type const            &dij_res,
-                          Internal_Weight_Collection_Type const &sidetrack_distances,
-                          H_g_collection                        &h_g,
-                          H_out_collection                      &h_out,
-                          Callback_Function const               &callback_fun = nullptr) const -> Output_Type;
+    /// \param state The state of the search
+    /// \param limit The maximum length of the selected paths
+    /// \return The selected implicit paths, sorted by length
+    [[nodiscard]] auto
+    bounded_queue_selection(std::size_t   K,
+                            Search_State &state,
+                            Weight_Type   limit = std::numeric_limits<Weight_Type>::max()) const -> Selected_Paths;
+
+
+    /// It selects the first K shortest implicit paths that satisfy the given bound, either from the cached state of
+    /// the search or through bounded_queue_selection (if the bounded queue is enabled). The mutex of the state must be
+    /// held
+    /// \param K The number of shortest paths
+    /// \param bound The upper bound on the length of the paths
+    /// \param state The state of the search
+    /// \return The selected implicit paths, sorted by length
+    [[nodiscard]] auto
+    selected_paths(std::size_t K, Length_Bound_Type const &bound, Search_State &state) const -> Selected_Paths;
+
+  private:
+    /// The mutex protecting cached_state and bounded_queue
+    mutable std::mutex cache_mutex;
+
+    /// The state of the search, cached among the different calls
+    mutable std::shared_ptr<Search_State> cached_state;
+
+    /// True if compute, compute_bounded, compute_lengths, compute_paths and compute_path_trie use a bounded queue
+    /// (see bounded_queue_selection). It's copied in the state of the search when it's constructed
+    bool bounded_queue = false;
 
   public:
-    /// Applies a K-shortest path algorithm to find the k-shortest paths on the given graph (from the root to the sink)
+    /// Applies a K-shortest path algorithm to find the k-shortest paths on the given graph (from the root to the sink).
+    /// The state of the search is cached: a following call with a greater K will only extract the missing paths
     /// \param K The number of shortest paths to find
     /// \return The shortest paths
     [[nodiscard]] auto
     compute(std::size_t K) const -> Output_Type override;
 
+    /// Applies a K-shortest path algorithm to find the k-shortest paths whose length doesn't exceed the given bound.
+    /// The extraction stops as soon as the top of the queue exceeds the bound. The state of the search is cached, as
+    /// in compute
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute_bounded(std::size_t K, Length_Bound_Type const &bound) const -> Output_Type override;
+
+    /// It finds the lengths of the k-shortest paths, independently of Only_Distance. It shares the cached state of the
+    /// search with compute
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths (by default, the length is not bounded)
+    /// \return The lengths of the shortest paths
+    [[nodiscard]] auto
+    compute_lengths(std::size_t K, Length_Bound_Type const &bound = Length_Bound_Type()) const
+      -> std::vector<Weight_Type>;
+
+    /// It finds the k-shortest paths, independently of Only_Distance. It shares the cached state of the search with
+    /// compute
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths (by default, the length is not bounded)
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute_paths(std::size_t K, Length_Bound_Type const &bound = Length_Bound_Type()) const -> std::vector<Path_Info>;
+
+    /// It finds the k-shortest paths, independently of Only_Distance, as a compact collection. The sidetrack edges of
+    /// the implicit paths are stored once (the implicit paths already share their prefixes) and the shortest path tree
+    /// is shared with the cached state of the search, that is kept alive by the collection
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths (by default, the length is not bounded)
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute_path_trie(std::size_t K, Length_Bound_Type const &bound = Length_Bound_Type()) const
+      -> Path_Trie_Type override;
+
+    /// It returns an enumerator that produces the shortest paths one at a time, in nondecreasing order of length. The
+    /// enumerator shares the cached state of the search with the KFinder: the paths that have been already found are
+    /// not computed again
+    /// \return The enumerator
+    [[nodiscard]] auto
+    enumerate() const -> std::unique_ptr<Enumerator_Type> override;
+
+    /// It drops the cached state of the search. It must be called if the graph has been modified after the first
+    /// search. The enumerators that have been already produced are not affected
+    void
+    reset() const;
+
+    /// It enables (or disables) the bounded queue. If it's enabled, the paths are selected through a priority queue
+    /// that never holds more paths than the ones that are still missing: the queue of a search requires up to K
+    /// entries, instead of up to 3*K. The paths are not cached, thus every call performs the search from scratch
+    /// (the heaps are still cached). If the mode changes, the cached state of the search is dropped (as in reset), so
+    /// that a state is never shared by the two modes. It can be called concurrently with the searches: the searches
+    /// already started keep their mode. The enumerators are not affected
+    /// \param enabled True to enable the bounded queue
+    void
+    set_bounded_queue(bool enabled);
+
     /// Base class for Eppstein and Lazy Eppstein
     /// \param g The graph
     /// \param root The root node id
@@ -303,151 +622,491 @@ namespace network_butcher::kfinder
   auto
   Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute(std::size_t K) const
     -> Output_Type
+  {
+    return compute_bounded(K, Length_Bound_Type());
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_bounded(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> Output_Type
+  {
+    if constexpr (Only_Distance)
+      {
+        return compute_lengths(K, bound);
+      }
+    else
+      {
+        return compute_paths(K, bound);
+      }
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_lengths(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> std::vector<Weight_Type>
   {
     if (graph.empty() || K == 0)
       return {};
 
-    auto const dij_res = Shortest_path_finder::dijkstra(graph.reverse(), sink);
+    auto const state = search_state();
+
+    std::scoped_lock lock(state->mutex);
+    auto const selected = selected_paths(K, bound, *state);
+
+    std::vector<Weight_Type> res;
+    res.reserve(selected.paths.size());
 
-    // If the shortest path doesn't exist, then we can return an empty vector
-    if (dij_res.second[root] == std::numeric_limits<Weight_Type>::max())
+    for (auto const &path : selected.paths)
+      res.push_back(path->length);
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_paths(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> std::vector<Path_Info>
+  {
+    if (graph.empty() || K == 0)
       return {};
 
-    if (K == 1)
+    auto const state = search_state();
+
+    std::scoped_lock lock(state->mutex);
+    auto const selected = selected_paths(K, bound, *state);
+
+    // O(Path_reconstruction)
+    return helper_eppstein(*state, selected.paths);
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_path_trie(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> Path_Trie_Type
+  {
+    if (graph.empty() || K == 0)
+      return {};
+
+    auto const state = search_state();
+
+    std::scoped_lock lock(state->mutex);
+    auto const selected = selected_paths(K, bound, *state);
+
+    // The successors are owned by the state: the aliasing constructor keeps the state alive
+    Path_Trie_Type res(std::shared_ptr<std::vector<Node_Id_Type> const>(state, &state->dij_res.first), root, sink);
+
+    // The position in the trie of the last sidetrack of every implicit path that has been inserted
+    std::unordered_map<Implicit_Path_Info const *, std::size_t> positions;
+    std::vector<Implicit_Path_Info const *>                     to_insert;
+
+    for (auto const *path : selected.paths)
       {
-        if constexpr (Only_Distance)
-          {
-            return {dij_res.second[root]};
-          }
-        else
+        // Go back until an implicit path that has been already inserted (or the shortest path) is found
+        Implicit_Path_Info const *current = path;
+        for (; current != nullptr && current->current_sidetrack.valid() && !positions.contains(current);
+             current = current->previous_sidetracks)
+          to_insert.push_back(current);
+
+        auto parent = current != nullptr && current->current_sidetrack.valid() ? positions[current] :
+                                                                                 Path_Trie_Type::No_Sidetrack;
+
+        // Insert the missing sidetracks, starting from the first one
+        for (auto it = to_insert.crbegin(); it != to_insert.crend(); ++it)
           {
-            return {Shortest_path_finder::shortest_path_finder(graph, dij_res, root, sink)};
+            parent = res.add_sidetrack((*it)->current_sidetrack.get_head_content().edge, parent);
+            positions.emplace(*it, parent);
           }
+
+        to_insert.clear();
+        res.add_path(path->length, parent);
       }
 
-    return start(K, dij_res, sidetrack_distances(dij_res));
+    return res;
   }
 
 
   template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
   auto
-  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::general_algo_eppstein(
-    std::size_t                               K,
-    Dijkstra_Result_Type const               &dij_res,
-    Internal_Weight_Collection_Type const    &sidetrack_distances,
-    H_g_collection                           &h_g,
-    H_out_collection                         &h_out,
-    const Basic_KEppstein::Callback_Function &callback_fun) const -> Output_Type
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::enumerate() const
+    -> std::unique_ptr<Enumerator_Type>
   {
-    auto const &[successors, shortest_distance] = dij_res;
+    if (graph.empty())
+      return std::make_unique<Eppstein_Enumerator>(nullptr);
 
-    // Start with the shortest path
-    std::vector<Implicit_Path_Info> res;
-    res.push_back(Implicit_Path_Info{.current_sidetrack   = std::optional<D_G_Node>(),
-                                     .previous_sidetracks = nullptr,
-                                     .length              = shortest_distance[root]});
+    auto state = search_state();
 
-    // Find the first sidetrack edge
-    typename H_g_collection::const_iterator h_g_it = h_g.find(root);
+    {
+      std::scoped_lock lock(state->mutex);
+      prepare_heaps(*state);
+    }
+
+    return std::make_unique<Eppstein_Enumerator>(std::move(state));
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  void
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::reset() const
+  {
+    std::scoped_lock lock(cache_mutex);
+    cached_state.reset();
+  }
 
-    if (h_g_it->second.empty())
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  void
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::set_bounded_queue(bool enabled)
+  {
+    std::scoped_lock lock(cache_mutex);
+
+    if (bounded_queue != enabled)
       {
-        if constexpr (Only_Distance)
-          {
-            return {shortest_distance[root]};
-          }
-        else
-          {
-            return {Shortest_path_finder::shortest_path_finder(Parent_Type::graph, dij_res, root, Parent_Type::sink)};
-          }
+        bounded_queue = enabled;
+        cached_state.reset();
+      }
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::search_state() const
+    -> std::shared_ptr<Search_State>
+  {
+    std::scoped_lock lock(cache_mutex);
+
+    if (!cached_state)
+      {
+        auto dij_res = Shortest_path_finder::shortest_path_tree(graph.reverse(), sink);
+        cached_state = std::make_shared<Search_State>(graph, root, sink, std::move(dij_res), bounded_queue);
       }
 
-    res.reserve(K);
+    return cached_state;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  void
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::prepare_heaps(Search_State &state) const
+  {
+    if (state.heaps_ready)
+      return;
+
+    state.heaps_ready = true;
 
-    // Collection of "final" implicit paths to be added to res
-    std::vector<Implicit_Path_Info> tmp_vect_queue;
-    tmp_vect_queue.reserve(K);
-    std::priority_queue<Implicit_Path_Info, std::vector<Implicit_Path_Info>, std::greater<>> Q(
-      std::greater<>(), std::move(tmp_vect_queue));
+    auto const &shortest_distance = state.dij_res.second;
 
+    // If the shortest path doesn't exist, then there are no heaps to construct
+    if (shortest_distance[root] == std::numeric_limits<Weight_Type>::max())
+      return;
+
+    state.sidetrack_distances = sidetrack_distances(state.dij_res);
+    start(state);
 
     // First deviatory path
-    D_G_Node first_side_track(h_g_it);
-    Q.push(Implicit_Path_Info{.current_sidetrack   = first_side_track,
+    if (auto first = first_deviation(state); first)
+      state.queue.push(std::move(first.value()));
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::first_deviation(Search_State &state)
+    -> std::optional<Implicit_Path_Info>
+  {
+    // Find the first sidetrack edge
+    auto const &h_g = state.h_g[state.root].value();
+
+    if (h_g.empty())
+      return std::nullopt;
+
+    D_G_Node first_side_track(h_g);
+    return Implicit_Path_Info{.current_sidetrack   = first_side_track,
                               .previous_sidetracks = nullptr,
-                              .length = first_side_track.get_head_content().delta_weight + shortest_distance[root]});
+                              .length              = first_side_track.get_head_content().delta_weight +
+                                        state.dij_res.second[state.root]};
+  }
 
 
-    std::size_t k = 2;
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::frederickson_selection(
+    std::size_t   K,
+    Search_State &state,
+    Weight_Type   limit) const -> Selected_Paths
+  {
+    Selected_Paths res;
 
-    // Loop through Q until either Q is empty, or the number of paths found is K
-    for (; k <= K && !Q.empty(); ++k)
-      {
-        res.emplace_back(Q.top());
-        Q.pop();
+    auto const &shortest_distance = state.dij_res.second;
 
-        auto const &SK                 = res.back();
-        auto const &current_sidetrack  = SK.current_sidetrack.value();
-        auto const &[e_edge, e_weight] = current_sidetrack.get_head_content();
+    if (K == 0 || shortest_distance[root] == std::numeric_limits<Weight_Type>::max() || shortest_distance[root] > limit)
+      return res;
 
-        // "Helper" function that can be called if needed
-        if (callback_fun != nullptr)
-          {
-            h_g_it = callback_fun(h_g, h_out, sidetrack_distances, successors, e_edge.second, graph);
-          }
-        else
-          {
-            h_g_it = h_g.find(e_edge.second);
-          }
+    res.paths.reserve(K);
+    res.paths.push_back(&res.storage.emplace_back(Implicit_Path_Info{.current_sidetrack   = D_G_Node(),
+                                                                     .previous_sidetracks = nullptr,
+                                                                     .length = shortest_distance[root]}));
 
-        if (!h_g_it->second.empty())
-          {
-            // Extract the first sidetrack edge if it exists
-            D_G_Node f(h_g_it);
-            Q.push(Implicit_Path_Info{.current_sidetrack   = f,
-                                      .previous_sidetracks = &res.back(),
-                                      .length = SK.length + f.get_head_content().delta_weight}); // O(log(K)
-          }
+    if (K == 1)
+      return res;
 
-        // O(1), there are up tp 3 elements in this collection
-        for (auto const &sidetrack_edge : current_sidetrack.get_children())
-          {
-            Q.push(Implicit_Path_Info{.current_sidetrack   = sidetrack_edge,
-                                      .previous_sidetracks = SK.previous_sidetracks,
-                                      .length = SK.length + sidetrack_edge.get_head_content().delta_weight -
-                                                e_weight}); // O(log(K))
-          }
+    prepare_heaps(state);
+
+    auto first = first_deviation(state);
+    if (!first || first->length > limit)
+      return res;
+
+    auto &storage = res.storage;
+
+    // The path graph is heap-ordered: every path is not shorter than its parent
+    auto const selected = Heap_Selection::frederickson(
+      &storage.emplace_back(std::move(first.value())),
+      K - 1,
+      [](Implicit_Path_Info *path) { return path->length; },
+      [&state, &storage, limit](Implicit_Path_Info *path, auto const &push) {
+        // The children longer than the limit (and their descendants) are never generated
+        expand(state, *path, [&storage, &push, limit](Implicit_Path_Info const &child) {
+          if (child.length <= limit)
+            push(&storage.emplace_back(child));
+        });
+      }); // O(K*log(log(K))), plus the sorting
+
+    res.paths.insert(res.paths.end(), selected.cbegin(), selected.cend());
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  void
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::general_algo_eppstein(
+    std::size_t   K,
+    Search_State &state,
+    Weight_Type   limit) const
+  {
+    // The shortest path doesn't require the heaps
+    if (K > 1)
+      prepare_heaps(state);
+
+    auto const &found = state.found;
+    auto const &queue = state.queue;
+
+    // The paths are extracted in nondecreasing order of length: the top of the queue is the next one
+    auto const within_limit = [&found, &queue, limit]() {
+      return found.empty() || queue.empty() || queue.top().length <= limit;
+    };
+
+    // Loop until either there are no more paths, the number of paths found is K or the next path exceeds the limit.
+    // O((K - k)*log(K))
+    while (state.found.size() < K && within_limit() && next_implicit_path(state) != nullptr)
+      ;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::bounded_paths(
+    std::size_t              K,
+    Length_Bound_Type const &bound,
+    Search_State            &state) const -> std::size_t
+  {
+    auto const limit = bound.limit(state.dij_res.second[root]);
+    general_algo_eppstein(K, state, limit);
+
+    // The found paths are sorted by length. Some of them may exceed the limit (e.g., if they were extracted by a
+    // previous search with a looser bound)
+    auto const begin = state.found.cbegin();
+    auto const end   = std::next(begin, std::min(K, state.found.size()));
+
+    return std::distance(
+      begin, std::partition_point(begin, end, [limit](auto const &path) { return path.length <= limit; }));
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::bounded_queue_selection(
+    std::size_t   K,
+    Search_State &state,
+    Weight_Type   limit) const -> Selected_Paths
+  {
+    Selected_Paths res;
+
+    auto const &shortest_distance = state.dij_res.second;
+
+    if (K == 0 || shortest_distance[root] == std::numeric_limits<Weight_Type>::max() || shortest_distance[root] > limit)
+      return res;
+
+    auto &storage = res.storage;
+    auto &paths   = res.paths;
+
+    paths.reserve(K);
+    paths.push_back(&storage.emplace_back(Implicit_Path_Info{.current_sidetrack   = D_G_Node(),
+                                                             .previous_sidetracks = nullptr,
+                                                             .length              = shortest_distance[root]}));
+
+    if (K == 1)
+      return res;
+
+    prepare_heaps(state);
+
+    auto first = first_deviation(state);
+    if (!first || first->length > limit)
+      return res;
+
+    Min_Max_Heap<Implicit_Path_Info> queue;
+    queue.reserve(K - 1);
+    queue.push(std::move(first.value()));
+
+    // Every queued path is not longer than the discarded ones (and their descendants): if the queue holds the number
+    // of missing paths, the missing paths are either in the queue or shorter than the longest queued path
+    auto const push = [&queue, &paths, K, limit](Implicit_Path_Info const &child) {
+      if (child.length > limit)
+        return;
+
+      if (queue.size() < K - paths.size())
+        {
+          queue.push(child);
+        }
+      else if (child < queue.max())
+        {
+          queue.pop_max();
+          queue.push(child);
+        }
+    };
+
+    // O(K*log(K))
+    while (paths.size() < K && !queue.empty())
+      {
+        auto &SK = storage.emplace_back(queue.min());
+        queue.pop_min();
+        paths.push_back(&SK);
+
+        // After the extraction, the queue holds at most K - |paths| paths
+        if (paths.size() < K)
+          expand(state, SK, push);
       }
 
-    if constexpr (Only_Distance)
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::selected_paths(
+    std::size_t              K,
+    Length_Bound_Type const &bound,
+    Search_State            &state) const -> Selected_Paths
+  {
+    if (state.bounded_queue)
+      return bounded_queue_selection(K, state, bound.limit(state.dij_res.second[root]));
+
+    Selected_Paths res;
+
+    auto const num_paths = bounded_paths(K, bound, state);
+    res.paths.reserve(num_paths);
+
+    for (auto const &path : state.found | std::views::take(num_paths))
+      res.paths.push_back(&path);
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::next_implicit_path(Search_State &state)
+    -> Implicit_Path_Info const *
+  {
+    auto const &shortest_distance = state.dij_res.second;
+
+    auto &found = state.found;
+    auto &queue = state.queue;
+
+    // Start with the shortest path
+    if (found.empty())
       {
-        std::vector<Weight_Type> final_res;
-        final_res.reserve(res.size());
+        if (shortest_distance[state.root] == std::numeric_limits<Weight_Type>::max())
+          return nullptr;
+
+        // The first deviatory path is pushed into the queue by prepare_heaps
+        return &found.emplace_back(Implicit_Path_Info{.current_sidetrack   = D_G_Node(),
+                                                      .previous_sidetracks = nullptr,
+                                                      .length              = shortest_distance[state.root]});
+      }
+
+    if (queue.empty())
+      return nullptr;
+
+    auto &SK = found.emplace_back(queue.top());
+    queue.pop();
+
+    expand(state, SK, [&queue](Implicit_Path_Info const &child) { queue.push(child); }); // O(log(K))
+
+    return &SK;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  template <typename Push_Function>
+  void
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::expand(Search_State       &state,
+                                                                                    Implicit_Path_Info &path,
+                                                                                    Push_Function const &push)
+  {
+    auto const &successors = state.dij_res.first;
+
+    auto const &current_sidetrack  = path.current_sidetrack;
+    auto const &[e_edge, e_weight] = current_sidetrack.get_head_content();
 
-        for (auto const &path : res)
-          final_res.push_back(path.length);
+    H_g_Heap_Type const *h_g;
 
-        return final_res;
+    // "Helper" function that can be called if needed
+    if (state.callback_fun != nullptr)
+      {
+        h_g = state.callback_fun(
+          state.h_g, state.h_out, state.sidetrack_distances, successors, e_edge.second, state.graph);
       }
     else
       {
-        return helper_eppstein(dij_res, res);
+        h_g = &state.h_g[e_edge.second].value();
       }
+
+    if (!h_g->empty())
+      {
+        // Extract the first sidetrack edge if it exists
+        D_G_Node f(*h_g);
+        push(Implicit_Path_Info{.current_sidetrack   = f,
+                                .previous_sidetracks = &path,
+                                .length              = path.length + f.get_head_content().delta_weight});
+      }
+
+    // O(1), there are up to 3 children
+    current_sidetrack.for_each_child([&path, &push, &e_weight](D_G_Node const &sidetrack_edge) {
+      push(Implicit_Path_Info{.current_sidetrack   = sidetrack_edge,
+                              .previous_sidetracks = path.previous_sidetracks,
+                              .length = path.length + sidetrack_edge.get_head_content().delta_weight - e_weight});
+    });
   }
 
 
   template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
   auto
-  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::helper_eppstein(
-    Dijkstra_Result_Type const            &dij_res,
-    std::vector<Implicit_Path_Info> const &epp_res) const -> std::vector<Path_Info>
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::explicit_path(
+    Search_State const       &state,
+    Implicit_Path_Info const &implicit_path) -> Path_Info
   {
-    auto const &root = Parent_Type::root;
-    auto const &sink = Parent_Type::sink;
-
-    auto const &successors = dij_res.first;
-
-    std::vector<Path_Info> res(epp_res.size());
+    auto const &root       = state.root;
+    auto const &sink       = state.sink;
+    auto const &successors = state.dij_res.first;
 
     auto const go_shortest = [&successors, sink](Node_Id_Type node) {
       std::vector<Node_Id_Type> final_steps;
@@ -461,70 +1120,83 @@ namespace network_butcher::kfinder
       return final_steps;
     };
 
+    Path_Info   info;
+    auto const &sidetracks = implicit_path.compute_sidetracks();
+
+    info.length = implicit_path.length;
 
     // Basically, we start from the specified node and go along the shortest path until we meet a sidetrack edge
     // contained in the implicit path. In that case, we add the sidetrack edge and proceed along the "new" shortest
     // path until either the "sink" node is reached or another sidetrack edge is met
-    auto const process_path =
-      [&go_shortest, &dij_res = dij_res, &res = res, &epp_res = epp_res, &root, &sink](std::size_t i) {
-        auto const &implicit_path = epp_res[i];
-
-        auto       &info       = res[i];
-        auto const &sidetracks = implicit_path.compute_sidetracks();
+    if (sidetracks.empty())
+      {
+        info.path = go_shortest(root);
+      }
+    else
+      {
+        auto sidetrack_edge_it = sidetracks.cbegin();
 
-        info.length = implicit_path.length;
+        auto [first, second]       = (*sidetrack_edge_it)->edge;
+        std::size_t node_to_insert = root;
 
-        if (sidetracks.empty())
+        while (node_to_insert != sink)
           {
-            info.path = go_shortest(root);
-          }
-        else
-          {
-            auto sidetrack_edge_it = sidetracks.cbegin();
-
-            auto [first, second]       = (*sidetrack_edge_it)->edge;
-            std::size_t node_to_insert = root;
-
-            while (node_to_insert != sink)
+            info.path.push_back(node_to_insert);
+            if (first == node_to_insert)
               {
-                info.path.push_back(node_to_insert);
-                if (first == node_to_insert)
+                node_to_insert = second;
+                ++sidetrack_edge_it;
+
+                if (sidetrack_edge_it == sidetracks.cend())
                   {
-                    node_to_insert = second;
-                    ++sidetrack_edge_it;
-
-                    if (sidetrack_edge_it == sidetracks.cend())
-                      {
-                        auto to_insert = go_shortest(node_to_insert);
-                        info.path.insert(info.path.end(),
-                                         std::make_move_iterator(to_insert.begin()),
-                                         std::make_move_iterator(to_insert.end()));
-
-                        break;
-                      }
-
-                    auto tmp = (*sidetrack_edge_it)->edge;
-                    first    = tmp.first;
-                    second   = tmp.second;
+                    auto to_insert = go_shortest(node_to_insert);
+                    info.path.insert(info.path.end(),
+                                     std::make_move_iterator(to_insert.begin()),
+                                     std::make_move_iterator(to_insert.end()));
+
+                    break;
                   }
-                else
-                  node_to_insert = dij_res.first[node_to_insert];
+
+                auto tmp = (*sidetrack_edge_it)->edge;
+                first    = tmp.first;
+                second   = tmp.second;
               }
+            else
+              node_to_insert = successors[node_to_insert];
           }
-      };
+      }
+
+    return info;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  Basic_KEppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::helper_eppstein(
+    Search_State const                            &state,
+    std::vector<Implicit_Path_Info const *> const &implicit_paths) const -> std::vector<Path_Info>
+  {
+    auto const num_paths = implicit_paths.size();
+
+    std::vector<Path_Info> res(num_paths);
+
+    auto const process_path = [&state, &implicit_paths, &res](std::size_t i) {
+      res[i] = explicit_path(state, *implicit_paths[i]);
+    };
+
 #if NETWORK_BUTCHER_PARALLEL_TBB
     // https://stackoverflow.com/a/63340360 .
     // Tested views, but they are slower, so they are not used.
 
-    std::vector<std::size_t> v(epp_res.size());
+    std::vector<std::size_t> v(num_paths);
     std::generate(v.begin(), v.end(), [n = 0]() mutable { return n++; });
 
     std::for_each(std::execution::par, v.begin(), v.end(), process_path);
 #else
-#  pragma omp parallel default(none) shared(go_shortest, dij_res, res, epp_res, root, sink, process_path)
+#  pragma omp parallel default(none) shared(num_paths, process_path)
     {
 #  pragma omp for
-      for (std::size_t i = 0; i < epp_res.size(); ++i)
+      for (std::size_t i = 0; i < num_paths; ++i)
         {
           process_path(i);
         }
@@ -556,26 +1228,22 @@ namespace network_butcher::kfinder
             if (distances_from_sink[head] == std::numeric_limits<Weight_Type>::max())
               continue;
 
+            // The weights are a view of the ones stored in the graph (sorted in ascending order): no copy is made
             auto const  edge    = std::make_pair(tail, head);
             auto const &weights = graph.get_weight(edge);
 
             // If it is its successor...
             if (successors[tail] == head)
               {
-                // ...and it has more than one weight, then we have to consider the edge with the smallest weight as the
-                // edge in the shortest path tree, while the other ones will be sidetrack edges.
-                if (weights.size() > 1)
+                // ...then we have to consider the edge with the smallest weight as the edge in the shortest path tree,
+                // while the other ones (if any) will be sidetrack edges.
+                for (auto it = std::next(std::cbegin(weights)); it != std::cend(weights); ++it)
                   {
-                    bool found = false;
-
-                    for (auto it = ++weights.cbegin(); it != weights.cend(); ++it)
-                      {
-                        auto const &weight = *it;
+                    auto const &weight = *it;
 
-                        res[tail].emplace_hint(res[tail].cend(),
-                                               head,
-                                               weight + distances_from_sink[head] - distances_from_sink[tail]); // O(1)}
-                      }
+                    res[tail].emplace_hint(res[tail].cend(),
+                                           head,
+                                           weight + distances_from_sink[head] - distances_from_sink[tail]); // O(1)
                   }
               }
             else
@@ -0,0 +1,343 @@
+#ifndef NETWORK_BUTCHER_CSR_WEIGHTED_GRAPH_H
+#define NETWORK_BUTCHER_CSR_WEIGHTED_GRAPH_H
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <network_butcher/K-shortest_path/weighted_graph.h>
+#include <network_butcher/Traits/traits.h>
+#include <network_butcher/utilities.h>
+
+namespace network_butcher::kfinder
+{
+  /// Tag type used to select the compressed sparse row (CSR) specialization of Weighted_Graph. The CSR graph is a
+  /// frozen snapshot of the topology and of the weights exposed by the provided Weighted_Graph: changes applied to the
+  /// original graph after the construction of the CSR graph will not be visible.
+  /// \tparam t_Source_Weighted_Graph The (non-reversed) Weighted_Graph used to build the CSR arrays
+  template <Valid_Weighted_Graph t_Source_Weighted_Graph>
+  struct Csr_Graph
+  {
+    /// Alias for the Weighted_Graph used to build the CSR arrays
+    using Source_Weighted_Graph_Type = t_Source_Weighted_Graph;
+
+    /// Alias for the graph proxied by the source Weighted_Graph
+    using Source_Graph_Type = typename t_Source_Weighted_Graph::Graph_Type;
+
+    /// Alias for the node type
+    using Node_Type = typename t_Source_Weighted_Graph::Node_Type;
+
+    /// Alias for the node collection type
+    using Node_Collection_Type = typename t_Source_Weighted_Graph::Node_Collection_Type;
+
+    /// Alias for the weight type
+    using Weight_Type = typename t_Source_Weighted_Graph::Weight_Type;
+  };
+
+
+  /// The CSR graph preserves the node ids of the source graph
+  /// \tparam t_Source_Weighted_Graph The (non-reversed) Weighted_Graph used to build the CSR arrays
+  template <Valid_Weighted_Graph t_Source_Weighted_Graph>
+  struct Topologically_Sorted_Graph<Csr_Graph<t_Source_Weighted_Graph>>
+    : Topologically_Sorted_Graph<typename t_Source_Weighted_Graph::Graph_Type>
+  {};
+
+
+  /// Simple struct storing the adjacency of a graph in the CSR format. The neighbours of node i are stored in
+  /// neighbours[node_offsets[i], node_offsets[i + 1]) in ascending order. The weights of the j-th stored edge are
+  /// stored in weights[weight_offsets[j], weight_offsets[j + 1]) in ascending order (there may be more than one weight
+  /// if the graph has parallel edges)
+  /// \tparam Weight_Type The weight type
+  template <typename Weight_Type>
+  struct Csr_Adjacency
+  {
+    /// The offsets of the neighbours of every node (size N+1)
+    std::vector<std::size_t> node_offsets;
+
+    /// The (concatenated) neighbours of every node
+    std::vector<Node_Id_Type> neighbours;
+
+    /// The offsets of the weights of every stored edge (size |neighbours|+1)
+    std::vector<std::size_t> weight_offsets;
+
+    /// The (concatenated) weights of every stored edge
+    std::vector<Weight_Type> weights;
+
+    /// It builds the CSR adjacency from the given Weighted_Graph. O(N+E)
+    /// \param graph The graph
+    /// \return The CSR adjacency
+    template <Valid_Weighted_Graph v_Weighted_Graph>
+    static auto
+    build(v_Weighted_Graph const &graph) -> Csr_Adjacency
+    {
+      Csr_Adjacency res;
+      auto const    num_nodes = graph.size();
+
+      res.node_offsets.reserve(num_nodes + 1);
+      res.node_offsets.push_back(0);
+      res.weight_offsets.push_back(0);
+
+      for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+        {
+          for (auto const &head : graph.get_output_nodes(tail))
+            {
+              auto const &edge_weights = graph.get_weight(std::make_pair(tail, head));
+              auto const  begin        = res.weights.size();
+
+              res.neighbours.push_back(head);
+              res.weights.insert(res.weights.end(), std::cbegin(edge_weights), std::cend(edge_weights));
+
+              // Parallel weights must be sorted, so that the first one is always the smallest one
+              std::sort(std::next(res.weights.begin(), begin), res.weights.end());
+              res.weight_offsets.push_back(res.weights.size());
+            }
+
+          res.node_offsets.push_back(res.neighbours.size());
+        }
+
+      return res;
+    }
+  };
+
+
+  /// Simple struct holding the forward and the reverse CSR adjacency of a graph
+  /// \tparam Weight_Type The weight type
+  template <typename Weight_Type>
+  struct Csr_Storage
+  {
+    /// The adjacency of the graph
+    Csr_Adjacency<Weight_Type> forward;
+
+    /// The adjacency of the reversed graph
+    Csr_Adjacency<Weight_Type> backward;
+  };
+
+
+  /// Specialization of Weighted_Graph backed by contiguous CSR arrays. Both the forward and the reverse adjacency are
+  /// stored, so that reverse() is O(1) and both directions can be visited without any tree lookup. The arrays are
+  /// shared among copies and reversed graphs.
+  /// \tparam t_Source_Weighted_Graph The (non-reversed) Weighted_Graph used to build the CSR arrays
+  /// \tparam t_Reversed If the resulting graph is reversed
+  template <Valid_Weighted_Graph t_Source_Weighted_Graph, bool t_Reversed>
+  class Weighted_Graph<Csr_Graph<t_Source_Weighted_Graph>,
+                       t_Reversed,
+                       typename t_Source_Weighted_Graph::Node_Type,
+                       typename t_Source_Weighted_Graph::Node_Collection_Type,
+                       typename t_Source_Weighted_Graph::Weight_Type> : Base_Weighted_Graph
+  {
+  public:
+    /// Alias for the weight type
+    using Weight_Type = typename t_Source_Weighted_Graph::Weight_Type;
+
+    /// Alias for the edge type
+    using Edge_Type = std::pair<Node_Id_Type, Node_Id_Type>;
+
+    /// Alias for the graph type
+    using Graph_Type = Csr_Graph<t_Source_Weighted_Graph>;
+
+    /// Alias for the weights of a pair of nodes (sorted in ascending order)
+    using Weight_Edge_Type = std::span<Weight_Type const>;
+
+    /// Alias for the node type
+    using Node_Type = typename t_Source_Weighted_Graph::Node_Type;
+
+    /// Alias for the node collection type
+    using Node_Collection_Type = typename t_Source_Weighted_Graph::Node_Collection_Type;
+
+  private:
+    /// Alias for the CSR adjacency type
+    using Adjacency_Type = Csr_Adjacency<Weight_Type>;
+
+    /// Alias for the CSR storage type (shared with the reversed graph)
+    using Storage = Csr_Storage<Weight_Type>;
+
+    /// Alias for the reversed graph type
+    using Reversed_Type = Weighted_Graph<Graph_Type, !t_Reversed, Node_Type, Node_Collection_Type, Weight_Type>;
+
+    friend Reversed_Type;
+
+    /// The source graph. Used only to access the nodes
+    t_Source_Weighted_Graph source;
+
+    /// The CSR arrays
+    std::shared_ptr<Storage const> storage;
+
+    /// It returns the adjacency related to the direction of the current graph
+    /// \return The adjacency
+    [[nodiscard]] auto
+    adjacency() const -> Adjacency_Type const &
+    {
+      if constexpr (t_Reversed)
+        {
+          return storage->backward;
+        }
+      else
+        {
+          return storage->forward;
+        }
+    }
+
+    /// Builds the CSR arrays from the provided source graph. O(N+E)
+    /// \param g The source graph
+    /// \return The CSR arrays
+    static auto
+    build_storage(t_Source_Weighted_Graph const &g) -> std::shared_ptr<Storage const>
+    {
+      return std::make_shared<Storage const>(Storage{Adjacency_Type::build(g), Adjacency_Type::build(g.reverse())});
+    }
+
+    /// Constructs a graph sharing the CSR arrays with another one
+    /// \param g The source graph
+    /// \param s The CSR arrays
+    explicit Weighted_Graph(t_Source_Weighted_Graph const &g, std::shared_ptr<Storage const> s)
+      : Base_Weighted_Graph()
+      , source(g)
+      , storage(std::move(s))
+    {}
+
+    /// It returns the position of the edge in the CSR arrays. It throws if the edge doesn't exist
+    /// \param edge The edge
+    /// \return The position of the edge
+    [[nodiscard]] auto
+    find_edge(Edge_Type const &edge) const -> std::size_t
+    {
+      auto const &adj   = adjacency();
+      auto const  begin = std::next(adj.neighbours.cbegin(), adj.node_offsets[edge.first]);
+      auto const  end   = std::next(adj.neighbours.cbegin(), adj.node_offsets[edge.first + 1]);
+      auto const  it    = std::lower_bound(begin, end, edge.second); // O(log(deg))
+
+      if (it == end || *it != edge.second)
+        {
+          throw std::runtime_error("Weighted_Graph<Csr_Graph>::get_weight : the edge " +
+                                   Utilities::custom_to_string(edge) + " does not exist");
+        }
+
+      return it - adj.neighbours.cbegin();
+    }
+
+  public:
+    /// It returns the weight(s) of the edge, sorted in ascending order
+    /// \param edge The edge
+    /// \return The weight(s) of the edge
+    [[nodiscard]] auto
+    get_weight(Edge_Type const &edge) const -> Weight_Edge_Type
+    {
+      auto const &adj = adjacency();
+      auto const  pos = find_edge(edge);
+
+      return Weight_Edge_Type(adj.weights.data() + adj.weight_offsets[pos],
+                              adj.weight_offsets[pos + 1] - adj.weight_offsets[pos]);
+    }
+
+    /// It returns the smallest weight of the edge
+    /// \param edge The edge
+    /// \return The smallest weight of the edge
+    [[nodiscard]] auto
+    min_weight(Edge_Type const &edge) const -> Weight_Type
+    {
+      return adjacency().weights[adjacency().weight_offsets[find_edge(edge)]];
+    }
+
+    /// It returns the number of nodes
+    /// \return The number of nodes
+    [[nodiscard]] auto
+    size() const -> std::size_t
+    {
+      return adjacency().node_offsets.size() - 1;
+    }
+
+    /// It returns whether the graph is empty
+    /// \return Whether the graph is empty
+    [[nodiscard]] auto
+    empty() const -> bool
+    {
+      return size() == 0;
+    }
+
+    /// It returns the out neighbours of the node with the given id (in ascending order)
+    /// \param id The id of the node
+    /// \return The contiguous range of neighbours
+    [[nodiscard]] auto
+    get_output_nodes(Node_Id_Type const &id) const -> std::span<Node_Id_Type const>
+    {
+      auto const &adj = adjacency();
+      return {adj.neighbours.data() + adj.node_offsets[id], adj.node_offsets[id + 1] - adj.node_offsets[id]};
+    }
+
+    /// It returns the node with the specified id
+    /// \param id The id of the node
+    /// \return The node
+    auto
+    operator[](Node_Id_Type const &id) const -> Node_Type const &
+    {
+      return source[id];
+    }
+
+    [[nodiscard]] auto
+    cbegin() const
+    {
+      return source.cbegin();
+    }
+
+    [[nodiscard]] auto
+    cend() const
+    {
+      return source.cend();
+    }
+
+    [[nodiscard]] auto
+    begin() const
+    {
+      return cbegin();
+    }
+
+    [[nodiscard]] auto
+    end() const
+    {
+      return cend();
+    }
+
+    /// It returns the reversed graph. The CSR arrays are shared, thus the operation is O(1)
+    /// \return The reversed graph
+    [[nodiscard]] auto
+    reverse() const -> Reversed_Type
+    {
+      return Reversed_Type(source, storage);
+    }
+
+    /// Builds the CSR arrays from the given graph. O(N+E)
+    /// \param g The graph
+    explicit Weighted_Graph(typename t_Source_Weighted_Graph::Graph_Type const &g)
+      : Weighted_Graph(t_Source_Weighted_Graph(g))
+    {}
+
+    /// Builds the CSR arrays from the given Weighted_Graph. O(N+E)
+    /// \param g The Weighted_Graph
+    explicit Weighted_Graph(t_Source_Weighted_Graph const &g)
+      : Base_Weighted_Graph()
+      , source(g)
+      , storage(build_storage(g))
+    {}
+
+    ~Weighted_Graph() override = default;
+  };
+
+
+  /// Alias for the CSR Weighted_Graph built from the Weighted_Graph of GraphType
+  /// \tparam GraphType The graph type
+  /// \tparam Reversed If the resulting graph is reversed
+  /// \tparam Weight_Type The weight type
+  template <typename GraphType, bool Reversed = false, typename Weight_Type = Time_Type>
+  using Csr_Weighted_Graph = Weighted_Graph<Csr_Graph<Weighted_Graph<GraphType,
+                                                                     false,
+                                                                     typename GraphType::Node_Type,
+                                                                     typename GraphType::Node_Collection_Type,
+                                                                     Weight_Type>>,
+                                            Reversed,
+                                            typename GraphType::Node_Type,
+                                            typename GraphType::Node_Collection_Type,
+                                            Weight_Type>;
+} // namespace network_butcher::kfinder
+
+#endif // NETWORK_BUTCHER_CSR_WEIGHTED_GRAPH_H
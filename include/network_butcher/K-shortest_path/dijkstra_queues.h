@@ -0,0 +1,443 @@
+#ifndef NETWORK_BUTCHER_DIJKSTRA_QUEUES_H
+#define NETWORK_BUTCHER_DIJKSTRA_QUEUES_H
+
+#include <network_butcher/K-shortest_path/crtp_greater.h>
+#include <network_butcher/Traits/traits.h>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+namespace network_butcher::kfinder::Shortest_path_finder::utilities
+{
+  /// A helper struct for the Dijkstra algorithm (we lose aggregate status, but we can use the emplace methods of STL
+  /// containers)
+  template <typename Weight_Type = Time_Type>
+  struct Dijkstra_Helper : Crtp_Greater<Dijkstra_Helper<Weight_Type>>
+  {
+    /// Weight of the node
+    Weight_Type weight;
+
+    /// Node id
+    Node_Id_Type id;
+
+    /// Simple constructor
+    /// \param w Weight
+    /// \param i Index
+    Dijkstra_Helper(Weight_Type w, Node_Id_Type i)
+      : weight(w)
+      , id(i)
+    {}
+
+    bool
+    operator<(const Dijkstra_Helper &rhs) const
+    {
+      return weight < rhs.weight || (weight == rhs.weight && id < rhs.id);
+    }
+  };
+} // namespace network_butcher::kfinder::Shortest_path_finder::utilities
+
+namespace network_butcher::kfinder::Shortest_path_finder
+{
+  /// Concept describing a priority queue policy that can be used by the Dijkstra algorithm. The queue is constructed
+  /// with the number of nodes of the graph; every node is pushed at most once and its key may only be decreased
+  /// afterwards. The node ids are popped in non-decreasing order of their keys
+  /// \tparam T The queue type
+  template <typename T>
+  concept Valid_Dijkstra_Queue = requires(T queue, Node_Id_Type id, typename T::Weight_Type weight) {
+    T(std::size_t{});
+    { queue.empty() } -> std::same_as<bool>;
+    queue.push(id, weight);
+    queue.decrease_key(id, weight, weight);
+    { queue.pop() } -> std::same_as<Node_Id_Type>;
+  };
+
+
+  /// The default priority queue of the Dijkstra algorithm. It's a std::set, thus every operation is O(log(N)) and the
+  /// decrease key is performed through an erase and an insertion. Ties are broken by the node id
+  /// \tparam t_Weight_Type The weight type
+  template <typename t_Weight_Type = Time_Type>
+  class Dijkstra_Set_Queue
+  {
+  public:
+    /// Alias for the weight type
+    using Weight_Type = t_Weight_Type;
+
+    /// Simple constructor
+    explicit Dijkstra_Set_Queue(std::size_t){};
+
+    /// It checks if the queue is empty
+    /// \return True if the queue is empty
+    [[nodiscard]] auto
+    empty() const -> bool
+    {
+      return to_visit.empty();
+    }
+
+    /// It inserts a new node in the queue. O(log(N))
+    /// \param id The node id
+    /// \param weight The node key
+    void
+    push(Node_Id_Type id, Weight_Type weight)
+    {
+      to_visit.emplace(weight, id);
+    }
+
+    /// It decreases the key of a node in the queue. O(log(N))
+    /// \param id The node id
+    /// \param old_weight The current key of the node
+    /// \param new_weight The new key of the node
+    void
+    decrease_key(Node_Id_Type id, Weight_Type old_weight, Weight_Type new_weight)
+    {
+      to_visit.erase(helper_type(old_weight, id));
+      to_visit.emplace(new_weight, id);
+    }
+
+    /// It removes the node with the smallest key from the queue. O(log(N))
+    /// \return The node id
+    auto
+    pop() -> Node_Id_Type
+    {
+      return to_visit.extract(to_visit.begin()).value().id;
+    }
+
+  private:
+    /// Alias for the stored type
+    using helper_type = utilities::Dijkstra_Helper<Weight_Type>;
+
+    /// The nodes to visit
+    std::set<helper_type> to_visit;
+  };
+
+
+  /// Pairing heap with decrease key. The nodes are stored in a vector indexed by the node id, thus no allocation is
+  /// performed after the construction. Push and decrease key are O(1), pop is O(log(N)) amortized. Ties are broken by
+  /// the node id
+  /// \tparam t_Weight_Type The weight type
+  template <typename t_Weight_Type = Time_Type>
+  class Dijkstra_Pairing_Heap
+  {
+  public:
+    /// Alias for the weight type
+    using Weight_Type = t_Weight_Type;
+
+    /// Simple constructor
+    /// \param num_nodes The number of nodes of the graph
+    explicit Dijkstra_Pairing_Heap(std::size_t num_nodes)
+      : nodes(num_nodes)
+    {}
+
+    /// It checks if the heap is empty
+    /// \return True if the heap is empty
+    [[nodiscard]] auto
+    empty() const -> bool
+    {
+      return root == npos;
+    }
+
+    /// It inserts a new node in the heap. O(1)
+    /// \param id The node id
+    /// \param weight The node key
+    void
+    push(Node_Id_Type id, Weight_Type weight)
+    {
+      nodes[id] = Heap_Node{.weight = weight};
+      root      = meld(root, id);
+    }
+
+    /// It decreases the key of a node in the heap. O(1)
+    /// \param id The node id
+    /// \param new_weight The new key of the node
+    void
+    decrease_key(Node_Id_Type id, Weight_Type, Weight_Type new_weight)
+    {
+      auto &node  = nodes[id];
+      node.weight = new_weight;
+
+      if (id == root)
+        return;
+
+      // Detach the sub-heap rooted in id...
+      if (nodes[node.prev].child == id)
+        nodes[node.prev].child = node.sibling;
+      else
+        nodes[node.prev].sibling = node.sibling;
+
+      if (node.sibling != npos)
+        nodes[node.sibling].prev = node.prev;
+
+      node.sibling = npos;
+      node.prev    = npos;
+
+      // ... and merge it with the root
+      root = meld(root, id);
+    }
+
+    /// It removes the node with the smallest key from the heap. O(log(N)) amortized
+    /// \return The node id
+    auto
+    pop() -> Node_Id_Type
+    {
+      auto const res = root;
+      root           = merge_pairs(nodes[res].child);
+
+      return res;
+    }
+
+  private:
+    /// Placeholder for a missing node
+    static constexpr Node_Id_Type npos = std::numeric_limits<Node_Id_Type>::max();
+
+    /// A node of the pairing heap
+    struct Heap_Node
+    {
+      /// The key of the node
+      Weight_Type weight;
+
+      /// The leftmost child
+      Node_Id_Type child = npos;
+
+      /// The right sibling
+      Node_Id_Type sibling = npos;
+
+      /// The left sibling or, for the leftmost child, the parent
+      Node_Id_Type prev = npos;
+    };
+
+    /// Compares two nodes of the heap
+    /// \param lhs The first node id
+    /// \param rhs The second node id
+    /// \return True if lhs should be popped before rhs
+    [[nodiscard]] auto
+    less(Node_Id_Type lhs, Node_Id_Type rhs) const -> bool
+    {
+      return nodes[lhs].weight < nodes[rhs].weight || (nodes[lhs].weight == nodes[rhs].weight && lhs < rhs);
+    }
+
+    /// Merges two (root) nodes. The node with the greatest key becomes the leftmost child of the other one
+    /// \param first The first node id
+    /// \param second The second node id
+    /// \return The resulting root
+    auto
+    meld(Node_Id_Type first, Node_Id_Type second) -> Node_Id_Type
+    {
+      if (first == npos)
+        return second;
+      if (second == npos)
+        return first;
+
+      if (less(second, first))
+        std::swap(first, second);
+
+      auto &parent = nodes[first];
+      auto &child  = nodes[second];
+
+      child.sibling = parent.child;
+      child.prev    = first;
+
+      if (parent.child != npos)
+        nodes[parent.child].prev = second;
+
+      parent.child = second;
+
+      return first;
+    }
+
+    /// Classic two pass merge of a list of siblings
+    /// \param first The leftmost sibling
+    /// \return The resulting root
+    auto
+    merge_pairs(Node_Id_Type first) -> Node_Id_Type
+    {
+      pairs.clear();
+
+      // First pass: meld the siblings in pairs, from left to right
+      while (first != npos)
+        {
+          auto const second = nodes[first].sibling;
+          auto const next   = second == npos ? npos : nodes[second].sibling;
+
+          nodes[first].sibling = npos;
+          nodes[first].prev    = npos;
+
+          if (second != npos)
+            {
+              nodes[second].sibling = npos;
+              nodes[second].prev    = npos;
+            }
+
+          pairs.push_back(meld(first, second));
+          first = next;
+        }
+
+      // Second pass: meld the resulting heaps, from right to left
+      Node_Id_Type res = npos;
+      for (auto it = pairs.crbegin(); it != pairs.crend(); ++it)
+        res = meld(*it, res);
+
+      return res;
+    }
+
+    /// The nodes of the heap, indexed by the node id
+    std::vector<Heap_Node> nodes;
+
+    /// Buffer used by merge_pairs
+    std::vector<Node_Id_Type> pairs;
+
+    /// The root of the heap
+    Node_Id_Type root = npos;
+  };
+
+
+  /// Monotone radix heap for integer keys. Since the keys popped by Dijkstra are non-decreasing, an entry with key w
+  /// is stored in the bucket identified by the highest bit in which w differs from the last popped key. Every entry is
+  /// moved to a lower bucket at most once per bit, thus the amortized cost of a pop is O(log(C)), where C is the
+  /// greatest key. The decrease key inserts a new entry, the outdated ones are discarded lazily. Ties are not broken
+  /// by the node id
+  /// \tparam t_Weight_Type The (integral) weight type
+  template <typename t_Weight_Type>
+    requires std::integral<t_Weight_Type>
+  class Dijkstra_Radix_Heap
+  {
+  public:
+    /// Alias for the weight type
+    using Weight_Type = t_Weight_Type;
+
+    /// Simple constructor
+    /// \param num_nodes The number of nodes of the graph
+    explicit Dijkstra_Radix_Heap(std::size_t num_nodes)
+      : keys(num_nodes)
+    {}
+
+    /// It checks if the heap is empty
+    /// \return True if the heap is empty
+    [[nodiscard]] auto
+    empty() const -> bool
+    {
+      return num_elements == 0;
+    }
+
+    /// It inserts a new node in the heap. O(1)
+    /// \param id The node id
+    /// \param weight The node key. It must not be smaller than the last popped key
+    void
+    push(Node_Id_Type id, Weight_Type weight)
+    {
+      ++num_elements;
+      insert(id, weight);
+    }
+
+    /// It decreases the key of a node in the heap. O(1)
+    /// \param id The node id
+    /// \param new_weight The new key of the node. It must not be smaller than the last popped key
+    void
+    decrease_key(Node_Id_Type id, Weight_Type, Weight_Type new_weight)
+    {
+      insert(id, new_weight);
+    }
+
+    /// It removes the node with the smallest key from the heap. O(log(C)) amortized
+    /// \return The node id
+    auto
+    pop() -> Node_Id_Type
+    {
+      while (true)
+        {
+          if (buckets.front().empty())
+            redistribute();
+
+          auto const [key, id] = buckets.front().back();
+          buckets.front().pop_back();
+
+          // Discard the outdated entries
+          if (key == keys[id])
+            {
+              --num_elements;
+              return id;
+            }
+        }
+    }
+
+  private:
+    /// Alias for the unsigned key type
+    using Key_Type = std::make_unsigned_t<Weight_Type>;
+
+    /// Alias for an entry of a bucket
+    using Entry_Type = std::pair<Key_Type, Node_Id_Type>;
+
+    /// It returns the bucket of the given key
+    /// \param key The key
+    /// \return The bucket index
+    [[nodiscard]] auto
+    bucket_index(Key_Type key) const -> std::size_t
+    {
+      return std::bit_width(static_cast<Key_Type>(key ^ last));
+    }
+
+    /// It inserts a new entry in the heap
+    /// \param id The node id
+    /// \param weight The node key
+    void
+    insert(Node_Id_Type id, Weight_Type weight)
+    {
+      auto const key = static_cast<Key_Type>(weight);
+
+      keys[id] = key;
+      buckets[bucket_index(key)].emplace_back(key, id);
+    }
+
+    /// It moves the entries of the first non-empty bucket to the lower buckets, updating the last popped key
+    void
+    redistribute()
+    {
+      std::size_t i = 1;
+      while (buckets[i].empty())
+        ++i;
+
+      auto &bucket = buckets[i];
+
+      // The new last key is the smallest up-to-date key of the bucket
+      auto new_last = std::numeric_limits<Key_Type>::max();
+      bool found    = false;
+      for (auto const &[key, id] : bucket)
+        {
+          if (key == keys[id] && key <= new_last)
+            {
+              new_last = key;
+              found    = true;
+            }
+        }
+
+      // If the bucket contains only outdated entries, the last key must not change
+      if (found)
+        last = new_last;
+
+      for (auto const &entry : bucket)
+        {
+          if (entry.first == keys[entry.second])
+            buckets[bucket_index(entry.first)].push_back(entry);
+        }
+
+      bucket.clear();
+    }
+
+    /// The buckets. The bucket 0 contains the entries whose key is equal to the last popped key
+    std::array<std::vector<Entry_Type>, std::numeric_limits<Key_Type>::digits + 1> buckets;
+
+    /// The current key of every node
+    std::vector<Key_Type> keys;
+
+    /// The last popped key
+    Key_Type last = 0;
+
+    /// The number of nodes in the heap
+    std::size_t num_elements = 0;
+  };
+} // namespace network_butcher::kfinder::Shortest_path_finder
+
+#endif // NETWORK_BUTCHER_DIJKSTRA_QUEUES_H
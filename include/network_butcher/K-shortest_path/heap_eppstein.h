@@ -1,11 +1,14 @@
 #ifndef NETWORK_BUTCHER_HEAP_EPPSTEIN_H
 #define NETWORK_BUTCHER_HEAP_EPPSTEIN_H
 
+#include <array>
 #include <limits>
 #include <list>
 #include <memory>
-#include <utility>
+#include <memory_resource>
 #include <numeric>
+#include <span>
+#include <utility>
 
 #include <network_butcher/K-shortest_path/crtp_greater.h>
 #include <network_butcher/Traits/traits.h>
@@ -39,7 +42,8 @@ namespace network_butcher::kfinder
 
 
   /// Simple node class, used to construct a min-Heap (though pointers...). Thus, copies are allowed, but not moves.
-  /// Depth can be used to keep track of the number of nodes the current node in each branch.
+  /// Depth can be used to keep track of the number of nodes the current node in each branch. The children are stored in
+  /// a fixed size array, thus a node never allocates memory.
   /// \tparam T The node content
   /// \tparam Comparison Content comparison struct
   /// \tparam Max_Children The number of children per node
@@ -59,26 +63,12 @@ namespace network_butcher::kfinder
     /// It constructs a node with the given content
     /// \param initial_content The content
     explicit Heap_Node(T const &initial_content)
-      : content(initial_content)
-      , depth()
-    {
-      children.reserve(Max_Children);
-
-      for (auto &el : depth)
-        el = 0;
-    };
+      : content(initial_content){};
 
     /// It constructs a node with the given content
     /// \param initial_content The content (as an rvalue)
     explicit Heap_Node(T &&initial_content)
-      : content(std::move(initial_content))
-      , depth()
-    {
-      children.reserve(Max_Children);
-
-      for (auto &el : depth)
-        el = 0;
-    };
+      : content(std::move(initial_content)){};
 
     /// Copy constructor
     /// \param other The node to copy
@@ -102,19 +92,17 @@ namespace network_butcher::kfinder
     /// Get the children of the current node
     /// \return The children nodes
     [[nodiscard]] auto
-    get_children() const -> std::vector<Heap_Node *> const &
+    get_children() const -> std::span<Heap_Node *const>
     {
-      return children;
+      return {children.data(), num_children};
     }
 
     /// Clear the children of the given nodes
     void
     clear_children()
     {
-      children.clear();
-
-      for (auto &el : depth)
-        el = 0;
+      num_children = 0;
+      depth.fill(0);
     }
 
     /// Add a child to the current node. It will throw if the number of children is already at the maximum
@@ -123,17 +111,17 @@ namespace network_butcher::kfinder
     void
     add_child(Heap_Node *child, bool depth_update = true)
     {
-      if (children.size() >= Max_Children)
+      if (num_children >= Max_Children)
         {
           throw std::runtime_error("Heap_Node::add_child: children.size() >= Max_Children");
         }
 
       if (depth_update)
         {
-          depth[children.size()] = 1;
+          depth[num_children] = 1;
         }
 
-      children.push_back(child);
+      children[num_children++] = child;
     }
 
     /// Copy a child from the specified node in the current node. It will throw if the number of children is already
@@ -144,17 +132,17 @@ namespace network_butcher::kfinder
     void
     copy_child(std::size_t id, Heap_Node const *const &node, bool depth_update = true)
     {
-      if (children.size() >= Max_Children)
+      if (num_children >= Max_Children)
         {
           throw std::runtime_error("Heap_Node::copy_child: children.size() >= Max_Children");
         }
 
       if (depth_update)
         {
-          depth[children.size()] = 1;
+          depth[num_children] = 1;
         }
 
-      children.push_back(node->children[id]);
+      children[num_children++] = node->children[id];
     }
 
     /// Get the content of the current node
@@ -206,11 +194,17 @@ namespace network_butcher::kfinder
     }
 
 
-    virtual ~Heap_Node() = default;
+    ~Heap_Node() = default;
 
   private:
-    std::array<std::size_t, Max_Children> depth;
-    std::vector<Heap_Node *>              children;
+    /// The number of nodes below the current one in each branch
+    std::array<std::size_t, Max_Children> depth{};
+
+    /// The children slots (only the first num_children are valid)
+    std::array<Heap_Node *, Max_Children> children{};
+
+    /// The number of children
+    std::size_t num_children = 0;
 
     T content;
 
@@ -220,17 +214,19 @@ namespace network_butcher::kfinder
     internal_push(Heap_Node *new_heap)
     {
       // If we are not at capacity
-      if (children.size() < Max_Children)
+      if (num_children < Max_Children)
         {
           // Add the node
-          depth[children.size()] = 1;
-          children.push_back(new_heap);
+          depth[num_children] = 1;
+          children[num_children] = new_heap;
 
           // Swap it with a child if needed
-          if (comp(children.back()->content, content))
+          if (comp(new_heap->content, content))
             {
-              std::swap(content, children.back()->content);
+              std::swap(content, new_heap->content);
             }
+
+          ++num_children;
         }
       else
         {
@@ -278,18 +274,22 @@ namespace network_butcher::kfinder
     /// The type of the nodes of the heap
     using Node_Type = Heap_Node<T, Comparison, 2>;
 
-    /// The type of the internal collection of nodes
-    using Internal_Collection_Type = std::list<Node_Type>;
+    /// The type of the internal collection of nodes. The nodes are allocated through the memory resource provided
+    /// during the construction
+    using Internal_Collection_Type = std::pmr::list<Node_Type>;
 
     /// Default constructor. It prepares an empty heap
-    H_out_Type()
-      : internal_children(std::make_unique<Internal_Collection_Type>()){};
+    /// \param resource The memory resource used to allocate the nodes
+    explicit H_out_Type(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : internal_children(resource){};
 
     /// Builds an H_out from a collection of elements. The provided collection will be moved. It is equivalent to an
     /// heapify operation.
     /// \param input_collection The input collection
-    explicit H_out_Type(std::vector<T> &&input_collection)
-      : internal_children(std::make_unique<Internal_Collection_Type>())
+    /// \param resource The memory resource used to allocate the nodes
+    explicit H_out_Type(std::vector<T>            &&input_collection,
+                        std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : internal_children(resource)
     {
       build_internal_children(std::move(input_collection));
     };
@@ -297,8 +297,10 @@ namespace network_butcher::kfinder
     /// Builds an H_out from a collection of elements. The provided collection will be moved. It is equivalent to an
     /// heapify operation
     /// \param input_collection The input collection
-    explicit H_out_Type(std::list<T> &&input_collection)
-      : internal_children(std::make_unique<Internal_Collection_Type>())
+    /// \param resource The memory resource used to allocate the nodes
+    explicit H_out_Type(std::list<T>              &&input_collection,
+                        std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : internal_children(resource)
     {
       std::vector<T> initial_collection{std::make_move_iterator(input_collection.begin()),
                                         std::make_move_iterator(input_collection.end())};
@@ -306,18 +308,19 @@ namespace network_butcher::kfinder
       build_internal_children(std::move(initial_collection));
     };
 
-    /// Copy assignment operator is deleted since the node collection is stored in a unique_ptr
+    /// Copy assignment operator is deleted since the nodes are linked through pointers
     auto
     operator=(H_out_Type const &) -> H_out_Type & = delete;
 
-    /// Copy constructor is deleted since the node collection is stored in a unique_ptr
+    /// Copy constructor is deleted since the nodes are linked through pointers
     H_out_Type(H_out_Type const &) = delete;
 
-    /// Move assignment operator
+    /// Move assignment operator is deleted: if the memory resources of the two heaps are different, the nodes would
+    /// be moved one by one, invalidating the pointers among them
     auto
-    operator=(H_out_Type &&) noexcept -> H_out_Type & = default;
+    operator=(H_out_Type &&) -> H_out_Type & = delete;
 
-    /// Move constructor
+    /// Move constructor. The nodes are not moved, thus the pointers among them remain valid
     H_out_Type(H_out_Type &&) noexcept = default;
 
 
@@ -329,53 +332,53 @@ namespace network_butcher::kfinder
     add_elem(U &&elem)
     {
       // If there aren't nodes, just add the element
-      if (internal_children->empty())
+      if (internal_children.empty())
         {
-          internal_children->emplace_back(std::forward<U>(elem));
+          internal_children.emplace_back(std::forward<U>(elem));
         }
       // If there is a single node...
-      else if (internal_children->size() == 1)
+      else if (internal_children.size() == 1)
         {
           // Check if the new node should be the root of the heap
-          if (Node_Type::comp(elem, internal_children->front().get_content()))
+          if (Node_Type::comp(elem, internal_children.front().get_content()))
             {
-              internal_children->emplace_front(std::forward<U>(elem));
+              internal_children.emplace_front(std::forward<U>(elem));
             }
           else
             {
-              internal_children->emplace_back(std::forward<U>(elem));
+              internal_children.emplace_back(std::forward<U>(elem));
             }
 
           // Link the root node with the last node
-          internal_children->front().add_child(&internal_children->back());
+          internal_children.front().add_child(&internal_children.back());
         }
       else
         {
           // Check if the new node should be the root of the heap
-          if (Node_Type::comp(elem, internal_children->front().get_content()))
+          if (Node_Type::comp(elem, internal_children.front().get_content()))
             {
               // Substitute the head node with the new one and insert the old head node to the back of the list
-              auto val = internal_children->front();
-              internal_children->pop_front();
+              auto val = internal_children.front();
+              internal_children.pop_front();
               val.clear_children();
 
-              internal_children->emplace_front(std::forward<U>(elem));
-              internal_children->front().add_child(&(*(++internal_children->begin())));
+              internal_children.emplace_front(std::forward<U>(elem));
+              internal_children.front().add_child(&(*(++internal_children.begin())));
 
-              internal_children->emplace_back(val);
+              internal_children.emplace_back(val);
             }
           // If not, it goes in the back of the list
           else
             {
-              internal_children->emplace_back(std::forward<U>(elem));
+              internal_children.emplace_back(std::forward<U>(elem));
             }
 
-          auto &heap_head = *(++internal_children->begin());
+          auto &heap_head = *(++internal_children.begin());
 
           // Add the last node to the heap (whose head is in the second node)
-          heap_head.push(&internal_children->back());
+          heap_head.push(&internal_children.back());
 
-          internal_children->begin()->get_depth_edit()[0] = internal_children->size() - 1;
+          internal_children.begin()->get_depth_edit()[0] = internal_children.size() - 1;
         }
     }
 
@@ -384,12 +387,12 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     get_head_node() const -> Node_Type const *
     {
-      if (internal_children->empty())
+      if (internal_children.empty())
         {
           throw std::runtime_error("H_out_test: Empty heap");
         }
 
-      return &internal_children->front();
+      return &internal_children.front();
     }
 
     /// It will return the content of the first node in the heap
@@ -397,7 +400,7 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     get_head_content() const -> T const &
     {
-      if (internal_children->empty())
+      if (internal_children.empty())
         {
           throw std::runtime_error("H_out_test: Empty heap");
         }
@@ -410,7 +413,7 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     get_head_content() -> T const &
     {
-      if (internal_children->empty())
+      if (internal_children.empty())
         {
           throw std::runtime_error("H_out_test: Empty heap");
         }
@@ -423,7 +426,7 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     empty() const -> bool
     {
-      return internal_children->empty();
+      return internal_children.empty();
     }
 
     auto
@@ -435,12 +438,12 @@ namespace network_butcher::kfinder
     /// It will return the internal collection of nodes (as a constant reference). The collection is NOT heap ordered
     /// \return A constant reference to the internal collection of nodes
     [[nodiscard]] auto
-    get_internal_children() const -> std::list<Node_Type> const &
+    get_internal_children() const -> Internal_Collection_Type const &
     {
-      return *internal_children;
+      return internal_children;
     }
 
-    virtual ~H_out_Type() = default;
+    ~H_out_Type() = default;
 
   private:
     /// Helper function to build the internal collection of nodes from a collection of elements
@@ -459,12 +462,12 @@ namespace network_butcher::kfinder
           std::pop_heap(initial_collection.begin(), initial_collection.end(), reversed_comparison); // O(log(N))
 
           // Collection of iterators to the nodes in the internal collection
-          std::vector<typename std::list<Node_Type>::iterator> iterators;
+          std::vector<typename Internal_Collection_Type::iterator> iterators;
           iterators.reserve(initial_collection.size()); // O(N)
 
           // Add the the last element of initial_collection to the internal collection. It should be the minimum element
-          internal_children->emplace_back(initial_collection.back()); // O(1)
-          iterators.push_back(internal_children->begin());                       // O(1)
+          internal_children.emplace_back(initial_collection.back()); // O(1)
+          iterators.push_back(internal_children.begin());                       // O(1)
 
           // Remove the last element of initial_collection
           initial_collection.pop_back();
@@ -473,13 +476,13 @@ namespace network_butcher::kfinder
           // initial_collection heap
           for (std::size_t i = 0; i < initial_collection.size(); ++i) // O(N)
             {
-              internal_children->emplace_back(initial_collection[i]);
-              iterators.push_back((++internal_children->rbegin()).base());
+              internal_children.emplace_back(initial_collection[i]);
+              iterators.push_back((++internal_children.rbegin()).base());
 
-              iterators[(i + 1) / 2]->add_child(&internal_children->back());
+              iterators[(i + 1) / 2]->add_child(&internal_children.back());
             }
 
-          for (std::size_t i = internal_children->size() - 1; ; --i)
+          for (std::size_t i = internal_children.size() - 1; ; --i)
             {
               auto       &iterator = iterators[i];
               auto       &depth    = iterator->get_depth_edit();
@@ -499,7 +502,7 @@ namespace network_butcher::kfinder
     }
 
     /// Internal collection of nodes
-    std::unique_ptr<Internal_Collection_Type> internal_children;
+    Internal_Collection_Type internal_children;
   };
 
 
@@ -534,24 +537,30 @@ namespace network_butcher::kfinder
     /// Node type used to represent the nodes in the heap
     using Node_Type = Heap_Node<Elem_Type const *, Pointer_Less, 2>;
 
-    /// Type of the internal collection of nodes
-    using Internal_Collection_Type = std::list<Node_Type>;
+    /// Type of the internal collection of nodes. The nodes are allocated through the memory resource provided during
+    /// the construction
+    using Internal_Collection_Type = std::pmr::list<Node_Type>;
 
     /// It will construct H_g from the given H_out
-    /// \param starting_content
-    explicit H_g_Type(Elem_Type const *const &starting_content)
-      : internal_children(std::make_unique<Internal_Collection_Type>())
+    /// \param starting_content The H_out
+    /// \param resource The memory resource used to allocate the nodes
+    explicit H_g_Type(Elem_Type const *const    &starting_content,
+                      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : internal_children(resource)
     {
       if (!starting_content->empty())
-        internal_children->emplace_back(starting_content);
+        internal_children.emplace_back(starting_content);
     };
 
     /// It will construct H_g from the given H_out and H_g. Pointers to the nodes in the provided H_g will be used to
     /// build the new H_g
     /// \param starting_content The H_out to use to build the new H_g
     /// \param to_copy The H_g to use to build the new H_g
-    explicit H_g_Type(Elem_Type const *const &starting_content, H_g_Type const &to_copy)
-      : internal_children(std::make_unique<Internal_Collection_Type>())
+    /// \param resource The memory resource used to allocate the nodes
+    explicit H_g_Type(Elem_Type const *const    &starting_content,
+                      H_g_Type const            &to_copy,
+                      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : internal_children(resource)
     {
       if (starting_content->empty() && to_copy.empty())
         {
@@ -560,13 +569,13 @@ namespace network_butcher::kfinder
       else if (starting_content->empty())
         {
           // Copy the first node and its connections
-          internal_children->push_back(to_copy.internal_children->front());
+          internal_children.push_back(to_copy.internal_children.front());
           return;
         }
       else if (to_copy.empty())
         {
           // Add the initial content
-          internal_children->emplace_back(starting_content);
+          internal_children.emplace_back(starting_content);
           return;
         }
       else
@@ -576,18 +585,19 @@ namespace network_butcher::kfinder
         }
     }
 
-    /// Deleted copy assignment operator because the node collection is stored in a unique_ptr
+    /// Deleted copy assignment operator because the nodes are linked through pointers
     auto
     operator=(H_g_Type const &) -> H_g_Type & = delete;
 
-    /// Deleted copy constructor because the node collection is stored in a unique_ptr
+    /// Deleted copy constructor because the nodes are linked through pointers
     H_g_Type(H_g_Type const &) = delete;
 
-    /// Default move assignment operator
+    /// Deleted move assignment operator: if the memory resources of the two heaps are different, the nodes would be
+    /// moved one by one, invalidating the pointers among them
     auto
-    operator=(H_g_Type &&) noexcept -> H_g_Type & = default;
+    operator=(H_g_Type &&) -> H_g_Type & = delete;
 
-    /// Default move constructor
+    /// Default move constructor. The nodes are not moved, thus the pointers among them remain valid
     H_g_Type(H_g_Type &&) noexcept = default;
 
 
@@ -596,7 +606,7 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     get_head_node() const -> Node_Type const *
     {
-      return &internal_children->front();
+      return &internal_children.front();
     }
 
     /// It will return the size of the heap
@@ -604,7 +614,7 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     size() const -> std::size_t
     {
-      return internal_children->size();
+      return internal_children.size();
     }
 
     /// It will return true if the heap is empty, false otherwise
@@ -612,14 +622,14 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     empty() const -> bool
     {
-      return internal_children->empty();
+      return internal_children.empty();
     }
 
     ~H_g_Type() = default;
 
   private:
     /// Internal collection of nodes
-    std::unique_ptr<Internal_Collection_Type> internal_children;
+    Internal_Collection_Type internal_children;
 
     /// Helper (recursive) function to construct the new H_g from the given H_out and H_g
     /// \param starting_content The initial H_out
@@ -636,16 +646,16 @@ namespace network_butcher::kfinder
       // If the starting content is smaller than the other node, it must be inserted here
       if (smaller)
         {
-          internal_children->emplace_back(starting_content);
+          internal_children.emplace_back(starting_content);
         }
       // else, insert the content of the other_h_g node
       else
         {
-          internal_children->emplace_back(other_h_g->get_content());
+          internal_children.emplace_back(other_h_g->get_content());
         }
 
       // Get the newly inserted node
-      auto &inserted_element = internal_children->back();
+      auto &inserted_element = internal_children.back();
       auto &depth            = inserted_element.get_depth_edit();
 
       // Add the newly added node
@@ -664,8 +674,8 @@ namespace network_butcher::kfinder
           // just need to insert the non-inserted content as a children of inserted_element and, if other_h_g has a
           // child (that, by construction, will not have any child), we will insert it as a child of inserted_element
 
-          internal_children->emplace_back(new_content);
-          inserted_element.add_child(&internal_children->back());
+          internal_children.emplace_back(new_content);
+          inserted_element.add_child(&internal_children.back());
 
           // If the node of the other H_g had an extra child, add it as a child of internal_children
           if (!other_h_g->get_children().empty())
@@ -0,0 +1,178 @@
+#ifndef NETWORK_BUTCHER_HEAP_SELECTION_H
+#define NETWORK_BUTCHER_HEAP_SELECTION_H
+
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+#include <vector>
+
+namespace network_butcher::kfinder::Heap_Selection
+{
+  /// It selects the k smallest elements of an (implicit) heap-ordered tree, through the clan-based heap selection of
+  /// Frederickson. The elements are grouped in clans of O(log(k)) elements, formed with a local binary heap. The
+  /// elements of the tree that are adjacent to a clan (its poor relations) are split in two halves, each one used to
+  /// form a child clan: the clans form a binary tree, heap-ordered according to the largest key of each clan, and the
+  /// smallest O(k/log(k)) clans are selected through a binary heap. A clan is formed only when its smallest seed
+  /// reaches the top of the heap, so that the elements of the clans that cannot be selected are not expanded.
+  /// O(k*log(log(k))) for the selection, plus O(k*log(k)) to sort the result
+  /// \tparam Element_Type The type of an element of the tree (it should be cheap to copy, e.g., a pointer)
+  /// \tparam Key_Function The type of the function returning the key of an element
+  /// \tparam Expand_Function The type of the function producing the children of an element
+  /// \param root The root of the tree
+  /// \param k The number of elements to select
+  /// \param key The function returning the key of an element. The key of a child must not be smaller than the one of
+  /// its parent
+  /// \param expand The function producing the children of an element. It's called as expand(element, push), where
+  /// push(child) must be called for every child of the element. It's called at most once per element
+  /// \return The k smallest elements (or all the elements, if they are less than k), sorted by key
+  template <typename Element_Type, typename Key_Function, typename Expand_Function>
+  auto
+  frederickson(Element_Type root, std::size_t k, Key_Function const &key, Expand_Function const &expand)
+    -> std::vector<Element_Type>
+  {
+    using Key_Type = std::decay_t<std::invoke_result_t<Key_Function const &, Element_Type const &>>;
+
+    /// An element, together with its key (computed once)
+    struct Entry
+    {
+      /// The key of the element
+      Key_Type key;
+
+      /// The element
+      Element_Type element;
+    };
+
+    /// A group of elements, all of them smaller than (or equal to) the elements of its poor relations. A clan is formed
+    /// only when it reaches the top of the queue: until then, it only stores the elements it will be formed from
+    struct Clan
+    {
+      /// If the clan is formed, the largest key of its elements. Otherwise, the smallest key of its seeds
+      Key_Type key;
+
+      /// The number of elements of the clan
+      std::size_t size;
+
+      /// True if the clan has been formed
+      bool formed;
+
+      /// If the clan is formed, the elements adjacent to the clan (used to form the child clans). Otherwise, the
+      /// elements the clan will be formed from. In both cases, they're stored as a binary heap
+      std::vector<Entry> elements;
+    };
+
+    if (k == 0)
+      return {};
+
+    auto const entry_greater = [](Entry const &lhs, Entry const &rhs) { return rhs.key < lhs.key; };
+
+    // O(log(k)) elements per clan
+    std::size_t const clan_size = std::bit_width(k);
+
+    // The elements of all the formed clans. The k smallest elements are among them
+    std::vector<Entry> candidates;
+
+    // The clans
+    std::vector<Clan> clans;
+
+    // The heap of the clans that haven't been selected yet
+    std::vector<std::size_t> clan_queue;
+    auto const               clan_greater = [&clans](std::size_t lhs, std::size_t rhs) {
+      return clans[rhs].key < clans[lhs].key;
+    };
+
+    auto const push_clan = [&clans, &clan_queue, &clan_greater](std::size_t clan_id) {
+      clan_queue.push_back(clan_id);
+      std::push_heap(clan_queue.begin(), clan_queue.end(), clan_greater);
+    };
+
+    // Add a (not formed) clan with the given seeds to the queue. O(log(k))
+    auto const add_clan = [&](std::vector<Entry> seeds) {
+      if (seeds.empty())
+        return;
+
+      std::make_heap(seeds.begin(), seeds.end(), entry_greater);
+
+      auto const seeds_key = seeds.front().key;
+      clans.push_back(Clan{.key = seeds_key, .size = 0, .formed = false, .elements = std::move(seeds)});
+
+      push_clan(clans.size() - 1);
+    };
+
+    // Form the given clan, extracting its elements from its seeds. O(log(k)*log(log(k)))
+    auto const form_clan = [&](Clan &clan) {
+      auto &heap = clan.elements;
+
+      for (; clan.size < clan_size && !heap.empty(); ++clan.size)
+        {
+          std::pop_heap(heap.begin(), heap.end(), entry_greater);
+          auto const entry = heap.back();
+          heap.pop_back();
+
+          candidates.push_back(entry);
+          clan.key = entry.key;
+
+          expand(entry.element, [&heap, &key, &entry_greater](Element_Type child) {
+            heap.push_back(Entry{.key = key(child), .element = std::move(child)});
+            std::push_heap(heap.begin(), heap.end(), entry_greater);
+          });
+        }
+
+      // The remaining elements are the poor relations: they're not smaller than the largest element of the clan
+      clan.formed = true;
+    };
+
+    add_clan({Entry{.key = key(root), .element = std::move(root)}});
+
+    // Select the smallest clans until they contain at least k elements. At the end, every element that is smaller than
+    // the largest key of the selected clans belongs to a formed clan
+    for (std::size_t selected = 0; selected < k && !clan_queue.empty();)
+      {
+        std::pop_heap(clan_queue.begin(), clan_queue.end(), clan_greater);
+        auto const clan_id = clan_queue.back();
+        clan_queue.pop_back();
+
+        auto &clan = clans[clan_id];
+
+        // The elements of the clan are not smaller than its seeds: it's placed again in the queue after being formed
+        if (!clan.formed)
+          {
+            form_clan(clan);
+            push_clan(clan_id);
+
+            continue;
+          }
+
+        selected += clan.size;
+
+        // Split the poor relations in two halves, used to form the two child clans
+        auto       poor_relations = std::move(clan.elements);
+        auto const middle         = std::next(poor_relations.begin(), poor_relations.size() / 2);
+
+        add_clan(std::vector<Entry>(middle, poor_relations.end()));
+
+        poor_relations.erase(middle, poor_relations.end());
+        add_clan(std::move(poor_relations));
+      }
+
+    // The candidates are O(k): keep the k smallest ones. O(k)
+    auto const entry_less = [](Entry const &lhs, Entry const &rhs) { return lhs.key < rhs.key; };
+
+    if (candidates.size() > k)
+      {
+        std::nth_element(candidates.begin(), std::next(candidates.begin(), k), candidates.end(), entry_less);
+        candidates.resize(k);
+      }
+
+    std::sort(candidates.begin(), candidates.end(), entry_less); // O(k*log(k))
+
+    std::vector<Element_Type> res;
+    res.reserve(candidates.size());
+
+    for (auto &entry : candidates)
+      res.push_back(std::move(entry.element));
+
+    return res;
+  }
+} // namespace network_butcher::kfinder::Heap_Selection
+
+#endif // NETWORK_BUTCHER_HEAP_SELECTION_H
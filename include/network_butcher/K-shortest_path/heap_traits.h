@@ -1,6 +1,9 @@
 #ifndef NETWORK_BUTCHER_HEAP_TRAITS_H
 #define NETWORK_BUTCHER_HEAP_TRAITS_H
 
+#include <optional>
+#include <vector>
+
 #include <network_butcher/K-shortest_path/heap_eppstein.h>
 #include <network_butcher/K-shortest_path/path_info.h>
 #include <network_butcher/K-shortest_path/weighted_graph.h>
@@ -10,16 +13,18 @@
 
 namespace network_butcher::kfinder
 {
-  /// Simple alias for a map storing H_out_Type, indexed by the node id. Each H_out_Type will store a
-  /// Templated_Edge_Info<Weight_Type>
+  /// Simple alias for a collection storing H_out_Type, addressed by the node id. It must be sized with the number of
+  /// nodes of the graph before use: the entries of the nodes whose H_out hasn't been constructed are empty. Each
+  /// H_out_Type will store a Templated_Edge_Info<Weight_Type>
   template <typename Weight_Type = Time_Type>
   using Templated_H_out_Collection =
-    std::unordered_map<Node_Id_Type, H_out_Type<Templated_Edge_Info<Weight_Type>, std::less<>>>;
+    std::vector<std::optional<H_out_Type<Templated_Edge_Info<Weight_Type>, std::less<>>>>;
 
-  /// Simple alias for a map storing H_g_Type, indexed by the node id.
+  /// Simple alias for a collection storing H_g_Type, addressed by the node id. As Templated_H_out_Collection, it must be
+  /// sized with the number of nodes of the graph before use
   template <typename Weight_Type = Time_Type>
   using Templated_H_g_Collection =
-    std::unordered_map<Node_Id_Type, H_g_Type<Templated_Edge_Info<Weight_Type>, std::less<>>>;
+    std::vector<std::optional<H_g_Type<Templated_Edge_Info<Weight_Type>, std::less<>>>>;
 } // namespace network_butcher::kfinder
 
 
@@ -0,0 +1,556 @@
+#ifndef NETWORK_BUTCHER_KASTAR_H
+#define NETWORK_BUTCHER_KASTAR_H
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <network_butcher/K-shortest_path/crtp_greater.h>
+#include <network_butcher/K-shortest_path/kfinder.h>
+#include <network_butcher/K-shortest_path/path_info.h>
+#include <network_butcher/K-shortest_path/shortest_path_finder.h>
+#include <network_butcher/K-shortest_path/weighted_graph.h>
+#include <network_butcher/Traits/traits.h>
+
+namespace network_butcher::kfinder
+{
+  /// This class implements a goal-directed (A*) K-shortest path search. The partial paths from the root are extended
+  /// in increasing order of their length plus a lower bound of the distance from their last node to the sink: with a
+  /// consistent bound, the complete paths are extracted in nondecreasing order of length. Since every node is expanded
+  /// at most K times, the (K+1)-th partial path reaching a node is discarded.
+  /// Contrary to the Eppstein algorithms, no sidetrack structure is constructed and, if the lower bounds are provided
+  /// (see set_lower_bounds and Shortest_path_finder::layered_lower_bounds), not even the shortest path tree: only the
+  /// partial paths whose estimate doesn't exceed the length of the K-th path are visited. Thus, it's meant for small
+  /// values of K on very large graphs. If no lower bound is provided, the exact distances from the sink are used
+  /// \tparam GraphType The graph type
+  template <typename GraphType,
+            bool                 Only_Distance                  = false,
+            Valid_Weighted_Graph t_Weighted_Graph_Complete_Type = Weighted_Graph<GraphType>>
+  class KFinder_A_Star final : public KFinder<GraphType, Only_Distance, t_Weighted_Graph_Complete_Type>
+  {
+  private:
+    /// The parent type. Used to access quickly to the parent methods
+    using Parent_Type = KFinder<GraphType, Only_Distance, t_Weighted_Graph_Complete_Type>;
+
+  public:
+    /// The type of the output of the algorithm
+    using Output_Type = Parent_Type::Output_Type;
+
+    /// The type of the enumerator returned by enumerate
+    using Enumerator_Type = Parent_Type::Enumerator_Type;
+
+    /// The type of the compact collection of paths returned by compute_path_trie
+    using Path_Trie_Type = Parent_Type::Path_Trie_Type;
+
+    /// The type of the upper bound on the length of the paths
+    using Length_Bound_Type = Parent_Type::Length_Bound_Type;
+
+    /// Weight Type
+    using Weight_Type = typename t_Weighted_Graph_Complete_Type::Weight_Type;
+
+    /// The type of the lower bounds of the distances from the sink
+    using Lower_Bounds_Type = std::vector<Weight_Type>;
+
+  private:
+    /// Bring forward the graph
+    using Parent_Type::graph;
+
+    /// Bring forward the root node id
+    using Parent_Type::root;
+
+    /// Bring forward the sink node id
+    using Parent_Type::sink;
+
+    /// Type for a path, with its length
+    using Path_Info = Templated_Path_Info<Weight_Type>;
+
+    /// The parent of the partial path made only by the root
+    static constexpr std::size_t No_Parent = std::numeric_limits<std::size_t>::max();
+
+    /// A partial path from the root. It's represented by its last node and by the partial path it extends, thus the
+    /// partial paths form a prefix tree
+    struct Partial_Path
+    {
+      /// The last node of the path
+      Node_Id_Type node;
+
+      /// The position of the partial path it extends (or No_Parent)
+      std::size_t parent;
+
+      /// The length of the path
+      Weight_Type length;
+    };
+
+    /// An entry of the priority queue
+    struct Queue_Entry : Crtp_Greater<Queue_Entry>
+    {
+      /// The length of the partial path plus the lower bound of the distance from its last node to the sink
+      Weight_Type estimate;
+
+      /// The position of the partial path
+      std::size_t partial_path;
+
+      auto
+      operator<(Queue_Entry const &rhs) const -> bool
+      {
+        return estimate < rhs.estimate || (estimate == rhs.estimate && partial_path < rhs.partial_path);
+      }
+    };
+
+    /// The state of a search
+    struct Search_State
+    {
+      /// The graph
+      t_Weighted_Graph_Complete_Type graph;
+
+      /// The sink node id
+      Node_Id_Type sink;
+
+      /// The lower bounds of the distances from the sink
+      std::shared_ptr<Lower_Bounds_Type const> lower_bounds;
+
+      /// The maximum number of times a node is expanded
+      std::size_t max_expansions;
+
+      /// The partial paths constructed so far
+      std::vector<Partial_Path> partial_paths;
+
+      /// The partial paths to be extended
+      std::priority_queue<Queue_Entry, std::vector<Queue_Entry>, std::greater<>> queue;
+
+      /// The number of times every node has been expanded
+      std::vector<std::size_t> expansions;
+
+      /// The partial paths whose estimate exceeds the limit are discarded
+      Weight_Type limit = std::numeric_limits<Weight_Type>::max();
+
+      /// It constructs the state, adding the partial path made only by the root
+      /// \param graph The graph
+      /// \param root The root node id
+      /// \param sink The sink node id
+      /// \param lower_bounds The lower bounds of the distances from the sink
+      /// \param max_expansions The maximum number of times a node is expanded
+      Search_State(t_Weighted_Graph_Complete_Type const   &graph,
+                   Node_Id_Type                            root,
+                   Node_Id_Type                            sink,
+                   std::shared_ptr<Lower_Bounds_Type const> lower_bounds,
+                   std::size_t                             max_expansions);
+    };
+
+    /// Enumerator of the paths. It owns the state of its search
+    class A_Star_Enumerator final : public Enumerator_Type
+    {
+    private:
+      /// The state of the search. If it's nullptr, there are no paths to produce
+      std::unique_ptr<Search_State> state;
+
+    public:
+      /// It produces the next shortest path
+      /// \return The next shortest path or std::nullopt if there are no more paths
+      [[nodiscard]] auto
+      next() -> std::optional<typename Enumerator_Type::Element_Type> override
+      {
+        if (!state)
+          return std::nullopt;
+
+        auto const path = next_path(*state);
+
+        if (!path)
+          return std::nullopt;
+
+        return convert(*state, *path);
+      }
+
+      /// Constructs the enumerator from the state of a search
+      /// \param state The state of the search
+      explicit A_Star_Enumerator(std::unique_ptr<Search_State> state)
+        : state(std::move(state))
+      {}
+
+      ~A_Star_Enumerator() override = default;
+    };
+
+    /// The mutex protecting lower_bounds
+    mutable std::mutex lower_bounds_mutex;
+
+    /// The lower bounds of the distances from the sink. If they're not provided, the exact distances are computed (and
+    /// cached) by the first search
+    mutable std::shared_ptr<Lower_Bounds_Type const> lower_bounds;
+
+
+    /// It returns the lower bounds, computing the exact distances from the sink if they were not provided
+    /// \return The lower bounds
+    [[nodiscard]] auto
+    get_lower_bounds() const -> std::shared_ptr<Lower_Bounds_Type const>;
+
+
+    /// It constructs the state of a new search
+    /// \param max_expansions The maximum number of times a node is expanded
+    /// \return The state of the search
+    [[nodiscard]] auto
+    search_state(std::size_t max_expansions) const -> std::unique_ptr<Search_State>;
+
+
+    /// It extracts the next shortest path. The first extracted path is the shortest one
+    /// \param state The state of the search
+    /// \return The position of the path (in state.partial_paths) or std::nullopt if there are no more paths
+    static auto
+    next_path(Search_State &state) -> std::optional<std::size_t>;
+
+
+    /// It finds the first K shortest paths that satisfy the given bound. The search stops as soon as the estimate of
+    /// the next partial path exceeds the bound
+    /// \param K The number of shortest paths
+    /// \param bound The upper bound on the length of the paths
+    /// \param state The state of the search
+    /// \return The positions of the paths (in state.partial_paths)
+    [[nodiscard]] static auto
+    bounded_paths(std::size_t K, Length_Bound_Type const &bound, Search_State &state) -> std::vector<std::size_t>;
+
+
+    /// It converts a path to the output type
+    /// \param state The state of the search
+    /// \param path The position of the path (in state.partial_paths)
+    /// \return The converted path
+    [[nodiscard]] static auto
+    convert(Search_State const &state, std::size_t path) -> typename Output_Type::value_type;
+
+  public:
+    /// Applies the A* search to find the k-shortest paths on the given graph (from the root to the sink)
+    /// \param K The number of shortest paths to find
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute(std::size_t K) const -> Output_Type override;
+
+    /// Applies the A* search to find the k-shortest paths whose length doesn't exceed the given bound. The partial
+    /// paths whose estimate exceeds the bound are never constructed
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute_bounded(std::size_t K, Length_Bound_Type const &bound) const -> Output_Type override;
+
+    /// It finds the k-shortest paths, independently of Only_Distance, as a compact collection. No shortest path tree
+    /// is required: every edge of a path is stored as a sidetrack, and the paths share their common prefixes
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths (by default, the length is not bounded)
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute_path_trie(std::size_t K, Length_Bound_Type const &bound = Length_Bound_Type()) const
+      -> Path_Trie_Type override;
+
+    /// It returns an enumerator that produces the shortest paths one at a time, in nondecreasing order of length.
+    /// Since the number of paths is not known, the nodes can be expanded any number of times
+    /// \return The enumerator
+    [[nodiscard]] auto
+    enumerate() const -> std::unique_ptr<Enumerator_Type> override;
+
+    /// It sets the lower bounds of the distances from the sink (the maximum weight marks the nodes that cannot reach
+    /// the sink). They must be consistent, i.e., the bound of the tail of an edge must not exceed the weight of the
+    /// edge plus the bound of its head, otherwise the paths may be produced out of order
+    /// \param bounds The lower bounds
+    void
+    set_lower_bounds(Lower_Bounds_Type bounds);
+
+    /// Constructor for the KFinder associated to the A* search
+    /// \param g The graph
+    /// \param root The root node id
+    /// \param sink The sink node id
+    explicit KFinder_A_Star(GraphType const &g, Node_Id_Type root, Node_Id_Type sink)
+      : Parent_Type(g, root, sink){};
+
+    /// Constructor for the KFinder associated to the A* search
+    /// \param g The graph
+    /// \param root The root node id
+    /// \param sink The sink node id
+    explicit KFinder_A_Star(t_Weighted_Graph_Complete_Type const &g, Node_Id_Type root, Node_Id_Type sink)
+      : Parent_Type(g, root, sink){};
+
+    ~KFinder_A_Star() override = default;
+  };
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::Search_State::Search_State(
+    t_Weighted_Graph_Complete_Type const   &graph,
+    Node_Id_Type                            root,
+    Node_Id_Type                            sink,
+    std::shared_ptr<Lower_Bounds_Type const> lower_bounds,
+    std::size_t                             max_expansions)
+    : graph(graph)
+    , sink(sink)
+    , lower_bounds(std::move(lower_bounds))
+    , max_expansions(max_expansions)
+    , expansions(graph.size(), 0)
+  {
+    auto const root_bound = (*this->lower_bounds)[root];
+
+    if (root_bound != std::numeric_limits<Weight_Type>::max())
+      {
+        partial_paths.push_back(Partial_Path{.node = root, .parent = No_Parent, .length = 0});
+        queue.push(Queue_Entry{.estimate = root_bound, .partial_path = 0});
+      }
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute(std::size_t K) const
+    -> Output_Type
+  {
+    return compute_bounded(K, Length_Bound_Type());
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_bounded(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> Output_Type
+  {
+    if (graph.empty() || K == 0)
+      return {};
+
+    auto const state = search_state(K);
+    auto const paths = bounded_paths(K, bound, *state);
+
+    Output_Type res;
+    res.reserve(paths.size());
+
+    for (auto const &path : paths)
+      res.push_back(convert(*state, path));
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_path_trie(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> Path_Trie_Type
+  {
+    if (graph.empty() || K == 0)
+      return {};
+
+    auto const state = search_state(K);
+    auto const paths = bounded_paths(K, bound, *state);
+
+    // There's no shortest path tree: the trie never visits the successors
+    Path_Trie_Type res(std::make_shared<std::vector<Node_Id_Type> const>(), root, sink);
+
+    // The position in the trie of the last edge of every partial path that has been added
+    std::vector<std::size_t> trie_positions(state->partial_paths.size(), Path_Trie_Type::No_Sidetrack);
+    std::vector<std::size_t> missing;
+
+    for (auto const &path : paths)
+      {
+        // Collect the partial paths (from the last one) that are not in the trie yet
+        missing.clear();
+        for (auto current = path; state->partial_paths[current].parent != No_Parent &&
+                                  trie_positions[current] == Path_Trie_Type::No_Sidetrack;
+             current = state->partial_paths[current].parent)
+          missing.push_back(current);
+
+        for (auto it = missing.crbegin(); it != missing.crend(); ++it)
+          {
+            auto const &partial_path = state->partial_paths[*it];
+            auto const  parent       = partial_path.parent;
+
+            trie_positions[*it] =
+              res.add_sidetrack(std::make_pair(state->partial_paths[parent].node, partial_path.node),
+                                trie_positions[parent]);
+          }
+
+        res.add_path(state->partial_paths[path].length, trie_positions[path]);
+      }
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::enumerate() const
+    -> std::unique_ptr<Enumerator_Type>
+  {
+    if (graph.empty())
+      return std::make_unique<A_Star_Enumerator>(nullptr);
+
+    return std::make_unique<A_Star_Enumerator>(search_state(std::numeric_limits<std::size_t>::max()));
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  void
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::set_lower_bounds(
+    Lower_Bounds_Type bounds)
+  {
+    if (bounds.size() != graph.size())
+      {
+        throw std::invalid_argument("KFinder_A_Star::set_lower_bounds : the number of lower bounds (" +
+                                    std::to_string(bounds.size()) + ") doesn't match the number of nodes (" +
+                                    std::to_string(graph.size()) + ")");
+      }
+
+    std::scoped_lock lock(lower_bounds_mutex);
+    lower_bounds = std::make_shared<Lower_Bounds_Type const>(std::move(bounds));
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::get_lower_bounds() const
+    -> std::shared_ptr<Lower_Bounds_Type const>
+  {
+    std::scoped_lock lock(lower_bounds_mutex);
+
+    if (!lower_bounds)
+      {
+        auto dij_res = Shortest_path_finder::shortest_path_tree(graph.reverse(), sink);
+        lower_bounds = std::make_shared<Lower_Bounds_Type const>(std::move(dij_res.second));
+      }
+
+    return lower_bounds;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::search_state(
+    std::size_t max_expansions) const -> std::unique_ptr<Search_State>
+  {
+    return std::make_unique<Search_State>(graph, root, sink, get_lower_bounds(), max_expansions);
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::next_path(Search_State &state)
+    -> std::optional<std::size_t>
+  {
+    auto const &bounds = *state.lower_bounds;
+
+    while (!state.queue.empty())
+      {
+        auto const entry = state.queue.top();
+        state.queue.pop();
+
+        // The estimates are extracted in nondecreasing order: the following partial paths exceed the limit too
+        if (entry.estimate > state.limit)
+          {
+            state.queue = {};
+            return std::nullopt;
+          }
+
+        auto const tail = state.partial_paths[entry.partial_path].node;
+
+        // With a consistent bound, the partial paths reaching a node are extracted in nondecreasing order of length:
+        // the following ones can only produce paths longer than the ones produced by the previous expansions
+        if (state.expansions[tail] >= state.max_expansions)
+          continue;
+
+        ++state.expansions[tail];
+
+        if (tail == state.sink)
+          return entry.partial_path;
+
+        auto const length = state.partial_paths[entry.partial_path].length;
+
+        for (auto const &head : state.graph.get_output_nodes(tail))
+          {
+            auto const head_bound = bounds[head];
+
+            // The sink cannot be reached from the head
+            if (head_bound == std::numeric_limits<Weight_Type>::max())
+              continue;
+
+            // Parallel edges produce different partial paths
+            for (auto const &weight : state.graph.get_weight(std::make_pair(tail, head)))
+              {
+                auto const head_length = length + weight;
+                auto const estimate    = head_length + head_bound;
+
+                if (estimate > state.limit)
+                  continue;
+
+                state.partial_paths.push_back(
+                  Partial_Path{.node = head, .parent = entry.partial_path, .length = head_length});
+                state.queue.push(Queue_Entry{.estimate = estimate, .partial_path = state.partial_paths.size() - 1});
+              }
+          }
+      }
+
+    return std::nullopt;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::bounded_paths(
+    std::size_t              K,
+    Length_Bound_Type const &bound,
+    Search_State            &state) -> std::vector<std::size_t>
+  {
+    std::vector<std::size_t> res;
+    res.reserve(K);
+
+    // The absolute bound is known in advance, the relative one only after the shortest path has been found
+    if (bound.max_length)
+      state.limit = *bound.max_length;
+
+    while (res.size() < K)
+      {
+        auto const path = next_path(state);
+
+        if (!path)
+          break;
+
+        if (res.empty())
+          {
+            state.limit = bound.limit(state.partial_paths[*path].length);
+
+            if (state.partial_paths[*path].length > state.limit)
+              break;
+          }
+
+        res.push_back(*path);
+      }
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_A_Star<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::convert(Search_State const &state,
+                                                                                    std::size_t         path)
+    -> typename Output_Type::value_type
+  {
+    if constexpr (Only_Distance)
+      {
+        return state.partial_paths[path].length;
+      }
+    else
+      {
+        Path_Info info;
+        info.length = state.partial_paths[path].length;
+
+        for (auto current = path; current != No_Parent; current = state.partial_paths[current].parent)
+          info.path.push_back(state.partial_paths[current].node);
+
+        std::reverse(info.path.begin(), info.path.end());
+
+        return info;
+      }
+  }
+} // namespace network_butcher::kfinder
+
+#endif // NETWORK_BUTCHER_KASTAR_H
@@ -1,7 +1,9 @@
 #ifndef NETWORK_BUTCHER_KEPPSTEIN_H
 #define NETWORK_BUTCHER_KEPPSTEIN_H
 
-#include <list>
+#include <algorithm>
+#include <numeric>
+#include <thread>
 
 #include <network_butcher/K-shortest_path/basic_keppstein.h>
 #include <network_butcher/Traits/traits.h>
@@ -15,7 +17,7 @@ namespace network_butcher::kfinder
   template <typename GraphType,
             bool                 Only_Distance                  = false,
             Valid_Weighted_Graph t_Weighted_Graph_Complete_Type = Weighted_Graph<GraphType>>
-  class KFinder_Eppstein final : public Basic_KEppstein<GraphType, Only_Distance, t_Weighted_Graph_Complete_Type>
+  class KFinder_Eppstein : public Basic_KEppstein<GraphType, Only_Distance, t_Weighted_Graph_Complete_Type>
   {
   private:
     /// The parent type. Used to access quickly to the parent methods
@@ -25,7 +27,7 @@ namespace network_butcher::kfinder
     /// The type of the output of the algorithm
     using Output_Type = Parent_Type::Output_Type;
 
-  private:
+  protected:
     /// Bring forward the graph
     using Parent_Type::graph;
 
@@ -53,35 +55,68 @@ namespace network_butcher::kfinder
     /// Type of the collection of H_out
     using H_out_collection = Parent_Type::H_out_collection;
 
+    /// Type of the state of the search
+    using Search_State = Parent_Type::Search_State;
+
+  private:
+    /// Type of the collection of the arenas used by the parallel construction of the heaps
+    using Arena_Collection_Type = std::deque<typename Parent_Type::Arena_Type>;
+
+    /// Minimum number of nodes processed by a single task during the construction of the heaps
+    static constexpr std::size_t Min_Nodes_Per_Task = 256;
+
+
+    /// It returns the number of tasks used to process the given number of nodes: a few tasks per thread (to balance
+    /// the load), each one with at least Min_Nodes_Per_Task nodes
+    /// \param num_nodes The number of nodes
+    /// \return The number of tasks
+    [[nodiscard]] static auto
+    num_tasks(std::size_t num_nodes) -> std::size_t;
 
-    /// Given the successors collection and the sidetrack distances, it will construct the h_out map. O(M)
+
+    /// It executes func(task) for every task in [0, num_tasks), in parallel. Since the arenas are not thread safe, it
+    /// makes sure that arenas contains an arena for every task: the task i should only use the arena arenas[i]
+    /// \param num_tasks The number of tasks
+    /// \param arenas The arenas
+    /// \param func The function to execute
+    template <typename Task_Function>
+    static void
+    run_tasks(std::size_t num_tasks, Arena_Collection_Type &arenas, Task_Function const &func);
+
+
+    /// Given the successors collection and the sidetrack distances, it will construct the h_out collection. The H_outs
+    /// are independent, thus they are constructed in parallel: the nodes are split in contiguous chunks, each one with
+    /// its own arena. O(M)
     /// \param successors The list of the successors of every node (the node following the current one in the
     /// shortest path)
     /// \param sidetrack_distances The collection of the sidetrack distances for all the sidetrack edges
-    /// \return H_out map
+    /// \param arenas The arenas used to allocate the nodes of the H_outs
+    /// \return H_out collection
     [[nodiscard]] auto
     construct_h_out(std::vector<Node_Id_Type> const       &successors,
-                    Internal_Weight_Collection_Type const &sidetrack_distances) const -> H_out_collection;
+                    Internal_Weight_Collection_Type const &sidetrack_distances,
+                    Arena_Collection_Type                 &arenas) const -> H_out_collection;
 
 
-    /// It will produce the map associating every node to its corresponding H_g map. O(N*log(N))
+    /// It will produce the collection associating every node to its corresponding H_g. The H_g of a node only depends
+    /// on the H_g of its successor: the shortest path tree is visited level by level (starting from the sink) and the
+    /// H_gs of the nodes of a level are constructed in parallel. O(N*log(N))
     /// \param h_out_collection The collection of h_outs
     /// \param successors The successors list
-    /// \return The map associating every node to its corresponding H_g map
+    /// \param resource The memory resource used to allocate the nodes of the H_gs, when a level is processed serially
+    /// \param arenas The arenas used to allocate the nodes of the H_gs, when a level is processed in parallel
+    /// \return The collection associating every node to its corresponding H_g
     [[nodiscard]] auto
-    construct_h_g(H_out_collection const &h_out_collection, std::vector<Node_Id_Type> const &successors) const
-      -> H_g_collection;
+    construct_h_g(H_out_collection const          &h_out_collection,
+                  std::vector<Node_Id_Type> const &successors,
+                  std::pmr::memory_resource       *resource,
+                  Arena_Collection_Type           &arenas) const -> H_g_collection;
 
 
-    /// The basic function for the Eppstein algorithm
-    /// \param K The number of shortest paths
-    /// \param dij_res The result of dijkstra
-    /// \param sidetrack_distances The collection of the sidetrack distances for all the sidetrack edges
-    /// \return The k shortest paths
-    [[nodiscard]] auto
-    start(std::size_t                              K,
-          Parent_Type::Dijkstra_Result_Type const &dij_res,
-          Internal_Weight_Collection_Type const   &sidetrack_distances) const -> Output_Type override;
+    /// The basic function for the Eppstein algorithm. It constructs all the H_outs and H_gs in the state
+    /// \param state The state of the search
+    void
+    start(Search_State &state) const override;
 
   public:
     /// Constructor for the KFinder associated to the Eppstein algorithm
@@ -103,19 +138,14 @@ namespace network_butcher::kfinder
 
 
   template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
-  auto
-  KFinder_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::start(
-    std::size_t                            K,
-    Dijkstra_Result_Type const            &dij_res,
-    Internal_Weight_Collection_Type const &sidetrack_distances) const -> Output_Type
+  void
+  KFinder_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::start(Search_State &state) const
   {
-    auto const &successors = dij_res.first;
-
-    auto h_out = construct_h_out(successors, sidetrack_distances); // O(E)
-    auto h_g   = construct_h_g(h_out, successors);     // O(N*log(N))
+    auto const &successors = state.dij_res.first;
 
-    // O(K*log(K)) + O(Path_reconstruction)
-    return Parent_Type::general_algo_eppstein(K, dij_res, sidetrack_distances, h_g, h_out);
+    // The arenas of the state own the nodes of every heap. They're released in one shot with the state
+    state.h_out = construct_h_out(successors, state.sidetrack_distances, state.worker_arenas); // O(E)
+    state.h_g = construct_h_g(state.h_out, successors, &state.arena, state.worker_arenas); // O(N*log(N))
   }
 
 
@@ -123,42 +153,47 @@ namespace network_butcher::kfinder
   auto
   KFinder_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::construct_h_out(
     std::vector<Node_Id_Type> const       &successors,
-    Internal_Weight_Collection_Type const &sidetrack_distances) const -> H_out_collection
+    Internal_Weight_Collection_Type const &sidetrack_distances,
+    Arena_Collection_Type                 &arenas) const -> H_out_collection
   {
-    auto const &graph = Parent_Type::graph;
+    auto const &graph     = Parent_Type::graph;
+    auto const  num_nodes = graph.size();
 
-    H_out_collection h_out_collection;
-    h_out_collection.reserve(graph.size());
+    // Every node has its own slot, so that the H_outs can be constructed concurrently
+    H_out_collection h_out_collection(num_nodes);
 
-    for (auto const &tail_node : graph)
-      {
-        auto const &tail           = tail_node.get_id();
-        auto const &tail_successor = successors[tail];
+    auto const tasks = num_tasks(num_nodes);
 
-        if (tail_successor == std::numeric_limits<Node_Id_Type>::max())
-          continue;
+    run_tasks(tasks, arenas, [&](std::size_t task) {
+      auto *const resource = &arenas[task];
 
-        // The output neighbors of the current node
-        auto const            &head_nodes = graph.get_output_nodes(tail);
-        std::vector<Edge_Info> sidetrack_edges;
-        sidetrack_edges.reserve(sidetrack_distances[tail].size());
+      for (Node_Id_Type tail = task * num_nodes / tasks; tail < (task + 1) * num_nodes / tasks; ++tail)
+        {
+          auto const &tail_successor = successors[tail];
 
-        // Loop through the output neighbors of the current node
-        for (auto const &head : head_nodes)
-          {
-            auto [begin, end] = sidetrack_distances[tail].equal_range(head);
+          if (tail_successor == std::numeric_limits<Node_Id_Type>::max())
+            continue;
 
-            for (; begin != end && begin->first == head; ++begin)
-              {
-                sidetrack_edges.emplace_back(std::make_pair(tail, head), begin->second);
-              }
-          }
+          // The output neighbors of the current node
+          auto const            &head_nodes = graph.get_output_nodes(tail);
+          std::vector<Edge_Info> sidetrack_edges;
+          sidetrack_edges.reserve(sidetrack_distances[tail].size());
 
-        // Add to the collection of H_outs
-        h_out_collection.emplace_hint(h_out_collection.end(),
-                                      tail,
-                                      typename H_out_collection::mapped_type(std::move(sidetrack_edges)));
-      }
+          // Loop through the output neighbors of the current node
+          for (auto const &head : head_nodes)
+            {
+              auto [begin, end] = sidetrack_distances[tail].equal_range(head);
+
+              for (; begin != end && begin->first == head; ++begin)
+                {
+                  sidetrack_edges.emplace_back(std::make_pair(tail, head), begin->second);
+                }
+            }
+
+          // Add to the collection of H_outs
+          h_out_collection[tail].emplace(std::move(sidetrack_edges), resource);
+        }
+    });
 
     return h_out_collection;
   }
@@ -168,70 +203,127 @@ namespace network_butcher::kfinder
   auto
   KFinder_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::construct_h_g(
     const H_out_collection          &h_out_collection,
-    const std::vector<Node_Id_Type> &successors) const -> H_g_collection
+    const std::vector<Node_Id_Type> &successors,
+    std::pmr::memory_resource       *resource,
+    Arena_Collection_Type           &arenas) const -> H_g_collection
   {
     auto const &num_nodes = graph.size();
 
-    H_g_collection h_g_collection;
-    h_g_collection.reserve(graph.size());
-
-    // sp_dependencies contains the predecessors of every node in the shortest path.
-    std::vector<std::set<Node_Id_Type>> sp_dependencies;
-    sp_dependencies.resize(num_nodes);
+    // Every node has its own slot, so that the H_gs of a level can be constructed concurrently
+    H_g_collection h_g_collection(num_nodes);
 
-    // At worst, since each node is contained in up to a single sp_dependencies, the loop takes at most O(N*log(N))
-    for (auto const &node : graph) // O(N)
+    // The children of every node in the shortest path tree, stored as flat arrays: the children of node i are
+    // children[children_offsets[i], children_offsets[i + 1])
+    std::vector<std::size_t> children_offsets(num_nodes + 1, 0);
+    for (Node_Id_Type node_id = 0; node_id < num_nodes; ++node_id) // O(N)
       {
-        auto const &node_id   = node.get_id();
         auto const &successor = successors[node_id];
 
-        if (successor == std::numeric_limits<Node_Id_Type>::max())
-          continue;
-
-        if (sink != node_id)
-          sp_dependencies[successor].insert(node_id); // O(log(N))
+        if (successor != std::numeric_limits<Node_Id_Type>::max() && node_id != sink)
+          ++children_offsets[successor + 1];
       }
 
-    // The actual generation of the H_g should now start from the sink node
-    auto h_out_iterator = h_out_collection.find(sink); // O(1), it always exists
+    std::partial_sum(children_offsets.cbegin(), children_offsets.cend(), children_offsets.begin()); // O(N)
+
+    std::vector<Node_Id_Type> children(children_offsets.back());
+    {
+      std::vector<std::size_t> positions(children_offsets.cbegin(), std::prev(children_offsets.cend()));
+      for (Node_Id_Type node_id = 0; node_id < num_nodes; ++node_id) // O(N)
+        {
+          auto const &successor = successors[node_id];
+
+          if (successor != std::numeric_limits<Node_Id_Type>::max() && node_id != sink)
+            children[positions[successor]++] = node_id;
+        }
+    }
 
     // Prepare the last H_g
-    h_g_collection.emplace(sink, typename H_g_collection::mapped_type(&h_out_iterator->second)); // O(1)
+    h_g_collection[sink].emplace(&h_out_collection[sink].value(), resource); // O(1)
 
-    // Now, we have to find the nodes whose successor is the sink itself
-    std::queue<Node_Id_Type> queue;
-    for (auto const &node : graph) // O(N)
-      {
-        auto const &id = node.get_id();
-        if (successors[id] == sink && id != sink) // O(1)
-          queue.push(id);
-      }
+    // The nodes at the current depth of the shortest path tree
+    std::vector<Node_Id_Type> level{sink};
+    std::vector<Node_Id_Type> next_level;
 
-    // Loop through the queue
-    while (!queue.empty()) // O(N)
+    // Every node is contained in exactly one level
+    while (!level.empty()) // O(N)
       {
-        auto const &front_element = queue.front();
-
-        // Find the "new" nodes that must be added to the queue.
-        auto       &deps          = sp_dependencies[front_element];       // O(1)
-        auto const &successor_h_g = h_g_collection.find(successors[front_element])->second; // O(1)
+        next_level.clear();
+        for (auto const &node : level)
+          {
+            next_level.insert(next_level.end(),
+                              std::next(children.cbegin(), children_offsets[node]),
+                              std::next(children.cbegin(), children_offsets[node + 1]));
+          }
 
-        h_g_collection.emplace(front_element,
-                               typename H_g_collection::mapped_type(&(h_out_collection.find(front_element)->second),
-                                                                    successor_h_g)); // O(log(N))
+        // Construct the H_g of a node, given the memory resource
+        auto const construct = [&h_g_collection, &h_out_collection, &successors](Node_Id_Type               node,
+                                                                                std::pmr::memory_resource *res) {
+          h_g_collection[node].emplace(&h_out_collection[node].value(),
+                                       h_g_collection[successors[node]].value(),
+                                       res); // O(log(N))
+        };
 
+        auto const level_size = next_level.size();
+        auto const tasks      = num_tasks(level_size);
 
-        // Among the different iterations, this loop is performed at most N times. Moreover, every iteration of the
-        // loop will add a new node to the queue. This means that this loop doesn't change the worst case complexity
-        // of the overall method
-        for (auto &n : deps)
-          queue.push(n);
+        // Small levels are not worth the overhead of the parallel execution
+        if (tasks == 1)
+          {
+            for (auto const &node : next_level)
+              construct(node, resource);
+          }
+        else
+          {
+            run_tasks(tasks, arenas, [&](std::size_t task) {
+              for (std::size_t i = task * level_size / tasks; i < (task + 1) * level_size / tasks; ++i)
+                construct(next_level[i], &arenas[task]);
+            });
+          }
 
-        queue.pop(); // O(1)
+        std::swap(level, next_level);
       }
 
     return h_g_collection;
   }
+
+
+  template <class Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::num_tasks(std::size_t num_nodes)
+    -> std::size_t
+  {
+    auto const num_threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    return std::clamp<std::size_t>((num_nodes + Min_Nodes_Per_Task - 1) / Min_Nodes_Per_Task, 1, 4 * num_threads);
+  }
+
+
+  template <class Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  template <typename Task_Function>
+  void
+  KFinder_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::run_tasks(std::size_t num_tasks,
+                                                                                        Arena_Collection_Type &arenas,
+                                                                                        Task_Function const   &func)
+  {
+    while (arenas.size() < num_tasks)
+      arenas.emplace_back();
+
+#if NETWORK_BUTCHER_PARALLEL_TBB
+    std::vector<std::size_t> v(num_tasks);
+    std::generate(v.begin(), v.end(), [n = 0]() mutable { return n++; });
+
+    std::for_each(std::execution::par, v.cbegin(), v.cend(), func);
+#else
+#  pragma omp parallel default(none) shared(num_tasks, func)
+    {
+#  pragma omp for schedule(dynamic)
+      for (std::size_t i = 0; i < num_tasks; ++i)
+        {
+          func(i);
+        }
+    }
+#endif
+  }
 } // namespace network_butcher::kfinder
 
 
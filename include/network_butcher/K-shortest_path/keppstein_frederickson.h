@@ -0,0 +1,115 @@
+#ifndef NETWORK_BUTCHER_KEPPSTEIN_FREDERICKSON_H
+#define NETWORK_BUTCHER_KEPPSTEIN_FREDERICKSON_H
+
+#include <network_butcher/K-shortest_path/keppstein.h>
+
+namespace network_butcher::kfinder
+{
+  /// This class implements the Eppstein K-shortest path algorithm, selecting the K shortest paths from the path graph
+  /// through the heap selection of Frederickson instead of extracting them one at a time from a priority queue. The
+  /// heaps are constructed as in KFinder_Eppstein. The enumerator still extracts the paths one at a time
+  /// \tparam GraphType The graph type
+  template <typename GraphType,
+            bool                 Only_Distance                  = false,
+            Valid_Weighted_Graph t_Weighted_Graph_Complete_Type = Weighted_Graph<GraphType>>
+  class KFinder_Eppstein_Frederickson final
+    : public KFinder_Eppstein<GraphType, Only_Distance, t_Weighted_Graph_Complete_Type>
+  {
+  private:
+    /// The parent type. Used to access quickly to the parent methods
+    using Parent_Type = KFinder_Eppstein<GraphType, Only_Distance, t_Weighted_Graph_Complete_Type>;
+
+  public:
+    /// The type of the output of the algorithm
+    using Output_Type = Parent_Type::Output_Type;
+
+    /// The type of the upper bound on the length of the paths
+    using Length_Bound_Type = Parent_Type::Length_Bound_Type;
+
+  private:
+    /// Bring forward the graph
+    using Parent_Type::graph;
+
+    /// Bring forward the root node id
+    using Parent_Type::root;
+
+  public:
+    /// Applies the Eppstein algorithm (with the heap selection of Frederickson) to find the k-shortest paths on the
+    /// given graph (from the root to the sink). The heaps are cached among the different calls, but the paths are
+    /// selected from scratch every time. O(K*log(log(K))), plus the sorting of the paths
+    /// \param K The number of shortest paths to find
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute(std::size_t K) const -> Output_Type override;
+
+    /// Applies the Eppstein algorithm (with the heap selection of Frederickson) to find the k-shortest paths whose
+    /// length doesn't exceed the given bound. The paths of the path graph that exceed the bound are pruned as soon as
+    /// they're generated, thus the memory usage is proportional to the number of paths within the bound
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute_bounded(std::size_t K, Length_Bound_Type const &bound) const -> Output_Type override;
+
+    /// Constructor for the KFinder associated to the Eppstein algorithm with the heap selection of Frederickson
+    /// \param g The graph
+    /// \param root The root node id
+    /// \param sink The sink node id
+    explicit KFinder_Eppstein_Frederickson(GraphType const &g, Node_Id_Type root, Node_Id_Type sink)
+      : Parent_Type(g, root, sink){};
+
+    /// Constructor for the KFinder associated to the Eppstein algorithm with the heap selection of Frederickson
+    /// \param g The graph
+    /// \param root The root node id
+    /// \param sink The sink node id
+    explicit KFinder_Eppstein_Frederickson(t_Weighted_Graph_Complete_Type const &g,
+                                           Node_Id_Type                          root,
+                                           Node_Id_Type                          sink)
+      : Parent_Type(g, root, sink){};
+
+    ~KFinder_Eppstein_Frederickson() override = default;
+  };
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Eppstein_Frederickson<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute(
+    std::size_t K) const -> Output_Type
+  {
+    return compute_bounded(K, Length_Bound_Type());
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Eppstein_Frederickson<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_bounded(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> Output_Type
+  {
+    if (graph.empty() || K == 0)
+      return {};
+
+    auto const state = this->search_state();
+
+    std::scoped_lock lock(state->mutex);
+    auto const selected = this->frederickson_selection(K, *state, bound.limit(state->dij_res.second[root]));
+
+    if constexpr (Only_Distance)
+      {
+        Output_Type res;
+        res.reserve(selected.paths.size());
+
+        for (auto const &path : selected.paths)
+          res.push_back(path->length);
+
+        return res;
+      }
+    else
+      {
+        // O(Path_reconstruction)
+        return this->helper_eppstein(*state, selected.paths);
+      }
+  }
+} // namespace network_butcher::kfinder
+
+#endif // NETWORK_BUTCHER_KEPPSTEIN_FREDERICKSON_H
@@ -1,7 +1,7 @@
 #ifndef NETWORK_BUTCHER_KEPPSTEIN_LAZY_H
 #define NETWORK_BUTCHER_KEPPSTEIN_LAZY_H
 
-#include <list>
+#include <vector>
 
 #include <network_butcher/K-shortest_path/basic_keppstein.h>
 #include <network_butcher/Traits/traits.h>
@@ -55,21 +55,23 @@ namespace network_butcher::kfinder
     /// Type of the callback function
     using Callback_Function = Parent_Type::Callback_Function;
 
+    /// Type of the state of the search
+    using Search_State = Parent_Type::Search_State;
+
     /// It will generate the callback function used during the Eppstein main loop to construct the required H_gs (and
-    /// H_outs)
+    /// H_outs). The H_g of a node requires the H_g of its successor: the callback walks the shortest path towards the
+    /// sink until it finds an H_g that has already been constructed, and then it constructs the missing ones backwards.
+    /// It uses an explicit stack, thus the depth of the shortest path tree doesn't affect the call stack
+    /// \param resource The memory resource used to allocate the nodes of the H_outs and H_gs
     /// \return The generator function
     auto
-    construct_h_g_builder() const -> Callback_Function;
-
-    /// The basic function for the lazy Eppstein algorithm
-    /// \param K The number of shortest paths
-    /// \param dij_res The result of dijkstra
-    /// \param sidetrack_distances The collection of the sidetrack distances for all the sidetrack edges
-    /// \return The (implicit) k shortest paths
-    [[nodiscard]] auto
-    start(std::size_t                            K,
-          Dijkstra_Result_Type const            &dij_res,
-          Internal_Weight_Collection_Type const &sidetrack_distances) const -> Output_Type override;
+    construct_h_g_builder(std::pmr::memory_resource *resource) const -> Callback_Function;
+
+    /// The basic function for the lazy Eppstein algorithm. It constructs the callback function that will construct
+    /// the H_gs on demand, and it uses it to construct the H_gs of the nodes of the shortest path
+    /// \param state The state of the search
+    void
+    start(Search_State &state) const override;
 
   public:
     /// Constructor for the KFinder associated to the Lazy Eppstein algorithm
@@ -91,56 +93,42 @@ namespace network_butcher::kfinder
 
 
   template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
-  auto
-  KFinder_Lazy_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::start(
-    std::size_t                            K,
-    Dijkstra_Result_Type const            &dij_res,
-    Internal_Weight_Collection_Type const &sidetrack_distances) const -> Output_Type
+  void
+  KFinder_Lazy_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::start(Search_State &state) const
   {
-    H_out_collection h_out;
-    H_g_collection   h_g;
+    auto &h_out = state.h_out;
+    auto &h_g   = state.h_g;
 
-    h_out.reserve(graph.size()); // Reserve space for the h_out collection O(N)
-    h_g.reserve(graph.size());   // Reserve space for the h_g collection   O(N)
+    h_out.resize(graph.size()); // Prepare a slot for every H_out O(N)
+    h_g.resize(graph.size());   // Prepare a slot for every H_g   O(N)
 
-    auto const &[successors, distances] = dij_res;
+    auto const &[successors, distances] = state.dij_res;
 
     if (distances[root] == std::numeric_limits<Weight_Type>::max())
-      return {};
-
-    std::list<Node_Id_Type> to_compute;
-    to_compute.push_back(root);
-
-    while (to_compute.back() != sink) // O(N)
-      to_compute.push_back(successors[to_compute.back()]);
+      return;
 
-    auto const fun = construct_h_g_builder(); // O(1)
+    // The arena of the state owns the nodes of every heap. It's released in one shot with the state
+    state.callback_fun = construct_h_g_builder(&state.arena); // O(1)
 
-    while (!to_compute.empty())         // O(E + N*log(N))
-      {
-        fun(h_g, h_out, sidetrack_distances, successors, to_compute.back(), graph);
-        to_compute.pop_back();
-      }
-
-    // Execute the Eppstein algorithm
-    return Parent_Type::general_algo_eppstein(K, dij_res, sidetrack_distances, h_g, h_out, fun);
+    // The H_g of the root requires the H_gs of all the nodes of the shortest path
+    state.callback_fun(h_g, h_out, state.sidetrack_distances, successors, root, graph); // O(E + N*log(N))
   }
 
 
   template <class Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
   auto
-  KFinder_Lazy_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::construct_h_g_builder() const
-    -> Callback_Function
+  KFinder_Lazy_Eppstein<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::construct_h_g_builder(
+    std::pmr::memory_resource *resource) const -> Callback_Function
   {
-    auto const construct_h_out = [](auto       &h_out_collection,
-                                    auto const &sidetrack_distances,
-                                    auto const &successors,
-                                    auto        tail,
-                                    auto const &graph) -> auto {
+    auto const construct_h_out = [resource](auto       &h_out_collection,
+                                            auto const &sidetrack_distances,
+                                            auto const &successors,
+                                            auto        tail,
+                                            auto const &graph) -> auto {
       // If we can find the required H_out, return it
-      auto h_out_it = h_out_collection.find(tail); // O(1)
-      if (h_out_it != h_out_collection.cend())
-        return h_out_it;
+      auto &h_out = h_out_collection[tail]; // O(1)
+      if (h_out.has_value())
+        return &h_out.value();
 
       std::vector<Edge_Info> to_insert;
       auto const            &out_nodes = graph.get_output_nodes(tail); // O(1)
@@ -158,54 +146,48 @@ namespace network_butcher::kfinder
             }
         }
 
-      return h_out_collection.emplace(tail, typename H_out_collection::mapped_type(std::move(to_insert))).first;
+      return &h_out.emplace(std::move(to_insert), resource);
     };
 
     auto const &sink = Parent_Type::sink;
 
-    return [construct_h_out, sink](H_g_collection                        &h_g,
-                                   H_out_collection                      &h_out,
-                                   Internal_Weight_Collection_Type const &sidetrack_distances,
-                                   std::vector<Node_Id_Type> const       &successors,
-                                   Node_Id_Type                           node,
-                                   auto const                            &graph) {
-      auto const internal_builder = [&construct_h_out,
-                                     &sink](H_g_collection                        &h_g,
-                                            H_out_collection                      &h_out,
-                                            Internal_Weight_Collection_Type const &sidetrack_distances,
-                                            std::vector<Node_Id_Type> const       &successors,
-                                            Node_Id_Type                           node,
-                                            auto                                  &func,
-                                            auto const                            &graph) {
-        // If H_g has been already computed, return it
-        auto iterator = h_g.find(node); // O(1)
-
-        if (iterator != h_g.cend())
-          return iterator;
-
-        // Construct and/or retrieve the associated H_out
-        auto to_insert_h_out = construct_h_out(h_out, sidetrack_distances, successors, node, graph);
-
-        // If node is not the last node in the graph
-        if (node != sink)
-          {
-            // Construct the H_g of the successor of node in the shortest path
-            auto previous_inserted_h_g =
-              func(h_g, h_out, sidetrack_distances, successors, successors[node], func, graph);
-
-            // Insert in the successor H_g the current H_out, obtaining the H_g of the current node
-            return h_g
-              .emplace(node,
-                       typename H_g_collection::mapped_type(&(to_insert_h_out->second), previous_inserted_h_g->second))
-              .first; // O(log(N))
-          }
-        else
-          {
-            return h_g.emplace(node, typename H_g_collection::mapped_type(&(to_insert_h_out->second))).first; // O(1)
-          }
-      };
-
-      return internal_builder(h_g, h_out, sidetrack_distances, successors, node, internal_builder, graph);
+    return [construct_h_out, sink, resource](H_g_collection                        &h_g,
+                                             H_out_collection                      &h_out,
+                                             Internal_Weight_Collection_Type const &sidetrack_distances,
+                                             std::vector<Node_Id_Type> const       &successors,
+                                             Node_Id_Type                           node,
+                                             auto const                            &graph) {
+      // If H_g has been already computed, return it
+      if (h_g[node].has_value()) // O(1)
+        return &h_g[node].value();
+
+      // The nodes of the shortest path (from node) whose H_g is missing
+      std::vector<Node_Id_Type> to_compute{node};
+
+      while (to_compute.back() != sink && !h_g[successors[to_compute.back()]].has_value()) // O(N)
+        to_compute.push_back(successors[to_compute.back()]);
+
+      // Construct the H_gs backwards, starting from the one closest to the sink
+      for (auto it = to_compute.crbegin(); it != to_compute.crend(); ++it) // O(E + N*log(N))
+        {
+          auto const &current = *it;
+
+          // Construct and/or retrieve the associated H_out
+          auto to_insert_h_out = construct_h_out(h_out, sidetrack_distances, successors, current, graph);
+
+          // If current is not the last node in the graph
+          if (current != sink)
+            {
+              // Insert in the successor H_g the current H_out, obtaining the H_g of the current node
+              h_g[current].emplace(to_insert_h_out, h_g[successors[current]].value(), resource); // O(log(N))
+            }
+          else
+            {
+              h_g[current].emplace(to_insert_h_out, resource); // O(1)
+            }
+        }
+
+      return &h_g[node].value();
     };
   }
 } // namespace network_butcher::kfinder
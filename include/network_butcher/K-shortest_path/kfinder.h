@@ -1,11 +1,34 @@
 #ifndef NETWORK_BUTCHER_KFINDER_H
 #define NETWORK_BUTCHER_KFINDER_H
 
+#include <memory>
+#include <optional>
+
 #include <network_butcher/Traits/traits.h>
+#include <network_butcher/K-shortest_path/length_bound.h>
+#include <network_butcher/K-shortest_path/path_trie.h>
 #include <network_butcher/K-shortest_path/weighted_graph.h>
 
 namespace network_butcher::kfinder
 {
+  /// A (pure) virtual class that produces, one at a time, the shortest paths of a graph in nondecreasing order of
+  /// length. It's returned by KFinder::enumerate and it keeps alive the state of the search between the calls
+  /// \tparam t_Element_Type The type of the produced elements (either the length of the path or the full path)
+  template <typename t_Element_Type>
+  class Path_Enumerator
+  {
+  public:
+    /// The type of the produced elements
+    using Element_Type = t_Element_Type;
+
+    /// It produces the next shortest path
+    /// \return The next shortest path or std::nullopt if there are no more paths
+    [[nodiscard]] virtual auto
+    next() -> std::optional<Element_Type> = 0;
+
+    virtual ~Path_Enumerator() = default;
+  };
+
 
   /// A (pure) virtual class to find the K shortest path for a given graph
   /// \tparam GraphType The graph type. To be able to use the class, you must specialize Weighted_Graph<Graph_type>
@@ -26,6 +49,15 @@ namespace network_butcher::kfinder
     using Output_Type =
       std::conditional_t<Only_Distance, std::vector<Weight_Type>, std::vector<Templated_Path_Info<Weight_Type>>>;
 
+    /// The type of the enumerator returned by enumerate
+    using Enumerator_Type = Path_Enumerator<typename Output_Type::value_type>;
+
+    /// The type of the compact collection of paths returned by compute_path_trie
+    using Path_Trie_Type = Templated_Path_Trie<Weight_Type>;
+
+    /// The type of the upper bound on the length of the paths
+    using Length_Bound_Type = Templated_Length_Bound<Weight_Type>;
+
 
     /// Applies a K-shortest path algorithm to find the k-shortest paths on the given graph (from the first node to
     /// the last one)
@@ -34,6 +66,31 @@ namespace network_butcher::kfinder
     [[nodiscard]] virtual auto
     compute(std::size_t K) const -> Output_Type = 0;
 
+    /// Applies a K-shortest path algorithm to find the k-shortest paths whose length doesn't exceed the given bound.
+    /// The search stops as soon as the next path exceeds the bound, thus the paths longer than the bound are never
+    /// produced (and, if the bound is tight, K can be arbitrarily large)
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths
+    /// \return The shortest paths
+    [[nodiscard]] virtual auto
+    compute_bounded(std::size_t K, Length_Bound_Type const &bound) const -> Output_Type = 0;
+
+    /// It finds the k-shortest paths (independently of Only_Distance), returning them as a compact collection: the
+    /// shortest path tree is shared among all the paths, and every path only stores its sidetrack edges. The explicit
+    /// paths can be constructed on request
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths (by default, the length is not bounded)
+    /// \return The shortest paths
+    [[nodiscard]] virtual auto
+    compute_path_trie(std::size_t K, Length_Bound_Type const &bound = Length_Bound_Type()) const -> Path_Trie_Type = 0;
+
+    /// It returns an enumerator that produces the shortest paths (from the root to the sink) one at a time, in
+    /// nondecreasing order of length. The number of paths is not required in advance. The enumerator doesn't
+    /// depend on the KFinder, but it refers to the graph: the graph must outlive it
+    /// \return The enumerator
+    [[nodiscard]] virtual auto
+    enumerate() const -> std::unique_ptr<Enumerator_Type> = 0;
+
 
     /// Constructor for a K shortest path class
     /// \param g The graph
@@ -7,6 +7,7 @@
 
 #include <network_butcher/K-shortest_path/keppstein.h>
 #include <network_butcher/K-shortest_path/keppstein_lazy.h>
+#include <network_butcher/K-shortest_path/kyen.h>
 
 namespace network_butcher::kfinder
 {
@@ -71,6 +72,8 @@ namespace network_butcher::kfinder
             return create("eppstein", std::forward<Args>(args)...);
           case parameters::KSP_Method::Lazy_Eppstein:
             return create("lazy_eppstein", std::forward<Args>(args)...);
+          case parameters::KSP_Method::Yen:
+            return create("yen", std::forward<Args>(args)...);
           default:
             throw std::logic_error("The specified KSP_Method is not implemented.");
         }
@@ -140,6 +143,9 @@ namespace network_butcher::kfinder
                                                                                                        root,
                                                                                                        sink);
     });
+    factory.add("yen", [](T const &graph, Node_Id_Type root, Node_Id_Type sink) {
+      return std::make_unique<KFinder_Yen<T, Only_Distance, t_Weighted_Graph_Complete_Type>>(graph, root, sink);
+    });
   }
 
 
@@ -7,7 +7,8 @@ namespace network_butcher::parameters
   enum struct KSP_Method
   {
     Eppstein,
-    Lazy_Eppstein
+    Lazy_Eppstein,
+    Yen
   };
 } // namespace network_butcher::parameters
 
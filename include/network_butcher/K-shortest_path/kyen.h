@@ -0,0 +1,1010 @@
+#ifndef NETWORK_BUTCHER_KYEN_H
+#define NETWORK_BUTCHER_KYEN_H
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <network_butcher/K-shortest_path/kfinder.h>
+#include <network_butcher/K-shortest_path/path_info.h>
+#include <network_butcher/K-shortest_path/shortest_path_finder.h>
+#include <network_butcher/K-shortest_path/weighted_graph.h>
+#include <network_butcher/Traits/traits.h>
+
+namespace network_butcher::kfinder
+{
+  /// This class implements the Yen K-shortest path algorithm. Contrary to the Eppstein algorithms, it only produces
+  /// loopless paths (on acyclic graphs, the results are the same). Parallel edges are considered as different edges.
+  /// It includes the following improvements:
+  /// - Lawler: the spur nodes of a path that precede the node where it deviates from its parent are not considered
+  /// - Node classification: every spur path is found through a Dijkstra search guided by the distances from the sink
+  ///   (A*). A node whose shortest path to the sink avoids the removed nodes and edges completes the spur path, thus
+  ///   the search stops as soon as such a node is extracted from the queue
+  /// The spur paths of a path are independent, thus they are computed in parallel
+  /// \tparam GraphType The graph type
+  template <typename GraphType,
+            bool                 Only_Distance                  = false,
+            Valid_Weighted_Graph t_Weighted_Graph_Complete_Type = Weighted_Graph<GraphType>>
+  class KFinder_Yen final : public KFinder<GraphType, Only_Distance, t_Weighted_Graph_Complete_Type>
+  {
+  private:
+    /// The parent type. Used to access quickly to the parent methods
+    using Parent_Type = KFinder<GraphType, Only_Distance, t_Weighted_Graph_Complete_Type>;
+
+  public:
+    /// The type of the output of the algorithm
+    using Output_Type = Parent_Type::Output_Type;
+
+    /// The type of the enumerator returned by enumerate
+    using Enumerator_Type = Parent_Type::Enumerator_Type;
+
+    /// The type of the compact collection of paths returned by compute_path_trie
+    using Path_Trie_Type = Parent_Type::Path_Trie_Type;
+
+    /// The type of the upper bound on the length of the paths
+    using Length_Bound_Type = Parent_Type::Length_Bound_Type;
+
+  private:
+    /// Bring forward the graph
+    using Parent_Type::graph;
+
+    /// Bring forward the root node id
+    using Parent_Type::root;
+
+    /// Bring forward the sink node id
+    using Parent_Type::sink;
+
+    /// Weight Type
+    using Weight_Type = typename t_Weighted_Graph_Complete_Type::Weight_Type;
+
+    /// Type for a path, with its length
+    using Path_Info = Templated_Path_Info<Weight_Type>;
+
+    /// Type of the result of the Dijkstra algorithm
+    using Dijkstra_Result_Type =
+      network_butcher::kfinder::Shortest_path_finder::Templated_Dijkstra_Result_Type<Weight_Type>;
+
+    /// Minimum number of spur paths computed by a single task
+    static constexpr std::size_t Min_Spurs_Per_Task = 4;
+
+    /// An edge of the graph. Every edge is identified by its position in the edge collection of the state, so that
+    /// parallel edges are distinguished
+    struct Out_Edge
+    {
+      /// The head of the edge
+      Node_Id_Type head;
+
+      /// The weight of the edge
+      Weight_Type weight;
+    };
+
+    /// Simple struct to represent a loopless path
+    struct Yen_Path
+    {
+      /// The length of the path
+      Weight_Type length;
+
+      /// The nodes of the path
+      std::vector<Node_Id_Type> nodes;
+
+      /// The edges of the path (edges[i] goes from nodes[i] to nodes[i + 1])
+      std::vector<std::size_t> edges;
+
+      /// The position of the node where the path deviates from the path it was generated from (the spur node)
+      std::size_t deviation;
+    };
+
+    /// Simple struct to represent a candidate path implicitly: the prefix of a found path (up to the spur node),
+    /// followed by the edges found by the spur search and by the shortest path to the sink from the last of them. The
+    /// explicit path is constructed only when the candidate is extracted
+    struct Yen_Candidate : Crtp_Greater<Yen_Candidate>
+    {
+      /// The length of the path
+      Weight_Type length;
+
+      /// The position (in the found paths) of the path the candidate was generated from
+      std::size_t parent;
+
+      /// The position of the spur node in the parent path
+      std::size_t spur;
+
+      /// The edges found by the spur search, starting from the spur node
+      std::vector<std::size_t> spur_edges;
+
+      auto
+      operator<(Yen_Candidate const &rhs) const -> bool
+      {
+        return length < rhs.length ||
+               (length == rhs.length && (parent < rhs.parent || (parent == rhs.parent && spur < rhs.spur)));
+      }
+    };
+
+    /// A node of the prefix tree of the paths found so far: it represents the common prefix of some of the paths. The
+    /// children of a node (the longer prefixes) are stored as a linked list, since they are usually very few
+    struct Prefix_Node
+    {
+      /// The last edge of the prefix
+      std::size_t edge = std::numeric_limits<std::size_t>::max();
+
+      /// The first child of the node (or max, if there's none)
+      std::size_t first_child = std::numeric_limits<std::size_t>::max();
+
+      /// The next sibling of the node (or max, if there's none)
+      std::size_t next_sibling = std::numeric_limits<std::size_t>::max();
+    };
+
+    /// The data structures used by the spur searches of a single task. They're reused among the different searches:
+    /// every node is marked with the id of the last search that reached it, so that they never have to be cleared
+    struct Spur_Workspace
+    {
+      /// The id of the current search
+      std::size_t search = 0;
+
+      /// The id of the last search that reached the node
+      std::vector<std::size_t> reached;
+
+      /// The id of the last search that extracted the node from the queue
+      std::vector<std::size_t> closed;
+
+      /// The distance of the node from the spur node
+      std::vector<Weight_Type> distance;
+
+      /// The edge used to reach the node
+      std::vector<std::size_t> predecessor_edge;
+
+      /// The node the edge used to reach the node starts from
+      std::vector<Node_Id_Type> predecessor;
+
+      /// The queue of the search, as a binary heap
+      std::vector<std::pair<Weight_Type, Node_Id_Type>> queue;
+    };
+
+    /// The state of a K shortest path search: the shortest path tree (towards the sink), the paths found so far and the
+    /// candidate paths. It's shared by the KFinder and by its enumerators: every access must be performed while
+    /// holding its mutex
+    struct Search_State
+    {
+      /// The mutex protecting the state
+      std::mutex mutex;
+
+      /// The root node id
+      Node_Id_Type root;
+
+      /// The sink node id
+      Node_Id_Type sink;
+
+      /// The result of the Dijkstra algorithm (executed on the reversed graph, starting from the sink)
+      Dijkstra_Result_Type dij_res;
+
+      /// The edges of the graph, stored as flat arrays: the edges of node i are edges[edge_offsets[i],
+      /// edge_offsets[i + 1])
+      std::vector<std::size_t> edge_offsets;
+
+      /// The edges of the graph
+      std::vector<Out_Edge> edges;
+
+      /// The edge from every node to its successor in the shortest path tree
+      std::vector<std::size_t> tree_edges;
+
+      /// The nodes of the shortest path tree, sorted so that every node follows its successor
+      std::vector<Node_Id_Type> tree_order;
+
+      /// The position of every node in the path whose spur paths are being computed (or max, if it's not there)
+      std::vector<std::size_t> path_position;
+
+      /// The position (in the path whose spur paths are being computed) of the first node of the shortest path from
+      /// every node to the sink that belongs to the path (or max, if there's none)
+      std::vector<std::size_t> first_hit;
+
+      /// The workspaces of the spur searches, one per task
+      std::deque<Spur_Workspace> workspaces;
+
+      /// The prefix tree of the found paths. The first node represents the root
+      std::vector<Prefix_Node> prefixes = std::vector<Prefix_Node>(1);
+
+      /// The paths found so far
+      std::vector<Yen_Path> found;
+
+      /// The number of found paths whose spur paths have been computed
+      std::size_t expanded = 0;
+
+      /// The queue of the candidate paths. The same path may be generated more than once: the copies are discarded when
+      /// they're extracted
+      std::priority_queue<Yen_Candidate, std::vector<Yen_Candidate>, std::greater<>> candidates;
+
+      /// Constructs the state of a search, given the shortest path tree
+      /// \param graph The graph
+      /// \param root The root node id
+      /// \param sink The sink node id
+      /// \param dij_res The result of the Dijkstra algorithm
+      Search_State(t_Weighted_Graph_Complete_Type const &graph,
+                   Node_Id_Type                          root,
+                   Node_Id_Type                          sink,
+                   Dijkstra_Result_Type                  dij_res);
+
+      Search_State(Search_State const &) = delete;
+
+      auto
+      operator=(Search_State const &) -> Search_State & = delete;
+    };
+
+    /// The enumerator of the Yen algorithm. It shares the state of the search with the KFinder that produced it, but
+    /// it doesn't depend on the KFinder itself
+    class Yen_Enumerator final : public Enumerator_Type
+    {
+    private:
+      /// The state of the search. If it's nullptr, there are no paths to produce
+      std::shared_ptr<Search_State> state;
+
+      /// The position (in state->found) of the next path to produce
+      std::size_t position = 0;
+
+    public:
+      /// It produces the next shortest path
+      /// \return The next shortest path or std::nullopt if there are no more paths
+      [[nodiscard]] auto
+      next() -> std::optional<typename Enumerator_Type::Element_Type> override
+      {
+        if (!state)
+          return std::nullopt;
+
+        std::scoped_lock lock(state->mutex);
+
+        if (position == state->found.size() && next_path(*state) == nullptr)
+          return std::nullopt;
+
+        return convert(state->found[position++]);
+      }
+
+      /// Constructs the enumerator from the state of a search
+      /// \param state The state of the search
+      explicit Yen_Enumerator(std::shared_ptr<Search_State> state)
+        : state(std::move(state))
+      {}
+
+      ~Yen_Enumerator() override = default;
+    };
+
+    /// The mutex protecting cached_state
+    mutable std::mutex cache_mutex;
+
+    /// The state of the search, cached among the different calls
+    mutable std::shared_ptr<Search_State> cached_state;
+
+
+    /// It returns the cached state of the search, constructing it (i.e., executing the Dijkstra algorithm) if needed
+    /// \return The state of the search
+    [[nodiscard]] auto
+    search_state() const -> std::shared_ptr<Search_State>;
+
+
+    /// It returns the child of the given node of the prefix tree obtained by adding the given edge
+    /// \param state The state of the search
+    /// \param prefix The node of the prefix tree
+    /// \param edge The edge
+    /// \return The child (or max, if there's none)
+    [[nodiscard]] static auto
+    prefix_child(Search_State const &state, std::size_t prefix, std::size_t edge) -> std::size_t;
+
+
+    /// It checks if the given path has been already found, walking the prefix tree
+    /// \param state The state of the search
+    /// \param path The path
+    /// \return True if the path has been already found
+    [[nodiscard]] static auto
+    is_found(Search_State const &state, Yen_Path const &path) -> bool;
+
+
+    /// It converts a candidate to an explicit path
+    /// \param state The state of the search
+    /// \param candidate The candidate
+    /// \return The explicit path
+    [[nodiscard]] static auto
+    explicit_path(Search_State const &state, Yen_Candidate const &candidate) -> Yen_Path;
+
+
+    /// It adds the given path to the found paths (and to their prefix tree)
+    /// \param state The state of the search
+    /// \param path The path
+    /// \return The added path
+    static auto
+    add_found(Search_State &state, Yen_Path path) -> Yen_Path const *;
+
+
+    /// It extracts the next shortest path. The first extracted path is the shortest one
+    /// \param state The state of the search
+    /// \return The next path (stored in state.found) or nullptr if there are no more paths
+    static auto
+    next_path(Search_State &state) -> Yen_Path const *;
+
+
+    /// It computes the spur paths of the given found path, adding them to the candidates. The spur paths are computed
+    /// in parallel
+    /// \param state The state of the search
+    /// \param path_id The position of the path in the found paths
+    static void
+    add_spur_paths(Search_State &state, std::size_t path_id);
+
+
+    /// It finds the shortest path that shares the first spur + 1 nodes with the given path, but that deviates from
+    /// all the found paths with the same prefix, i.e., the shortest path from the spur node to the sink that avoids
+    /// the previous nodes of the path and the blocked edges. The search is guided by the distances from the sink, and
+    /// it stops as soon as it extracts a node whose shortest path to the sink avoids the first spur + 1 nodes of the
+    /// path
+    /// \param state The state of the search
+    /// \param workspace The workspace of the search
+    /// \param path_id The position of the path in the found paths
+    /// \param prefix_lengths The lengths of the prefixes of the path
+    /// \param spur The position of the spur node in the path
+    /// \param blocked_edges The (sorted) edges exiting the spur node that must be avoided
+    /// \return The spur path (if it exists), as a candidate
+    [[nodiscard]] static auto
+    spur_path(Search_State const             &state,
+              Spur_Workspace                 &workspace,
+              std::size_t                     path_id,
+              std::vector<Weight_Type> const &prefix_lengths,
+              std::size_t                     spur,
+              std::vector<std::size_t> const &blocked_edges) -> std::optional<Yen_Candidate>;
+
+
+    /// It makes sure that the first K shortest paths that satisfy the given bound have been found. The search stops as
+    /// soon as a path exceeds the bound (its spur paths are not computed). The mutex of the state must be held
+    /// \param K The number of shortest paths
+    /// \param bound The upper bound on the length of the paths
+    /// \param state The state of the search
+    /// \return The number of paths (they're the first ones in state.found)
+    [[nodiscard]] auto
+    bounded_paths(std::size_t K, Length_Bound_Type const &bound, Search_State &state) const -> std::size_t;
+
+
+    /// It converts a path to the output type
+    /// \param path The path
+    /// \return The converted path
+    [[nodiscard]] static auto
+    convert(Yen_Path const &path) -> typename Output_Type::value_type;
+
+
+    /// It executes func(task) for every task in [0, num_tasks), in parallel
+    /// \param num_tasks The number of tasks
+    /// \param func The function to execute
+    template <typename Task_Function>
+    static void
+    run_tasks(std::size_t num_tasks, Task_Function const &func);
+
+  public:
+    /// Applies the Yen algorithm to find the k-shortest (loopless) paths on the given graph (from the root to the
+    /// sink). The state of the search is cached: a following call with a greater K will only compute the missing paths
+    /// \param K The number of shortest paths to find
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute(std::size_t K) const -> Output_Type override;
+
+    /// Applies the Yen algorithm to find the k-shortest (loopless) paths whose length doesn't exceed the given bound.
+    /// The state of the search is cached, as in compute
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute_bounded(std::size_t K, Length_Bound_Type const &bound) const -> Output_Type override;
+
+    /// It finds the k-shortest (loopless) paths, independently of Only_Distance, as a compact collection. Every path
+    /// only stores the edges that leave the shortest path tree, while the tree is shared with the cached state of the
+    /// search (that is kept alive by the collection)
+    /// \param K The maximum number of shortest paths to find
+    /// \param bound The upper bound on the length of the paths (by default, the length is not bounded)
+    /// \return The shortest paths
+    [[nodiscard]] auto
+    compute_path_trie(std::size_t K, Length_Bound_Type const &bound = Length_Bound_Type()) const
+      -> Path_Trie_Type override;
+
+    /// It returns an enumerator that produces the shortest (loopless) paths one at a time, in nondecreasing order of
+    /// length. The enumerator shares the cached state of the search with the KFinder
+    /// \return The enumerator
+    [[nodiscard]] auto
+    enumerate() const -> std::unique_ptr<Enumerator_Type> override;
+
+    /// It drops the cached state of the search. It must be called if the graph has been modified after the first
+    /// search. The enumerators that have been already produced are not affected
+    void
+    reset() const;
+
+    /// Constructor for the KFinder associated to the Yen algorithm
+    /// \param g The graph
+    /// \param root The root node id
+    /// \param sink The sink node id
+    explicit KFinder_Yen(GraphType const &g, Node_Id_Type root, Node_Id_Type sink)
+      : Parent_Type(g, root, sink){};
+
+    /// Constructor for the KFinder associated to the Yen algorithm
+    /// \param g The graph
+    /// \param root The root node id
+    /// \param sink The sink node id
+    explicit KFinder_Yen(t_Weighted_Graph_Complete_Type const &g, Node_Id_Type root, Node_Id_Type sink)
+      : Parent_Type(g, root, sink){};
+
+    ~KFinder_Yen() override = default;
+  };
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::Search_State::Search_State(
+    t_Weighted_Graph_Complete_Type const &graph,
+    Node_Id_Type                          root,
+    Node_Id_Type                          sink,
+    Dijkstra_Result_Type                  dij_res)
+    : root(root)
+    , sink(sink)
+    , dij_res(std::move(dij_res))
+  {
+    auto const  num_nodes                = graph.size();
+    auto const &[successors, distances] = this->dij_res;
+
+    // Store the edges (including the parallel ones) as flat arrays. O(N+E)
+    edge_offsets.reserve(num_nodes + 1);
+    edge_offsets.push_back(0);
+
+    for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+      {
+        for (auto const &head : graph.get_output_nodes(tail))
+          {
+            for (auto const &weight : graph.get_weight(std::make_pair(tail, head)))
+              edges.push_back(Out_Edge{.head = head, .weight = weight});
+          }
+
+        edge_offsets.push_back(edges.size());
+      }
+
+    // The edge of the shortest path tree is the lightest edge to the successor. O(E)
+    tree_edges.resize(num_nodes, std::numeric_limits<std::size_t>::max());
+
+    std::vector<std::size_t> children_offsets(num_nodes + 1, 0);
+    for (Node_Id_Type node_id = 0; node_id < num_nodes; ++node_id)
+      {
+        auto const &successor = successors[node_id];
+
+        if (successor == std::numeric_limits<Node_Id_Type>::max() || node_id == sink)
+          continue;
+
+        ++children_offsets[successor + 1];
+
+        auto &tree_edge = tree_edges[node_id];
+        for (auto edge = edge_offsets[node_id]; edge < edge_offsets[node_id + 1]; ++edge)
+          {
+            if (edges[edge].head == successor &&
+                (tree_edge == std::numeric_limits<std::size_t>::max() || edges[edge].weight < edges[tree_edge].weight))
+              tree_edge = edge;
+          }
+      }
+
+    // Sort the nodes of the shortest path tree, visiting it from the sink. O(N)
+    std::partial_sum(children_offsets.cbegin(), children_offsets.cend(), children_offsets.begin());
+
+    std::vector<Node_Id_Type> children(children_offsets.back());
+    {
+      std::vector<std::size_t> positions(children_offsets.cbegin(), std::prev(children_offsets.cend()));
+      for (Node_Id_Type node_id = 0; node_id < num_nodes; ++node_id)
+        {
+          if (tree_edges[node_id] != std::numeric_limits<std::size_t>::max())
+            children[positions[successors[node_id]]++] = node_id;
+        }
+    }
+
+    if (!distances.empty() && distances[sink] != std::numeric_limits<Weight_Type>::max())
+      {
+        tree_order.reserve(children.size() + 1);
+        tree_order.push_back(sink);
+
+        for (std::size_t i = 0; i < tree_order.size(); ++i)
+          {
+            auto const node = tree_order[i];
+            tree_order.insert(tree_order.end(),
+                              std::next(children.cbegin(), children_offsets[node]),
+                              std::next(children.cbegin(), children_offsets[node + 1]));
+          }
+      }
+
+    path_position.resize(num_nodes, std::numeric_limits<std::size_t>::max());
+    first_hit.resize(num_nodes, std::numeric_limits<std::size_t>::max());
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute(std::size_t K) const -> Output_Type
+  {
+    return compute_bounded(K, Length_Bound_Type());
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_bounded(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> Output_Type
+  {
+    if (graph.empty() || K == 0)
+      return {};
+
+    auto const state = search_state();
+
+    std::scoped_lock lock(state->mutex);
+    auto const num_paths = bounded_paths(K, bound, *state);
+
+    Output_Type res;
+    res.reserve(num_paths);
+
+    for (std::size_t i = 0; i < num_paths; ++i)
+      res.push_back(convert(state->found[i]));
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::bounded_paths(
+    std::size_t              K,
+    Length_Bound_Type const &bound,
+    Search_State            &state) const -> std::size_t
+  {
+    auto const limit = bound.limit(state.dij_res.second[root]);
+    auto      &found = state.found;
+
+    // Only the missing paths are computed. The paths are found in nondecreasing order of length
+    while (found.size() < K && (found.empty() || found.back().length <= limit) && next_path(state) != nullptr)
+      ;
+
+    // Some of the found paths may exceed the limit (e.g., if they were found by a previous search with a looser bound)
+    auto const end = std::next(found.cbegin(), std::min(K, found.size()));
+
+    return std::distance(found.cbegin(),
+                         std::partition_point(found.cbegin(), end, [limit](auto const &path) {
+                           return path.length <= limit;
+                         }));
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::compute_path_trie(
+    std::size_t              K,
+    Length_Bound_Type const &bound) const -> Path_Trie_Type
+  {
+    if (graph.empty() || K == 0)
+      return {};
+
+    auto const state = search_state();
+
+    std::scoped_lock lock(state->mutex);
+    auto const num_paths = bounded_paths(K, bound, *state);
+
+    // The successors are owned by the state: the aliasing constructor keeps the state alive
+    auto const &successors = state->dij_res.first;
+    Path_Trie_Type res(std::shared_ptr<std::vector<Node_Id_Type> const>(state, &successors), root, sink);
+
+    for (std::size_t i = 0; i < num_paths; ++i)
+      {
+        auto const &nodes = state->found[i].nodes;
+
+        // The paths are loopless: every edge that doesn't lead to the successor of its tail is a sidetrack
+        auto last_sidetrack = Path_Trie_Type::No_Sidetrack;
+        for (std::size_t j = 0; j + 1 < nodes.size(); ++j)
+          {
+            if (successors[nodes[j]] != nodes[j + 1])
+              last_sidetrack = res.add_sidetrack(std::make_pair(nodes[j], nodes[j + 1]), last_sidetrack);
+          }
+
+        res.add_path(state->found[i].length, last_sidetrack);
+      }
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::enumerate() const
+    -> std::unique_ptr<Enumerator_Type>
+  {
+    if (graph.empty())
+      return std::make_unique<Yen_Enumerator>(nullptr);
+
+    return std::make_unique<Yen_Enumerator>(search_state());
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  void
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::reset() const
+  {
+    std::scoped_lock lock(cache_mutex);
+    cached_state.reset();
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::search_state() const
+    -> std::shared_ptr<Search_State>
+  {
+    std::scoped_lock lock(cache_mutex);
+
+    if (!cached_state)
+      {
+        auto dij_res = Shortest_path_finder::shortest_path_tree(graph.reverse(), sink);
+        cached_state = std::make_shared<Search_State>(graph, root, sink, std::move(dij_res));
+      }
+
+    return cached_state;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::prefix_child(Search_State const &state,
+                                                                                       std::size_t         prefix,
+                                                                                       std::size_t edge) -> std::size_t
+  {
+    auto child = state.prefixes[prefix].first_child;
+
+    while (child != std::numeric_limits<std::size_t>::max() && state.prefixes[child].edge != edge)
+      child = state.prefixes[child].next_sibling;
+
+    return child;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::is_found(Search_State const &state,
+                                                                                   Yen_Path const     &path) -> bool
+  {
+    // Every found path ends with the sink (and it contains it only once): a path is found if it's a prefix of a found
+    // path
+    std::size_t prefix = 0;
+    for (auto const &edge : path.edges) // O(L*D)
+      {
+        prefix = prefix_child(state, prefix, edge);
+
+        if (prefix == std::numeric_limits<std::size_t>::max())
+          return false;
+      }
+
+    return true;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::explicit_path(
+    Search_State const  &state,
+    Yen_Candidate const &candidate) -> Yen_Path
+  {
+    auto const &successors = state.dij_res.first;
+    auto const &parent     = state.found[candidate.parent];
+
+    Yen_Path res{.length    = candidate.length,
+                 .nodes     = std::vector(parent.nodes.cbegin(), std::next(parent.nodes.cbegin(), candidate.spur + 1)),
+                 .edges     = std::vector(parent.edges.cbegin(), std::next(parent.edges.cbegin(), candidate.spur)),
+                 .deviation = candidate.spur};
+
+    // The edges of the spur search, followed by the shortest path to the sink. O(L)
+    res.edges.insert(res.edges.end(), candidate.spur_edges.cbegin(), candidate.spur_edges.cend());
+
+    for (auto node = state.edges[res.edges.back()].head; node != state.sink; node = successors[node])
+      res.edges.push_back(state.tree_edges[node]);
+
+    for (auto edge_it = std::next(res.edges.cbegin(), candidate.spur); edge_it != res.edges.cend(); ++edge_it)
+      res.nodes.push_back(state.edges[*edge_it].head);
+
+    return res;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::add_found(Search_State &state,
+                                                                                    Yen_Path      path)
+    -> Yen_Path const *
+  {
+    auto &prefixes = state.prefixes;
+
+    std::size_t prefix = 0;
+    for (auto const &edge : path.edges) // O(L*D), D being the maximum out degree
+      {
+        auto child = prefix_child(state, prefix, edge);
+
+        if (child == std::numeric_limits<std::size_t>::max())
+          {
+            child = prefixes.size();
+            prefixes.push_back(Prefix_Node{.edge         = edge,
+                                           .first_child  = std::numeric_limits<std::size_t>::max(),
+                                           .next_sibling = prefixes[prefix].first_child});
+
+            prefixes[prefix].first_child = child;
+          }
+
+        prefix = child;
+      }
+
+    return &state.found.emplace_back(std::move(path));
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::next_path(Search_State &state)
+    -> Yen_Path const *
+  {
+    auto const &[successors, distances] = state.dij_res;
+
+    // Start with the shortest path
+    if (state.found.empty())
+      {
+        if (distances.empty() || distances[state.root] == std::numeric_limits<Weight_Type>::max())
+          return nullptr;
+
+        Yen_Path path{.length = 0, .nodes = {state.root}, .edges = {}, .deviation = 0};
+        for (auto node = state.root; node != state.sink; node = successors[node])
+          {
+            auto const &edge = state.tree_edges[node];
+
+            path.length += state.edges[edge].weight;
+            path.nodes.push_back(state.edges[edge].head);
+            path.edges.push_back(edge);
+          }
+
+        return add_found(state, std::move(path));
+      }
+
+    // The spur paths of the last path are computed only when the next path is required
+    while (state.expanded < state.found.size())
+      add_spur_paths(state, state.expanded++);
+
+    while (!state.candidates.empty())
+      {
+        auto path = explicit_path(state, state.candidates.top());
+        state.candidates.pop();
+
+        if (!is_found(state, path))
+          return add_found(state, std::move(path));
+      }
+
+    return nullptr;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  void
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::add_spur_paths(Search_State &state,
+                                                                                         std::size_t   path_id)
+  {
+    auto const &successors = state.dij_res.first;
+    auto const &path       = state.found[path_id];
+    auto const  num_spurs  = path.edges.size() - path.deviation;
+
+    if (num_spurs == 0)
+      return;
+
+    // Mark the nodes of the path
+    std::vector<Weight_Type> prefix_lengths{0};
+    prefix_lengths.reserve(path.nodes.size());
+
+    for (std::size_t i = 0; i < path.nodes.size(); ++i) // O(L)
+      {
+        state.path_position[path.nodes[i]] = i;
+
+        if (i < path.edges.size())
+          prefix_lengths.push_back(prefix_lengths.back() + state.edges[path.edges[i]].weight);
+      }
+
+    // Classify the nodes: the shortest path from a node to the sink is valid for the spur node i if it doesn't contain
+    // the first i + 1 nodes of the path. O(N)
+    for (auto const &node : state.tree_order)
+      {
+        state.first_hit[node] = node == state.sink ?
+                                  state.path_position[node] :
+                                  std::min(state.path_position[node], state.first_hit[successors[node]]);
+      }
+
+    // The blocked edges of a spur node are the ones following the prefix in the found paths. O(L*D)
+    std::vector<std::vector<std::size_t>> blocked_edges(num_spurs);
+
+    std::size_t prefix = 0;
+    for (std::size_t i = 0; i < path.edges.size(); ++i)
+      {
+        if (i >= path.deviation)
+          {
+            auto &blocked = blocked_edges[i - path.deviation];
+
+            for (auto child = state.prefixes[prefix].first_child; child != std::numeric_limits<std::size_t>::max();
+                 child      = state.prefixes[child].next_sibling)
+              blocked.push_back(state.prefixes[child].edge);
+
+            std::sort(blocked.begin(), blocked.end());
+          }
+
+        prefix = prefix_child(state, prefix, path.edges[i]);
+      }
+
+    // A few tasks per thread, each one with its own workspace
+    auto const num_threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    auto const num_tasks =
+      std::clamp<std::size_t>((num_spurs + Min_Spurs_Per_Task - 1) / Min_Spurs_Per_Task, 1, 4 * num_threads);
+
+    while (state.workspaces.size() < num_tasks)
+      state.workspaces.emplace_back();
+
+    std::vector<std::optional<Yen_Candidate>> spur_paths(num_spurs);
+
+    // The spur searches are independent. The spur nodes are assigned to the tasks in a round-robin fashion, since the
+    // searches from the nodes closer to the sink are usually faster
+    run_tasks(num_tasks, [&](std::size_t task) {
+      auto &workspace = state.workspaces[task];
+
+      for (auto i = task; i < num_spurs; i += num_tasks)
+        spur_paths[i] = spur_path(state, workspace, path_id, prefix_lengths, path.deviation + i, blocked_edges[i]);
+    });
+
+    for (auto &spur_path : spur_paths)
+      {
+        if (spur_path)
+          state.candidates.push(std::move(spur_path.value()));
+      }
+
+    for (auto const &node : path.nodes)
+      state.path_position[node] = std::numeric_limits<std::size_t>::max();
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::spur_path(
+    Search_State const             &state,
+    Spur_Workspace                 &workspace,
+    std::size_t                     path_id,
+    std::vector<Weight_Type> const &prefix_lengths,
+    std::size_t                     spur,
+    std::vector<std::size_t> const &blocked_edges) -> std::optional<Yen_Candidate>
+  {
+    auto const &[successors, distances] = state.dij_res;
+    auto const &path                    = state.found[path_id];
+
+    auto const num_nodes = successors.size();
+    if (workspace.reached.size() != num_nodes)
+      {
+        workspace.reached.assign(num_nodes, 0);
+        workspace.closed.assign(num_nodes, 0);
+        workspace.distance.resize(num_nodes);
+        workspace.predecessor_edge.resize(num_nodes);
+        workspace.predecessor.resize(num_nodes);
+      }
+
+    auto const search    = ++workspace.search;
+    auto const spur_node = path.nodes[spur];
+
+    auto &queue = workspace.queue;
+    queue.clear();
+
+    workspace.reached[spur_node]  = search;
+    workspace.distance[spur_node] = 0;
+    queue.emplace_back(distances[spur_node], spur_node);
+
+    // The distances from the sink are a lower bound of the distances in the graph without the removed nodes and
+    // edges: the nodes are extracted by increasing (lower bound of the) length of the spur path
+    while (!queue.empty())
+      {
+        std::pop_heap(queue.begin(), queue.end(), std::greater<>());
+        auto const tail = queue.back().second;
+        queue.pop_back();
+
+        if (workspace.closed[tail] == search)
+          continue;
+
+        workspace.closed[tail] = search;
+
+        // The shortest path from tail to the sink is valid: it completes the spur path
+        if (state.first_hit[tail] > spur)
+          {
+            Yen_Candidate res{.length     = prefix_lengths[spur] + workspace.distance[tail] + distances[tail],
+                              .parent     = path_id,
+                              .spur       = spur,
+                              .spur_edges = {}};
+
+            for (auto node = tail; node != spur_node; node = workspace.predecessor[node])
+              res.spur_edges.push_back(workspace.predecessor_edge[node]);
+
+            std::reverse(res.spur_edges.begin(), res.spur_edges.end());
+
+            return res;
+          }
+
+        for (auto edge = state.edge_offsets[tail]; edge < state.edge_offsets[tail + 1]; ++edge)
+          {
+            auto const &[head, weight] = state.edges[edge];
+
+            // The previous nodes of the path (and the spur node itself) are removed, as the nodes that cannot reach
+            // the sink
+            if (state.path_position[head] <= spur || distances[head] == std::numeric_limits<Weight_Type>::max())
+              continue;
+
+            if (tail == spur_node && std::binary_search(blocked_edges.cbegin(), blocked_edges.cend(), edge))
+              continue;
+
+            auto const candidate_distance = workspace.distance[tail] + weight;
+            if (workspace.reached[head] != search || candidate_distance < workspace.distance[head])
+              {
+                workspace.reached[head]          = search;
+                workspace.distance[head]         = candidate_distance;
+                workspace.predecessor_edge[head] = edge;
+                workspace.predecessor[head]      = tail;
+
+                queue.emplace_back(candidate_distance + distances[head], head);
+                std::push_heap(queue.begin(), queue.end(), std::greater<>());
+              }
+          }
+      }
+
+    return std::nullopt;
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  auto
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::convert(Yen_Path const &path)
+    -> typename Output_Type::value_type
+  {
+    if constexpr (Only_Distance)
+      {
+        return path.length;
+      }
+    else
+      {
+        Path_Info info;
+        info.length = path.length;
+        info.path   = path.nodes;
+
+        return info;
+      }
+  }
+
+
+  template <typename Graph_type, bool Only_Distance, Valid_Weighted_Graph t_Weighted_Graph_Complete_Type>
+  template <typename Task_Function>
+  void
+  KFinder_Yen<Graph_type, Only_Distance, t_Weighted_Graph_Complete_Type>::run_tasks(std::size_t          num_tasks,
+                                                                                    Task_Function const &func)
+  {
+    if (num_tasks == 1)
+      {
+        func(0);
+        return;
+      }
+
+#if NETWORK_BUTCHER_PARALLEL_TBB
+    std::vector<std::size_t> v(num_tasks);
+    std::generate(v.begin(), v.end(), [n = 0]() mutable { return n++; });
+
+    std::for_each(std::execution::par, v.cbegin(), v.cend(), func);
+#else
+#  pragma omp parallel default(none) shared(num_tasks, func)
+    {
+#  pragma omp for schedule(dynamic)
+      for (std::size_t i = 0; i < num_tasks; ++i)
+        {
+          func(i);
+        }
+    }
+#endif
+  }
+} // namespace network_butcher::kfinder
+
+#endif // NETWORK_BUTCHER_KYEN_H
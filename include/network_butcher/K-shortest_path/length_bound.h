@@ -0,0 +1,57 @@
+#ifndef NETWORK_BUTCHER_LENGTH_BOUND_H
+#define NETWORK_BUTCHER_LENGTH_BOUND_H
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+#include <network_butcher/Traits/traits.h>
+
+namespace network_butcher::kfinder
+{
+  /// Simple struct to represent an upper bound on the length of the paths returned by a K shortest path algorithm. The
+  /// bound can be either absolute or relative to the length of the shortest path (or both: the tightest one is used)
+  /// \tparam Weight_Type The type of the weight
+  template <typename Weight_Type = Time_Type>
+  struct Templated_Length_Bound
+  {
+    /// The maximum length of a path. If it's not set, the length is not bounded
+    std::optional<Weight_Type> max_length;
+
+    /// The maximum relative gap between the length of a path and the length of the shortest path, e.g., 0.05 accepts
+    /// only the paths within 5% of the shortest one. If it's not set, the gap is not bounded
+    std::optional<double> max_relative_gap;
+
+    /// It checks if the bound is set
+    /// \return True if either the absolute or the relative bound is set
+    [[nodiscard]] auto
+    bounded() const -> bool
+    {
+      return max_length.has_value() || max_relative_gap.has_value();
+    }
+
+    /// It computes the maximum length of a path, given the length of the shortest path
+    /// \param shortest_length The length of the shortest path
+    /// \return The maximum length of a path (the maximum value of Weight_Type if the length is not bounded)
+    [[nodiscard]] auto
+    limit(Weight_Type shortest_length) const -> Weight_Type
+    {
+      auto res = std::numeric_limits<Weight_Type>::max();
+
+      if (max_length)
+        res = std::min(res, *max_length);
+
+      if (max_relative_gap)
+        {
+          auto const relative = (1 + static_cast<long double>(*max_relative_gap)) * shortest_length;
+
+          if (relative < static_cast<long double>(res))
+            res = static_cast<Weight_Type>(relative);
+        }
+
+      return res;
+    }
+  };
+} // namespace network_butcher::kfinder
+
+#endif // NETWORK_BUTCHER_LENGTH_BOUND_H
@@ -0,0 +1,252 @@
+#ifndef NETWORK_BUTCHER_MIN_MAX_HEAP_H
+#define NETWORK_BUTCHER_MIN_MAX_HEAP_H
+
+#include <bit>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace network_butcher::kfinder
+{
+  /// A double-ended priority queue, implemented as the min-max heap of Atkinson et al. It's a complete binary tree
+  /// stored in a vector: the elements on the even levels (the root is at level 0) are not greater than their
+  /// descendants, while the elements on the odd levels are not smaller than their descendants. Thus, both the smallest
+  /// and the largest elements can be accessed in O(1) and removed in O(log(n))
+  /// \tparam T The type of the elements
+  /// \tparam Compare The type of the comparison function (less than)
+  template <typename T, typename Compare = std::less<>>
+  class Min_Max_Heap
+  {
+  private:
+    /// The elements, stored level by level
+    std::vector<T> data;
+
+    /// The comparison function
+    Compare compare;
+
+    /// It checks if the given position is on a min level
+    /// \param position The position
+    /// \return True if the position is on a min level
+    [[nodiscard]] static auto
+    min_level(std::size_t position) -> bool
+    {
+      return (std::bit_width(position + 1) & 1) == 1;
+    }
+
+    /// It checks if the element in the first position should be closer to the root than the element in the second
+    /// position, assuming that they're both on a min level (or both on a max level)
+    /// \tparam Max_Level True if the positions are on a max level
+    /// \param lhs The first position
+    /// \param rhs The second position
+    /// \return True if the first element precedes the second one
+    template <bool Max_Level>
+    [[nodiscard]] auto
+    precedes(std::size_t lhs, std::size_t rhs) const -> bool
+    {
+      if constexpr (Max_Level)
+        return compare(data[rhs], data[lhs]);
+      else
+        return compare(data[lhs], data[rhs]);
+    }
+
+    /// It moves the element in the given position towards the root, visiting only the levels of the same kind (min or
+    /// max) of the starting one
+    /// \tparam Max_Level True if the position is on a max level
+    /// \param position The position
+    template <bool Max_Level>
+    void
+    bubble_up_grandparents(std::size_t position)
+    {
+      // Only the elements from level 2 have a grandparent
+      while (position > 2)
+        {
+          auto const grandparent = ((position - 1) / 2 - 1) / 2;
+
+          if (!precedes<Max_Level>(position, grandparent))
+            break;
+
+          std::swap(data[position], data[grandparent]);
+          position = grandparent;
+        }
+    }
+
+    /// It moves the last inserted element towards the root. O(log(n))
+    /// \param position The position of the element
+    void
+    bubble_up(std::size_t position)
+    {
+      if (position == 0)
+        return;
+
+      auto const parent = (position - 1) / 2;
+
+      if (min_level(position))
+        {
+          // The parent is on a max level: if the element is greater, it belongs to the max levels
+          if (compare(data[parent], data[position]))
+            {
+              std::swap(data[position], data[parent]);
+              bubble_up_grandparents<true>(parent);
+            }
+          else
+            {
+              bubble_up_grandparents<false>(position);
+            }
+        }
+      else
+        {
+          // The parent is on a min level: if the element is smaller, it belongs to the min levels
+          if (compare(data[position], data[parent]))
+            {
+              std::swap(data[position], data[parent]);
+              bubble_up_grandparents<false>(parent);
+            }
+          else
+            {
+              bubble_up_grandparents<true>(position);
+            }
+        }
+    }
+
+    /// It moves the element in the given position towards the leaves, visiting only the levels of the same kind (min
+    /// or max) of the starting one. O(log(n))
+    /// \tparam Max_Level True if the position is on a max level
+    /// \param position The position
+    template <bool Max_Level>
+    void
+    trickle_down(std::size_t position)
+    {
+      while (2 * position + 1 < data.size())
+        {
+          // The best element among the children and the grandchildren
+          auto const first_child = 2 * position + 1;
+          auto       best        = first_child;
+
+          for (auto const candidate : {first_child + 1,
+                                       2 * first_child + 1,
+                                       2 * first_child + 2,
+                                       2 * first_child + 3,
+                                       2 * first_child + 4})
+            if (candidate < data.size() && precedes<Max_Level>(candidate, best))
+              best = candidate;
+
+          if (!precedes<Max_Level>(best, position))
+            return;
+
+          std::swap(data[best], data[position]);
+
+          // A child is on a level of the other kind: it doesn't have to be moved further
+          if (best <= first_child + 1)
+            return;
+
+          // The element moved to the grandchild may have to be swapped with its parent (on a level of the other kind)
+          auto const parent = (best - 1) / 2;
+          if (precedes<Max_Level>(parent, best))
+            std::swap(data[best], data[parent]);
+
+          position = best;
+        }
+    }
+
+    /// It removes the element in the given position, replacing it with the last element
+    /// \param position The position
+    void
+    erase(std::size_t position)
+    {
+      std::swap(data[position], data.back());
+      data.pop_back();
+
+      if (position >= data.size())
+        return;
+
+      if (min_level(position))
+        trickle_down<false>(position);
+      else
+        trickle_down<true>(position);
+    }
+
+    /// It returns the position of the largest element. The heap must not be empty
+    /// \return The position of the largest element
+    [[nodiscard]] auto
+    max_position() const -> std::size_t
+    {
+      if (data.size() == 1)
+        return 0;
+      if (data.size() == 2 || !compare(data[1], data[2]))
+        return 1;
+      return 2;
+    }
+
+  public:
+    /// It constructs an empty heap
+    /// \param compare The comparison function
+    explicit Min_Max_Heap(Compare compare = Compare())
+      : compare(std::move(compare))
+    {}
+
+    /// It checks if the heap is empty
+    /// \return True if the heap is empty
+    [[nodiscard]] auto
+    empty() const -> bool
+    {
+      return data.empty();
+    }
+
+    /// It returns the number of elements
+    /// \return The number of elements
+    [[nodiscard]] auto
+    size() const -> std::size_t
+    {
+      return data.size();
+    }
+
+    /// It reserves the memory for the given number of elements
+    /// \param capacity The number of elements
+    void
+    reserve(std::size_t capacity)
+    {
+      data.reserve(capacity);
+    }
+
+    /// It inserts a new element. O(log(n))
+    /// \param element The element
+    void
+    push(T element)
+    {
+      data.push_back(std::move(element));
+      bubble_up(data.size() - 1);
+    }
+
+    /// It returns the smallest element. The heap must not be empty. O(1)
+    /// \return The smallest element
+    [[nodiscard]] auto
+    min() const -> T const &
+    {
+      return data.front();
+    }
+
+    /// It returns the largest element. The heap must not be empty. O(1)
+    /// \return The largest element
+    [[nodiscard]] auto
+    max() const -> T const &
+    {
+      return data[max_position()];
+    }
+
+    /// It removes the smallest element. The heap must not be empty. O(log(n))
+    void
+    pop_min()
+    {
+      erase(0);
+    }
+
+    /// It removes the largest element. The heap must not be empty. O(log(n))
+    void
+    pop_max()
+    {
+      erase(max_position());
+    }
+  };
+} // namespace network_butcher::kfinder
+
+#endif // NETWORK_BUTCHER_MIN_MAX_HEAP_H
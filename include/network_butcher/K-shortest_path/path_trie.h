@@ -0,0 +1,198 @@
+#ifndef NETWORK_BUTCHER_PATH_TRIE_H
+#define NETWORK_BUTCHER_PATH_TRIE_H
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <network_butcher/K-shortest_path/path_info.h>
+#include <network_butcher/Traits/traits.h>
+
+namespace network_butcher::kfinder
+{
+  /// A compact collection of paths (from the same root to the same sink). Every path is represented by the sequence
+  /// of its sidetrack edges, i.e., the edges that are not part of a shortest path tree towards the sink: the path
+  /// starts from the root and it follows the tree, taking the next sidetrack edge as soon as its tail is reached. The
+  /// tree is shared among all the paths (and with the K shortest path algorithm that produced them), while the
+  /// sidetrack sequences are stored in a prefix tree (every sidetrack points to the previous one). The explicit paths
+  /// are constructed only on request
+  /// \tparam Weight_Type The type of the weight
+  template <typename Weight_Type = Time_Type>
+  class Templated_Path_Trie
+  {
+  public:
+    /// The position used for the paths without sidetracks (and for the first sidetrack of a path)
+    static constexpr std::size_t No_Sidetrack = std::numeric_limits<std::size_t>::max();
+
+    /// A sidetrack edge of the prefix tree
+    struct Sidetrack_Node
+    {
+      /// The sidetrack edge
+      Edge_Type edge;
+
+      /// The position of the previous sidetrack edge (or No_Sidetrack, if it's the first one)
+      std::size_t parent;
+    };
+
+    /// A path, stored implicitly
+    struct Path_Entry
+    {
+      /// The length of the path
+      Weight_Type length;
+
+      /// The position of the last sidetrack edge of the path (or No_Sidetrack, if the path has no sidetracks)
+      std::size_t last_sidetrack;
+    };
+
+  private:
+    /// The successor of every node in the shortest path tree (towards the sink)
+    std::shared_ptr<std::vector<Node_Id_Type> const> successors;
+
+    /// The root node id
+    Node_Id_Type root = 0;
+
+    /// The sink node id
+    Node_Id_Type sink = 0;
+
+    /// The prefix tree of the sidetrack edges
+    std::vector<Sidetrack_Node> sidetracks;
+
+    /// The paths
+    std::vector<Path_Entry> paths;
+
+  public:
+    /// It constructs an empty collection of paths
+    Templated_Path_Trie() = default;
+
+    /// It constructs an empty collection of paths, given the shortest path tree they will refer to
+    /// \param successors The successor of every node in the shortest path tree (towards the sink)
+    /// \param root The root node id
+    /// \param sink The sink node id
+    Templated_Path_Trie(std::shared_ptr<std::vector<Node_Id_Type> const> successors,
+                        Node_Id_Type                                     root,
+                        Node_Id_Type                                     sink)
+      : successors(std::move(successors))
+      , root(root)
+      , sink(sink)
+    {}
+
+    /// It adds a sidetrack edge to the prefix tree
+    /// \param edge The sidetrack edge
+    /// \param parent The position of the previous sidetrack edge (or No_Sidetrack)
+    /// \return The position of the new sidetrack edge
+    auto
+    add_sidetrack(Edge_Type const &edge, std::size_t parent) -> std::size_t
+    {
+      sidetracks.push_back(Sidetrack_Node{.edge = edge, .parent = parent});
+      return sidetracks.size() - 1;
+    }
+
+    /// It adds a path
+    /// \param length The length of the path
+    /// \param last_sidetrack The position of the last sidetrack edge of the path (or No_Sidetrack)
+    void
+    add_path(Weight_Type length, std::size_t last_sidetrack)
+    {
+      paths.push_back(Path_Entry{.length = length, .last_sidetrack = last_sidetrack});
+    }
+
+    /// It returns the number of paths
+    /// \return The number of paths
+    [[nodiscard]] auto
+    size() const -> std::size_t
+    {
+      return paths.size();
+    }
+
+    /// It checks if there are no paths
+    /// \return True if there are no paths
+    [[nodiscard]] auto
+    empty() const -> bool
+    {
+      return paths.empty();
+    }
+
+    /// It returns the number of sidetrack edges stored in the prefix tree
+    /// \return The number of sidetrack edges
+    [[nodiscard]] auto
+    num_sidetracks() const -> std::size_t
+    {
+      return sidetracks.size();
+    }
+
+    /// It returns the length of the given path
+    /// \param path_id The position of the path
+    /// \return The length of the path
+    [[nodiscard]] auto
+    length(std::size_t path_id) const -> Weight_Type
+    {
+      return paths[path_id].length;
+    }
+
+    /// It calls the given function for every node of the given path, in order (from the root to the sink). Only the
+    /// sidetrack edges of the path are stored in a temporary buffer
+    /// \tparam Visit_Function The type of the function
+    /// \param path_id The position of the path
+    /// \param visit The function called for every node
+    template <typename Visit_Function>
+    void
+    for_each_node(std::size_t path_id, Visit_Function &&visit) const
+    {
+      std::vector<Edge_Type> path_sidetracks;
+      for (auto position = paths[path_id].last_sidetrack; position != No_Sidetrack;
+           position      = sidetracks[position].parent)
+        path_sidetracks.push_back(sidetracks[position].edge);
+
+      // The sidetracks were collected backwards
+      auto next_sidetrack = path_sidetracks.crbegin();
+      auto node           = root;
+
+      while (node != sink)
+        {
+          visit(node);
+
+          if (next_sidetrack != path_sidetracks.crend() && next_sidetrack->first == node)
+            {
+              node = next_sidetrack->second;
+              ++next_sidetrack;
+            }
+          else
+            {
+              node = (*successors)[node];
+            }
+        }
+
+      visit(sink);
+    }
+
+    /// It constructs the explicit version of the given path
+    /// \param path_id The position of the path
+    /// \return The explicit path
+    [[nodiscard]] auto
+    explicit_path(std::size_t path_id) const -> Templated_Path_Info<Weight_Type>
+    {
+      Templated_Path_Info<Weight_Type> res;
+      res.length = length(path_id);
+
+      for_each_node(path_id, [&res](Node_Id_Type node) { res.path.push_back(node); });
+
+      return res;
+    }
+
+    /// It constructs the explicit version of all the paths
+    /// \return The explicit paths
+    [[nodiscard]] auto
+    explicit_paths() const -> std::vector<Templated_Path_Info<Weight_Type>>
+    {
+      std::vector<Templated_Path_Info<Weight_Type>> res;
+      res.reserve(size());
+
+      for (std::size_t path_id = 0; path_id < size(); ++path_id)
+        res.push_back(explicit_path(path_id));
+
+      return res;
+    }
+  };
+} // namespace network_butcher::kfinder
+
+#endif // NETWORK_BUTCHER_PATH_TRIE_H
@@ -0,0 +1,393 @@
+#ifndef NETWORK_BUTCHER_SCENARIO_WEIGHTED_GRAPH_H
+#define NETWORK_BUTCHER_SCENARIO_WEIGHTED_GRAPH_H
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include <network_butcher/K-shortest_path/weighted_graph.h>
+#include <network_butcher/Traits/traits.h>
+#include <network_butcher/utilities.h>
+
+namespace network_butcher::kfinder
+{
+  /// The weights of a collection of scenarios (e.g., different bandwidths) on the same topology, stored as a
+  /// structure of arrays: the topology is stored once, in the CSR format (both the forward and the reverse adjacency),
+  /// while every scenario only stores a contiguous array with the weight of every edge. Parallel edges are not
+  /// supported
+  /// \tparam t_Source_Weighted_Graph The (non-reversed) Weighted_Graph used to build the topology
+  template <Valid_Weighted_Graph t_Source_Weighted_Graph>
+  class Scenario_Weights
+  {
+  public:
+    /// Alias for the weight type
+    using Weight_Type = typename t_Source_Weighted_Graph::Weight_Type;
+
+    /// Alias for the edge type
+    using Edge_Type = std::pair<Node_Id_Type, Node_Id_Type>;
+
+  private:
+    /// The source graph. Used only to access the nodes
+    t_Source_Weighted_Graph source;
+
+    /// The offsets of the output neighbours of every node (size N+1)
+    std::vector<std::size_t> node_offsets;
+
+    /// The (concatenated) output neighbours of every node, in ascending order. The position of an edge in this array
+    /// is its id
+    std::vector<Node_Id_Type> heads;
+
+    /// The offsets of the input neighbours of every node (size N+1)
+    std::vector<std::size_t> reverse_node_offsets;
+
+    /// The (concatenated) input neighbours of every node, in ascending order
+    std::vector<Node_Id_Type> tails;
+
+    /// The id of the edge associated to every entry of tails
+    std::vector<std::size_t> reverse_edge_ids;
+
+    /// The weights of the edges, one array per scenario (indexed by the edge id)
+    std::vector<std::vector<Weight_Type>> weights;
+
+  public:
+    /// It builds the topology from the given Weighted_Graph. O(N+E)
+    /// \param g The Weighted_Graph
+    explicit Scenario_Weights(t_Source_Weighted_Graph const &g)
+      : source(g)
+    {
+      auto const num_nodes = g.size();
+
+      node_offsets.reserve(num_nodes + 1);
+      node_offsets.push_back(0);
+
+      std::vector<std::size_t> in_degree(num_nodes + 1, 0);
+      for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+        {
+          for (auto const &head : g.get_output_nodes(tail))
+            {
+              heads.push_back(head);
+              ++in_degree[head + 1];
+            }
+
+          node_offsets.push_back(heads.size());
+        }
+
+      // The reverse adjacency is filled visiting the tails in ascending order, thus every list is sorted. O(N+E)
+      reverse_node_offsets.resize(num_nodes + 1, 0);
+      for (Node_Id_Type node = 0; node < num_nodes; ++node)
+        reverse_node_offsets[node + 1] = reverse_node_offsets[node] + in_degree[node + 1];
+
+      tails.resize(heads.size());
+      reverse_edge_ids.resize(heads.size());
+
+      auto positions = reverse_node_offsets;
+      for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+        {
+          for (auto edge_id = node_offsets[tail]; edge_id < node_offsets[tail + 1]; ++edge_id)
+            {
+              auto &position = positions[heads[edge_id]];
+
+              tails[position]            = tail;
+              reverse_edge_ids[position] = edge_id;
+              ++position;
+            }
+        }
+    }
+
+    /// It returns the source graph
+    /// \return The source graph
+    [[nodiscard]] auto
+    get_source() const -> t_Source_Weighted_Graph const &
+    {
+      return source;
+    }
+
+    /// It returns the number of nodes
+    /// \return The number of nodes
+    [[nodiscard]] auto
+    size() const -> std::size_t
+    {
+      return node_offsets.size() - 1;
+    }
+
+    /// It returns the number of edges
+    /// \return The number of edges
+    [[nodiscard]] auto
+    num_edges() const -> std::size_t
+    {
+      return heads.size();
+    }
+
+    /// It returns the number of scenarios
+    /// \return The number of scenarios
+    [[nodiscard]] auto
+    num_scenarios() const -> std::size_t
+    {
+      return weights.size();
+    }
+
+    /// It sets the number of scenarios. The weights of the new scenarios are null
+    /// \param num_scenarios The number of scenarios
+    void
+    resize(std::size_t num_scenarios)
+    {
+      weights.resize(num_scenarios, std::vector<Weight_Type>(num_edges(), Weight_Type{0}));
+    }
+
+    /// It sets the weights of a scenario, evaluating the given function on every edge. Different scenarios can be set
+    /// concurrently. O(E)
+    /// \tparam Weight_Function The type of the function. It's called as weight_function(edge)
+    /// \param scenario The scenario
+    /// \param weight_function The function returning the weight of an edge
+    template <typename Weight_Function>
+    void
+    set_weights(std::size_t scenario, Weight_Function const &weight_function)
+    {
+      auto &scenario_weights = weights[scenario];
+
+      for (Node_Id_Type tail = 0; tail < size(); ++tail)
+        for (auto edge_id = node_offsets[tail]; edge_id < node_offsets[tail + 1]; ++edge_id)
+          scenario_weights[edge_id] = weight_function(std::make_pair(tail, heads[edge_id]));
+    }
+
+    /// It returns the weights of a scenario, indexed by the edge id
+    /// \param scenario The scenario
+    /// \return The weights
+    [[nodiscard]] auto
+    get_weights(std::size_t scenario) const -> std::vector<Weight_Type> const &
+    {
+      return weights[scenario];
+    }
+
+    /// It returns the neighbours of a node
+    /// \tparam Reversed If true, the input neighbours are returned. Otherwise, the output ones
+    /// \param id The id of the node
+    /// \return The contiguous range of neighbours (in ascending order)
+    template <bool Reversed>
+    [[nodiscard]] auto
+    get_neighbours(Node_Id_Type id) const -> std::span<Node_Id_Type const>
+    {
+      if constexpr (Reversed)
+        {
+          return {tails.data() + reverse_node_offsets[id], reverse_node_offsets[id + 1] - reverse_node_offsets[id]};
+        }
+      else
+        {
+          return {heads.data() + node_offsets[id], node_offsets[id + 1] - node_offsets[id]};
+        }
+    }
+
+    /// It returns the id of an edge. It throws if the edge doesn't exist. O(log(deg))
+    /// \tparam Reversed If true, the edge is an edge of the reversed graph
+    /// \param edge The edge
+    /// \return The id of the edge
+    template <bool Reversed>
+    [[nodiscard]] auto
+    find_edge(Edge_Type const &edge) const -> std::size_t
+    {
+      auto const neighbours = get_neighbours<Reversed>(edge.first);
+      auto const it         = std::lower_bound(neighbours.begin(), neighbours.end(), edge.second);
+
+      if (it == neighbours.end() || *it != edge.second)
+        {
+          throw std::runtime_error("Scenario_Weights::find_edge : the edge " + Utilities::custom_to_string(edge) +
+                                   " does not exist");
+        }
+
+      if constexpr (Reversed)
+        {
+          return reverse_edge_ids[reverse_node_offsets[edge.first] + (it - neighbours.begin())];
+        }
+      else
+        {
+          return node_offsets[edge.first] + (it - neighbours.begin());
+        }
+    }
+  };
+
+
+  /// A single scenario of a Scenario_Weights. It's the graph type used to select the Weighted_Graph specialization:
+  /// it only refers to the Scenario_Weights, thus it must not outlive it
+  /// \tparam t_Source_Weighted_Graph The (non-reversed) Weighted_Graph used to build the topology
+  template <Valid_Weighted_Graph t_Source_Weighted_Graph>
+  struct Scenario_Graph
+  {
+    /// Alias for the Weighted_Graph used to build the topology
+    using Source_Weighted_Graph_Type = t_Source_Weighted_Graph;
+
+    /// Alias for the node type
+    using Node_Type = typename t_Source_Weighted_Graph::Node_Type;
+
+    /// Alias for the node collection type
+    using Node_Collection_Type = typename t_Source_Weighted_Graph::Node_Collection_Type;
+
+    /// Alias for the weight type
+    using Weight_Type = typename t_Source_Weighted_Graph::Weight_Type;
+
+    /// The weights of all the scenarios
+    Scenario_Weights<t_Source_Weighted_Graph> const *scenarios;
+
+    /// The selected scenario
+    std::size_t scenario;
+  };
+
+
+  /// A scenario preserves the node ids of the source graph
+  /// \tparam t_Source_Weighted_Graph The (non-reversed) Weighted_Graph used to build the topology
+  template <Valid_Weighted_Graph t_Source_Weighted_Graph>
+  struct Topologically_Sorted_Graph<Scenario_Graph<t_Source_Weighted_Graph>>
+    : Topologically_Sorted_Graph<typename t_Source_Weighted_Graph::Graph_Type>
+  {};
+
+
+  /// Specialization of Weighted_Graph for a single scenario of a Scenario_Weights. The topology and the weights are
+  /// shared with the other scenarios: constructing (and reversing) the graph is O(1)
+  /// \tparam t_Source_Weighted_Graph The (non-reversed) Weighted_Graph used to build the topology
+  /// \tparam t_Reversed If the resulting graph is reversed
+  template <Valid_Weighted_Graph t_Source_Weighted_Graph, bool t_Reversed>
+  class Weighted_Graph<Scenario_Graph<t_Source_Weighted_Graph>,
+                       t_Reversed,
+                       typename t_Source_Weighted_Graph::Node_Type,
+                       typename t_Source_Weighted_Graph::Node_Collection_Type,
+                       typename t_Source_Weighted_Graph::Weight_Type> : Base_Weighted_Graph
+  {
+  public:
+    /// Alias for the weight type
+    using Weight_Type = typename t_Source_Weighted_Graph::Weight_Type;
+
+    /// Alias for the edge type
+    using Edge_Type = std::pair<Node_Id_Type, Node_Id_Type>;
+
+    /// Alias for the graph type
+    using Graph_Type = Scenario_Graph<t_Source_Weighted_Graph>;
+
+    /// Alias for the weights of a pair of nodes (a single weight)
+    using Weight_Edge_Type = std::span<Weight_Type const>;
+
+    /// Alias for the node type
+    using Node_Type = typename t_Source_Weighted_Graph::Node_Type;
+
+    /// Alias for the node collection type
+    using Node_Collection_Type = typename t_Source_Weighted_Graph::Node_Collection_Type;
+
+  private:
+    /// Alias for the reversed graph type
+    using Reversed_Type = Weighted_Graph<Graph_Type, !t_Reversed, Node_Type, Node_Collection_Type, Weight_Type>;
+
+    /// The scenario
+    Graph_Type graph;
+
+  public:
+    /// It returns the weight of the edge
+    /// \param edge The edge
+    /// \return The weight of the edge
+    [[nodiscard]] auto
+    get_weight(Edge_Type const &edge) const -> Weight_Edge_Type
+    {
+      auto const &weights = graph.scenarios->get_weights(graph.scenario);
+      return Weight_Edge_Type(weights.data() + graph.scenarios->template find_edge<t_Reversed>(edge), 1);
+    }
+
+    /// It returns the weight of the edge
+    /// \param edge The edge
+    /// \return The weight of the edge
+    [[nodiscard]] auto
+    min_weight(Edge_Type const &edge) const -> Weight_Type
+    {
+      return graph.scenarios->get_weights(graph.scenario)[graph.scenarios->template find_edge<t_Reversed>(edge)];
+    }
+
+    /// It returns the number of nodes
+    /// \return The number of nodes
+    [[nodiscard]] auto
+    size() const -> std::size_t
+    {
+      return graph.scenarios->size();
+    }
+
+    /// It returns whether the graph is empty
+    /// \return Whether the graph is empty
+    [[nodiscard]] auto
+    empty() const -> bool
+    {
+      return size() == 0;
+    }
+
+    /// It returns the out neighbours of the node with the given id (in ascending order)
+    /// \param id The id of the node
+    /// \return The contiguous range of neighbours
+    [[nodiscard]] auto
+    get_output_nodes(Node_Id_Type const &id) const -> std::span<Node_Id_Type const>
+    {
+      return graph.scenarios->template get_neighbours<t_Reversed>(id);
+    }
+
+    /// It returns the node with the specified id
+    /// \param id The id of the node
+    /// \return The node
+    auto
+    operator[](Node_Id_Type const &id) const -> Node_Type const &
+    {
+      return graph.scenarios->get_source()[id];
+    }
+
+    [[nodiscard]] auto
+    cbegin() const
+    {
+      return graph.scenarios->get_source().cbegin();
+    }
+
+    [[nodiscard]] auto
+    cend() const
+    {
+      return graph.scenarios->get_source().cend();
+    }
+
+    [[nodiscard]] auto
+    begin() const
+    {
+      return cbegin();
+    }
+
+    [[nodiscard]] auto
+    end() const
+    {
+      return cend();
+    }
+
+    /// It returns the reversed graph. O(1)
+    /// \return The reversed graph
+    [[nodiscard]] auto
+    reverse() const -> Reversed_Type
+    {
+      return Reversed_Type(graph);
+    }
+
+    /// It constructs the graph of the given scenario. O(1)
+    /// \param g The scenario
+    explicit Weighted_Graph(Graph_Type const &g)
+      : Base_Weighted_Graph()
+      , graph(g)
+    {}
+
+    ~Weighted_Graph() override = default;
+  };
+
+
+  /// Alias for the Weighted_Graph of a scenario built from the Weighted_Graph of GraphType
+  /// \tparam GraphType The graph type
+  /// \tparam Reversed If the resulting graph is reversed
+  /// \tparam Weight_Type The weight type
+  template <typename GraphType, bool Reversed = false, typename Weight_Type = Time_Type>
+  using Scenario_Weighted_Graph = Weighted_Graph<Scenario_Graph<Weighted_Graph<GraphType,
+                                                                               false,
+                                                                               typename GraphType::Node_Type,
+                                                                               typename GraphType::Node_Collection_Type,
+                                                                               Weight_Type>>,
+                                                 Reversed,
+                                                 typename GraphType::Node_Type,
+                                                 typename GraphType::Node_Collection_Type,
+                                                 Weight_Type>;
+} // namespace network_butcher::kfinder
+
+#endif // NETWORK_BUTCHER_SCENARIO_WEIGHTED_GRAPH_H
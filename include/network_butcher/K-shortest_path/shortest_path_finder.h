@@ -1,40 +1,17 @@
 #ifndef NETWORK_BUTCHER_SHORTEST_PATH_FINDER_H
 #define NETWORK_BUTCHER_SHORTEST_PATH_FINDER_H
 
+#include <network_butcher/K-shortest_path/dijkstra_queues.h>
 #include <network_butcher/K-shortest_path/heap_traits.h>
 
 #include <limits>
+#include <numeric>
+#include <optional>
 #include <queue>
 #include <vector>
 
 namespace network_butcher::kfinder::Shortest_path_finder::utilities
 {
-  /// A helper struct for the Dijkstra algorithm (we lose aggregate status, but we can use the emplace methods of STL
-  /// containers)
-  template <typename Weight_Type = Time_Type>
-  struct Dijkstra_Helper : Crtp_Greater<Dijkstra_Helper<Weight_Type>>
-  {
-    /// Weight of the node
-    Weight_Type weight;
-
-    /// Node id
-    Node_Id_Type id;
-
-    /// Simple constructor
-    /// \param w Weight
-    /// \param i Index
-    Dijkstra_Helper(Weight_Type w, Node_Id_Type i)
-      : weight(w)
-      , id(i)
-    {}
-
-    bool
-    operator<(const Dijkstra_Helper &rhs) const
-    {
-      return weight < rhs.weight || (weight == rhs.weight && id < rhs.id);
-    }
-  };
-
   /// Given a pair of nodes, it will produce the smallest weight associated to one of the edges made by the pair
   /// \param graph The graph
   /// \param tail The tail node id
@@ -44,9 +21,171 @@ namespace network_butcher::kfinder::Shortest_path_finder::utilities
   auto
   get_weight(v_Weighted_Graph const &graph, Node_Id_Type tail, Node_Id_Type head) -> v_Weighted_Graph::Weight_Type
   {
-    auto const &weight_container = graph.get_weight(std::make_pair(tail, head));
+    auto const edge = std::make_pair(tail, head);
+
+    // Prefer the direct access to the smallest weight, which doesn't build (or visit) the weight collection
+    if constexpr (requires { graph.min_weight(edge); })
+      {
+        return graph.min_weight(edge);
+      }
+    else
+      {
+        auto const &weight_container = graph.get_weight(edge);
+
+        return *std::cbegin(weight_container);
+      }
+  }
+
+  /// It computes a topological order of the nodes reachable from the root through Kahn's algorithm. O(N+E)
+  /// \param graph The graph
+  /// \param root The starting vertex
+  /// \return The topological order of the nodes reachable from the root. It's empty if a cycle is reachable from the
+  /// root
+  template <Valid_Weighted_Graph v_Weighted_Graph>
+  auto
+  topological_order(v_Weighted_Graph const &graph, Node_Id_Type root) -> std::vector<Node_Id_Type>
+  {
+    std::vector<std::size_t>  in_degree(graph.size(), 0);
+    std::vector<bool>         visited(graph.size(), false);
+    std::vector<Node_Id_Type> order{root};
+    visited[root] = true;
+
+    // Visit the nodes reachable from the root, counting the edges entering each of them
+    for (std::size_t i = 0; i < order.size(); ++i)
+      {
+        for (auto const &head_node : graph.get_output_nodes(order[i]))
+          {
+            ++in_degree[head_node];
+
+            if (!visited[head_node])
+              {
+                visited[head_node] = true;
+                order.push_back(head_node);
+              }
+          }
+      }
+
+    // The root is part of a cycle
+    if (in_degree[root] != 0)
+      {
+        return {};
+      }
+
+    auto const num_reachable = order.size();
+    order.clear();
+    order.push_back(root);
+
+    // A node is added to the order once all its (reachable) predecessors have been added
+    for (std::size_t i = 0; i < order.size(); ++i)
+      {
+        for (auto const &head_node : graph.get_output_nodes(order[i]))
+          {
+            if (--in_degree[head_node] == 0)
+              {
+                order.push_back(head_node);
+              }
+          }
+      }
+
+    // Some reachable node was never released: there is a cycle
+    if (order.size() != num_reachable)
+      {
+        return {};
+      }
+
+    return order;
+  }
+
+  /// It returns the ids of a graph whose node ids are a topological order, starting from the root and following the
+  /// direction of the edges (ascending for the graph, descending for its reverse). O(N)
+  /// \param graph The graph
+  /// \param root The starting vertex
+  /// \return The ids that may be reached from the root, in topological order
+  template <Valid_Weighted_Graph v_Weighted_Graph>
+  auto
+  sorted_ids_order(v_Weighted_Graph const &graph, Node_Id_Type root) -> std::vector<Node_Id_Type>
+  {
+    auto const &outputs = graph.get_output_nodes(root);
 
-    return *weight_container.cbegin();
+    // If the root has no output edges, then the root is the only reachable node
+    if (std::cbegin(outputs) == std::cend(outputs))
+      {
+        return {root};
+      }
+
+    std::vector<Node_Id_Type> order;
+    if (*std::cbegin(outputs) > root)
+      {
+        order.resize(graph.size() - root);
+        std::iota(order.begin(), order.end(), root);
+      }
+    else
+      {
+        order.resize(root + 1);
+        std::iota(order.rbegin(), order.rend(), 0);
+      }
+
+    return order;
+  }
+
+  /// It computes the shortest paths from the root, relaxing the output edges of the nodes in the given topological
+  /// order. O(N+E)
+  /// \tparam t_Check_Ids_Order If true, the order is the one produced by sorted_ids_order and every relaxed edge is
+  /// checked to follow it (i.e., the node ids of the graph are a topological order). It throws if it doesn't
+  /// \param graph The graph
+  /// \param root The starting vertex
+  /// \param order A topological order of (at least) the nodes reachable from the root
+  /// \return The collection of successor and shortest distances
+  template <bool t_Check_Ids_Order = false, Valid_Weighted_Graph v_Weighted_Graph>
+  auto
+  relax_in_order(v_Weighted_Graph const &graph, Node_Id_Type root, std::vector<Node_Id_Type> const &order)
+    -> std::pair<std::vector<Node_Id_Type>, std::vector<typename v_Weighted_Graph::Weight_Type>>
+  {
+    using Weight_Type = typename v_Weighted_Graph::Weight_Type;
+
+    // Are the nodes visited by increasing id?
+    [[maybe_unused]] bool const increasing_ids = order.size() < 2 || order[0] < order[1];
+
+    std::vector<Weight_Type> total_distance(graph.size(), std::numeric_limits<Weight_Type>::max()); // O(N)
+    total_distance[root] = 0;
+
+    std::vector<Node_Id_Type> predecessors(graph.size(), std::numeric_limits<Node_Id_Type>::max()); // O(N)
+    predecessors[root] = root;
+
+    // When a node is visited, all its predecessors have already been visited: its distance is final
+    for (auto const &tail_node : order) // O(N)
+      {
+        auto const start_distance = total_distance[tail_node];
+        if (start_distance == std::numeric_limits<Weight_Type>::max())
+          {
+            continue;
+          }
+
+        for (auto const &head_node : graph.get_output_nodes(tail_node)) // O(M) taking into account the previous loop
+          {
+            if (head_node == tail_node)
+              continue;
+
+            if constexpr (t_Check_Ids_Order)
+              {
+                // O(1): a single comparison, it replaces the O(N+M) topological sort
+                if ((head_node > tail_node) != increasing_ids)
+                  {
+                    throw std::logic_error(
+                      "DAG shortest path tree error: the node ids of the graph are not a topological order");
+                  }
+              }
+
+            auto const candidate_distance = start_distance + get_weight(graph, tail_node, head_node);
+            if (candidate_distance < total_distance[head_node])
+              {
+                predecessors[head_node]   = tail_node;
+                total_distance[head_node] = candidate_distance;
+              }
+          }
+      }
+
+    return {std::move(predecessors), std::move(total_distance)};
   }
 } // namespace network_butcher::kfinder::Shortest_path_finder::utilities
 
@@ -59,12 +198,16 @@ namespace network_butcher::kfinder::Shortest_path_finder
 
 
   /// Executes Dijkstra algorithm to compute the shortest paths from the root to every node of the graph. The overall
-  /// time complexity should be O((N+E)*log(N))
+  /// time complexity should be O((N+E)*log(N)) with the default queue
   /// \tparam v_Weighted_Graph The weighted graph type
+  /// \tparam t_Queue_Type The priority queue policy (Dijkstra_Set_Queue, Dijkstra_Pairing_Heap or, for integral
+  /// weights, Dijkstra_Radix_Heap)
   /// \param graph The graph
   /// \param root The starting vertex
   /// \return The collection of successor and shortest distances
-  template <Valid_Weighted_Graph v_Weighted_Graph>
+  template <Valid_Weighted_Graph v_Weighted_Graph,
+            Valid_Dijkstra_Queue t_Queue_Type = Dijkstra_Set_Queue<typename v_Weighted_Graph::Weight_Type>>
+    requires std::is_same_v<typename t_Queue_Type::Weight_Type, typename v_Weighted_Graph::Weight_Type>
   [[nodiscard]] auto
   dijkstra(v_Weighted_Graph const &graph,
            Node_Id_Type            root)
@@ -72,7 +215,6 @@ namespace network_butcher::kfinder::Shortest_path_finder
   {
     using Weight_Type            = typename v_Weighted_Graph::Weight_Type;
     using dijkstra_result_type   = Templated_Dijkstra_Result_Type<Weight_Type>;
-    using dijkstra_helper_struct = utilities::Dijkstra_Helper<Weight_Type>;
 
     if (graph.empty())
       {
@@ -85,9 +227,8 @@ namespace network_butcher::kfinder::Shortest_path_finder
     std::vector<Node_Id_Type> predecessors(graph.size(), std::numeric_limits<Node_Id_Type>::max()); // O(N)
     predecessors[root] = root;
 
-    // We are using a set instead of a priority_queue to have O(log(N)) erase
-    std::set<dijkstra_helper_struct> to_visit;
-    to_visit.emplace(0, root);
+    t_Queue_Type to_visit(graph.size());
+    to_visit.push(root, 0);
 
     auto const error_message = [](auto const &tail, auto const &head) {
       std::stringstream error_msg;
@@ -104,38 +245,39 @@ namespace network_butcher::kfinder::Shortest_path_finder
     // The complexity due to the loop is considered below
     while (!to_visit.empty())
       {
-        auto current_node =
-          std::move(to_visit.extract(to_visit.begin()).value());      // O(N*log(N)), O(log(N)) up to once per node
+        auto const current_node = to_visit.pop();                     // O(N*log(N)), O(log(N)) up to once per node
 
-        auto const &start_distance = total_distance[current_node.id]; // O(N), O(1) once per node
+        auto const &start_distance = total_distance[current_node];    // O(N), O(1) once per node
         if (start_distance == std::numeric_limits<Weight_Type>::max())
           {
             throw std::logic_error("Dijkstra error: the node current distance is +inf");
           }
 
         for (auto const &head_node :
-             graph.get_output_nodes(current_node.id)) // O(M) taking into account the previous loop
+             graph.get_output_nodes(current_node)) // O(M) taking into account the previous loop
           {
-            if (head_node == current_node.id)
+            if (head_node == current_node)
               continue;
 
-            auto      &base_distance = total_distance[head_node];       // O(1)
+            auto      &base_distance = total_distance[head_node];    // O(1)
             auto const weight =
-              utilities::get_weight(graph, current_node.id, head_node); // Up to O(log(N)) base on the underlying graph
+              utilities::get_weight(graph, current_node, head_node); // Up to O(log(N)) base on the underlying graph
 
             if (weight < 0)
               {
-                throw std::logic_error(error_message(current_node.id, head_node));
+                throw std::logic_error(error_message(current_node, head_node));
               }
 
-            auto const candidate_distance = start_distance + weight;              // O(1)
-            if (candidate_distance < base_distance)                               // O(1)
+            auto const candidate_distance = start_distance + weight; // O(1)
+            if (candidate_distance < base_distance)                  // O(1)
               {
-                to_visit.erase(dijkstra_helper_struct(base_distance, head_node)); // O(log(N)
+                if (base_distance == std::numeric_limits<Weight_Type>::max())
+                  to_visit.push(head_node, candidate_distance);      // Up to O(log(N))
+                else
+                  to_visit.decrease_key(head_node, base_distance, candidate_distance); // Up to O(log(N))
 
-                predecessors[head_node] = current_node.id;                        // O(1)
-                base_distance           = candidate_distance;                     // O(1)
-                to_visit.emplace(candidate_distance, head_node);                  // O(log(N))
+                predecessors[head_node] = current_node;              // O(1)
+                base_distance           = candidate_distance;        // O(1)
               }
           }
       }
@@ -144,6 +286,158 @@ namespace network_butcher::kfinder::Shortest_path_finder
   }
 
 
+  /// Computes the shortest paths from the root to every node of an acyclic graph, relaxing the edges of the nodes in
+  /// topological order. No heap is required and the time complexity is O(N+E). Contrary to dijkstra, negative weights
+  /// are allowed. If the graph type is declared through Topologically_Sorted_Graph, the node ids are used as the
+  /// topological order (and it throws if an edge doesn't follow it).
+  /// \tparam v_Weighted_Graph The weighted graph type
+  /// \param graph The graph
+  /// \param root The starting vertex
+  /// \return The collection of successor and shortest distances (with the same format of the dijkstra output)
+  template <Valid_Weighted_Graph v_Weighted_Graph>
+  [[nodiscard]] auto
+  dag_shortest_path_tree(v_Weighted_Graph const &graph, Node_Id_Type root)
+    -> Templated_Dijkstra_Result_Type<typename v_Weighted_Graph::Weight_Type> // time: (N+M)
+  {
+    if (graph.empty())
+      {
+        return {};
+      }
+
+    if constexpr (Topologically_Sorted_Graph<typename v_Weighted_Graph::Graph_Type>::value)
+      {
+        return utilities::relax_in_order<true>(graph, root, utilities::sorted_ids_order(graph, root));
+      }
+    else
+      {
+        auto const order = utilities::topological_order(graph, root); // O(N+M)
+
+        if (order.empty())
+          {
+            throw std::logic_error("DAG shortest path tree error: the graph has a cycle");
+          }
+
+        return utilities::relax_in_order(graph, root, order);
+      }
+  }
+
+
+  /// Computes the shortest paths from the root to every node of the graph. If the graph type is declared through
+  /// Topologically_Sorted_Graph or if no cycle is reachable from the root, the edges are relaxed in topological order
+  /// (O(N+M), see dag_shortest_path_tree). Otherwise, it falls back to dijkstra
+  /// \tparam v_Weighted_Graph The weighted graph type
+  /// \tparam t_Queue_Type The priority queue policy used by dijkstra
+  /// \param graph The graph
+  /// \param root The starting vertex
+  /// \return The collection of successor and shortest distances
+  template <Valid_Weighted_Graph v_Weighted_Graph,
+            Valid_Dijkstra_Queue t_Queue_Type = Dijkstra_Set_Queue<typename v_Weighted_Graph::Weight_Type>>
+  [[nodiscard]] auto
+  shortest_path_tree(v_Weighted_Graph const &graph, Node_Id_Type root)
+    -> Templated_Dijkstra_Result_Type<typename v_Weighted_Graph::Weight_Type>
+  {
+    if constexpr (Topologically_Sorted_Graph<typename v_Weighted_Graph::Graph_Type>::value)
+      {
+        return dag_shortest_path_tree(graph, root);
+      }
+    else
+      {
+        if (graph.empty())
+          {
+            return {};
+          }
+
+        // The check is O(N+M), thus it doesn't change the overall complexity of dijkstra
+        auto const order = utilities::topological_order(graph, root);
+
+        if (order.empty())
+          {
+            return dijkstra<v_Weighted_Graph, t_Queue_Type>(graph, root);
+          }
+
+        return utilities::relax_in_order(graph, root, order);
+      }
+  }
+
+
+  /// Computes a lower bound of the distance from every node to the sink of a layered graph, i.e., a graph whose edges
+  /// only connect a layer to the following one (as in the block graph, where a layer collects the copies of a node on
+  /// the different devices). A path from a node to the sink leaves the node through one of its edges and then it
+  /// enters every following layer exactly once: the bound is the smallest weight of the edges leaving the node plus
+  /// the smallest weights of the edges entering the layers after the next one. It's consistent and it doesn't require
+  /// any relaxation. O(N+M)
+  /// \tparam v_Weighted_Graph The weighted graph type
+  /// \param graph The graph
+  /// \param layers The layer of every node
+  /// \param sink The sink node
+  /// \return The lower bounds (the maximum weight for the nodes that cannot reach the sink) or std::nullopt if an edge
+  /// doesn't connect two consecutive layers
+  template <Valid_Weighted_Graph v_Weighted_Graph>
+  [[nodiscard]] auto
+  layered_lower_bounds(v_Weighted_Graph const &graph, std::vector<std::size_t> const &layers, Node_Id_Type sink)
+    -> std::optional<std::vector<typename v_Weighted_Graph::Weight_Type>>
+  {
+    using Weight_Type = typename v_Weighted_Graph::Weight_Type;
+
+    constexpr auto max_weight = std::numeric_limits<Weight_Type>::max();
+
+    if (graph.empty())
+      {
+        return std::vector<Weight_Type>{};
+      }
+
+    auto const sink_layer = layers[sink];
+
+    // The smallest weight of the edges entering every layer and of the edges leaving every node
+    std::vector<Weight_Type> min_entering(sink_layer + 1, max_weight);
+    std::vector<Weight_Type> min_leaving(graph.size(), max_weight);
+
+    for (Node_Id_Type tail = 0; tail < graph.size(); ++tail)
+      {
+        for (auto const &head : graph.get_output_nodes(tail))
+          {
+            if (layers[head] != layers[tail] + 1)
+              {
+                return std::nullopt;
+              }
+
+            auto const weight = utilities::get_weight(graph, tail, head);
+            min_leaving[tail] = std::min(min_leaving[tail], weight);
+
+            if (layers[head] <= sink_layer)
+              {
+                min_entering[layers[head]] = std::min(min_entering[layers[head]], weight);
+              }
+          }
+      }
+
+    // The bound of every layer, from the sink backwards. The layers that cannot be crossed make the previous ones
+    // unable to reach the sink
+    std::vector<Weight_Type> layer_bounds(sink_layer + 1, max_weight);
+    layer_bounds[sink_layer] = 0;
+
+    for (auto layer = sink_layer; layer > 0; --layer)
+      {
+        if (layer_bounds[layer] != max_weight && min_entering[layer] != max_weight)
+          layer_bounds[layer - 1] = layer_bounds[layer] + min_entering[layer];
+      }
+
+    // The other nodes of the sink layer (and of the following ones) cannot reach the sink
+    std::vector<Weight_Type> res(graph.size(), max_weight);
+    res[sink] = 0;
+
+    for (Node_Id_Type node = 0; node < graph.size(); ++node)
+      {
+        auto const layer = layers[node];
+
+        if (layer < sink_layer && min_leaving[node] != max_weight && layer_bounds[layer + 1] != max_weight)
+          res[node] = min_leaving[node] + layer_bounds[layer + 1];
+      }
+
+    return res;
+  }
+
+
   /// Given the result of the Dijkstra algorithm, it will return the shortest path from the root to the final node
   /// \param graph The graph
   /// \param dij_res The result of the dijkstra algorithm
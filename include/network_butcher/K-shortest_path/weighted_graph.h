@@ -53,7 +53,8 @@ namespace network_butcher::kfinder
     /// Alias for the graph type
     using Graph_Type = InternalGraphType;
 
-    /// Alias for the weights of a pair of nodes
+    /// Alias for the weights of a pair of nodes. Any range sorted in ascending order is accepted: specializations
+    /// should return a view of their internal storage, so that no allocation is performed
     using Weight_Edge_Type = std::multiset<Weight_Type>;
 
     /// Alias for the node type
@@ -69,6 +70,12 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     get_weight(Edge_Type const &edge) const -> Weight_Edge_Type;
 
+    /// It should return the smallest weight of the edge
+    /// \param edge The edge
+    /// \return The smallest weight of the edge
+    [[nodiscard]] auto
+    min_weight(Edge_Type const &edge) const -> Weight_Type;
+
     /// It should return the number of nodes
     /// \return The number of nodes
     [[nodiscard]] auto
@@ -82,7 +89,7 @@ namespace network_butcher::kfinder
     /// It should return the out neighbours of the node with id in the graph
     /// \param id The ids of the neighbours
     [[nodiscard]] auto
-    get_output_nodes(Node_Id_Type const &id) const -> std::set<Node_Id_Type> const &;
+    get_output_nodes(Node_Id_Type const &id) const -> Neighbour_Id_Collection_Type const &;
 
     /// It should return the node (as a constant reference) with the specified id
     /// \param id The id of the node
@@ -130,6 +137,15 @@ namespace network_butcher::kfinder
   /// \tparam T The considered type. It should be a child of Base_Weighted_Graph
   template <typename T>
   concept Valid_Weighted_Graph = std::is_base_of_v<Base_Weighted_Graph, T>;
+
+  /// Graph trait. It should be specialized (inheriting from std::true_type) for the graph types that are acyclic by
+  /// construction and whose node ids are a topological order (i.e., every edge goes from a node to a node with a
+  /// greater id). For these graphs, the shortest path tree is computed without any heap or topological sort: every
+  /// relaxed edge is only checked to go to a node with a greater id (an exception is thrown otherwise).
+  /// \tparam GraphType The graph type (the one proxied by the Weighted_Graph)
+  template <typename GraphType>
+  struct Topologically_Sorted_Graph : std::false_type
+  {};
 } // namespace network_butcher::kfinder
 
 #endif // NETWORK_BUTCHER_WEIGHTED_GRAPH_H
\ No newline at end of file
@@ -20,7 +20,7 @@ namespace network_butcher::types
   {
   public:
     /// Type of the collection of the neighbours of each node
-    using Neighbours_Type      = std::vector<std::pair<Node_Id_Collection_Type, Node_Id_Collection_Type>>;
+    using Neighbours_Type      = std::vector<std::pair<Neighbour_Id_Collection_Type, Neighbour_Id_Collection_Type>>;
 
     /// Alias for the node type
     using Node_Type            = Template_Node_Type;
@@ -211,7 +211,7 @@ namespace network_butcher::types
   {
   public:
     /// Type of the collection of the neighbours of each node
-    using Neighbours_Type      = std::vector<std::pair<Node_Id_Collection_Type, Node_Id_Collection_Type>>;
+    using Neighbours_Type      = std::vector<std::pair<Neighbour_Id_Collection_Type, Neighbour_Id_Collection_Type>>;
 
     /// Alias for the node type
     using Node_Type            = CNode<Content<T>>;
@@ -447,28 +447,38 @@ namespace network_butcher::types
     neighbours = Neighbours_Type();
     neighbours.resize(nodes.size());
 
-    // Compute appearances of inputs/outputs for a node
-    std::unordered_map<std::string, Node_Id_Collection_Type> input_appearances;
-    std::unordered_map<std::string, Node_Id_Collection_Type> output_appearances;
+    // Compute appearances of inputs/outputs for a node. The names are interned, thus the appearances are addressed by
+    // their ids
+    std::vector<Node_Id_Collection_Type> input_appearances;
+    std::vector<Node_Id_Collection_Type> output_appearances;
+
+    auto const add_appearances = [](auto const &collection, auto &appearances, Node_Id_Type node_id) {
+      for (auto const &[id, _] : collection)
+        {
+          if (id >= appearances.size())
+            appearances.resize(id + 1);
+
+          appearances[id].insert(node_id);
+        }
+    };
 
     // Check which node has which input/output
     for (auto const &node : nodes)
       {
-        auto const &content = node.content;
-        for (auto &in : content.get_input())
-          input_appearances[in.first].insert(node.get_id());
-        for (auto &out : content.get_output())
-          output_appearances[out.first].insert(node.get_id());
+        add_appearances(node.content.get_input(), input_appearances, node.get_id());
+        add_appearances(node.content.get_output(), output_appearances, node.get_id());
       }
 
     // Matched the input of a node to his outputs and viceversa
-    for (auto const &appearance : input_appearances)
+    for (std::size_t id = 0; id < std::min(input_appearances.size(), output_appearances.size()); ++id)
       {
-        auto const &neib = output_appearances[appearance.first];
-        for (auto node_id : appearance.second)
+        auto const &inputs = input_appearances[id];
+        auto const &neib   = output_appearances[id];
+
+        for (auto node_id : inputs)
           neighbours[node_id].first.insert(neib.cbegin(), neib.cend());
         for (auto node_id : neib)
-          neighbours[node_id].second.insert(appearance.second.cbegin(), appearance.second.cend());
+          neighbours[node_id].second.insert(inputs.cbegin(), inputs.cend());
       }
   }
 } // namespace network_butcher::types
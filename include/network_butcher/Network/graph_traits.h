@@ -16,5 +16,14 @@ namespace network_butcher
   using Block_Graph_Type          = network_butcher::types::WGraph<false, Block_Graph_Node_Type>;
 } // namespace network_butcher
 
+namespace network_butcher::kfinder
+{
+  /// The block graph built by build_block_graph is layered: every edge goes from a node to a node with a greater id.
+  /// Other graphs of this type are checked while computing the shortest path tree (see dag_shortest_path_tree)
+  template <>
+  struct Topologically_Sorted_Graph<Block_Graph_Type> : std::true_type
+  {};
+} // namespace network_butcher::kfinder
+
 
 #endif // NETWORK_BUTCHER_GRAPH_TRAITS_H
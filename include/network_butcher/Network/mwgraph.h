@@ -1,6 +1,11 @@
 #ifndef NETWORK_BUTCHER_MWGRAPH_H
 #define NETWORK_BUTCHER_MWGRAPH_H
 
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <span>
+
 #include <network_butcher/Network/graph.h>
 
 
@@ -32,26 +37,188 @@ namespace network_butcher::types
     using Weight_Type = t_Weight_Type;
 
   private:
-    /// Helper alias for the weight collection: a vector containing for each node a map to the edge weights, indexed by
-    /// the head node in the edge
-    using single_edge_weight_container = std::vector<std::map<Node_Id_Type, Weight_Type>>;
+    /// Helper alias for the weight collection of a device: the weight of every edge, addressed by the edge id
+    using single_edge_weight_container = std::vector<Weight_Type>;
+
+    /// Helper alias for the weight collection of a device: the weights of every edge (sorted in ascending order),
+    /// addressed by the edge id
+    using multi_edge_weight_container = std::vector<std::vector<Weight_Type>>;
 
-    /// Helper alias for the weight collection: a vector containing for each node a multimap to the edge weights,
-    /// indexed by the head node in the edge
-    using multi_edge_weight_container = std::vector<std::multimap<Node_Id_Type, Weight_Type>>;
+    /// Number of edges recorded by a word of the presence bitmaps
+    static constexpr std::size_t bitmap_word_size = 64;
 
   public:
     /// Collection type for the weights of a given pair of nodes
     using Edge_Weight_Type = std::conditional_t<Parallel_Edges, std::multiset<Weight_Type>, Weight_Type>;
 
+    /// Read-only view of the weights of a given pair of nodes, sorted in ascending order. It refers directly to the
+    /// internal weight collection, thus it's invalidated by set_weight (with parallel edges)
+    using Edge_Weight_View_Type = std::span<Weight_Type const>;
+
     /// The actual weight collection type
     using Weight_Collection_Type =
       std::conditional_t<Parallel_Edges, multi_edge_weight_container, single_edge_weight_container>;
 
   protected:
-    /// The weight collection
+    /// The edges leaving a node have consecutive ids (in ascending order of their head), starting from the offset
+    /// of the node. The ids are assigned when the graph is built
+    std::vector<std::size_t> edge_offsets;
+
+    /// The head of every edge, addressed by the edge id
+    std::vector<Node_Id_Type> edge_heads;
+
+    /// The weight collection: for every device, the weights addressed by the edge id
     std::vector<Weight_Collection_Type> weigth_map;
 
+    /// For every device, the bitmap of the edges with a weight (only without parallel edges: otherwise, an edge has a
+    /// weight if its collection isn't empty)
+    std::vector<std::vector<std::uint64_t>> weight_bitmaps;
+
+  private:
+    /// It assigns the ids to the edges of the graph and it allocates the (empty) weight collections
+    void
+    index_edges()
+    {
+      auto const num_nodes = Parent_Type::size();
+
+      edge_offsets.assign(num_nodes + 1, 0);
+      for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+        edge_offsets[tail + 1] = edge_offsets[tail] + Parent_Type::get_output_nodes(tail).size();
+
+      edge_heads.clear();
+      edge_heads.reserve(edge_offsets.back());
+      for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+        {
+          auto const &heads = Parent_Type::get_output_nodes(tail);
+          edge_heads.insert(edge_heads.end(), heads.cbegin(), heads.cend());
+        }
+
+      for (auto &weights : weigth_map)
+        weights.assign(edge_heads.size(), typename Weight_Collection_Type::value_type{});
+
+      if constexpr (!Parallel_Edges)
+        {
+          weight_bitmaps.assign(weigth_map.size(),
+                                std::vector<std::uint64_t>((edge_heads.size() + bitmap_word_size - 1) /
+                                                           bitmap_word_size));
+        }
+    }
+
+    /// It finds the id of the given edge (binary search among the edges leaving its tail)
+    /// \param edge The edge
+    /// \return The id of the edge, if it existed when the graph was built
+    [[nodiscard]] auto
+    find_edge_id(Edge_Type const &edge) const -> std::optional<std::size_t>
+    {
+      if (edge.first >= Parent_Type::size())
+        {
+          return std::nullopt;
+        }
+
+      auto const first = edge_heads.cbegin() + edge_offsets[edge.first];
+      auto const last  = edge_heads.cbegin() + edge_offsets[edge.first + 1];
+      auto const it    = std::lower_bound(first, last, edge.second);
+
+      if (it == last || *it != edge.second)
+        {
+          return std::nullopt;
+        }
+
+      return static_cast<std::size_t>(it - edge_heads.cbegin());
+    }
+
+    /// Checks if the edge with the given id has a weight on the given device. The word of the bitmap is read
+    /// atomically, since the weights of other edges may be set concurrently
+    /// \param device The device id
+    /// \param id The edge id
+    /// \return True if the edge has a weight
+    [[nodiscard]] auto
+    has_weight(std::size_t device, std::size_t id) const -> bool
+    {
+      if constexpr (Parallel_Edges)
+        {
+          return !weigth_map[device][id].empty();
+        }
+      else
+        {
+          // std::atomic_ref requires a non-const object, but the word is only read
+          auto      &word = const_cast<std::uint64_t &>(weight_bitmaps[device][id / bitmap_word_size]);
+          auto const bits = std::atomic_ref<std::uint64_t>(word).load(std::memory_order_relaxed);
+
+          return (bits >> (id % bitmap_word_size)) & 1U;
+        }
+    }
+
+    /// It finds the weights associated to the given edge on the given device
+    /// \param device The device id
+    /// \param edge The edge
+    /// \return The (non-empty) weights, sorted in ascending order
+    [[nodiscard]] auto
+    find_weights(std::size_t device, Edge_Type const &edge) const -> Edge_Weight_View_Type
+    {
+      if (device >= weigth_map.size())
+        {
+          throw std::runtime_error("MWGraph::get_weight : the device " + Utilities::custom_to_string(device) +
+                                   " does not exist");
+        }
+
+      auto const id = find_edge_id(edge);
+
+      if (!id || !has_weight(device, *id))
+        {
+          if (Parent_Type::check_edge(edge))
+            {
+              throw std::runtime_error("MWGraph::get_weight : the edge " + Utilities::custom_to_string(edge) +
+                                       " was not associated with any weight of device " +
+                                       Utilities::custom_to_string(device));
+            }
+          else
+            {
+              throw std::runtime_error("MWGraph::get_weight : the edge " + Utilities::custom_to_string(edge) +
+                                       " does not exist");
+            }
+        }
+
+      if constexpr (Parallel_Edges)
+        {
+          return weigth_map[device][*id];
+        }
+      else
+        {
+          return Edge_Weight_View_Type(&weigth_map[device][*id], 1);
+        }
+    }
+
+    /// It stores the weight of the given edge. The weights of parallel edges are kept sorted in ascending order, so
+    /// that the first one is always the smallest one. Only the storage of the given edge is modified (and, without
+    /// parallel edges, its bit is set atomically), thus the weights of different edges can be set concurrently
+    /// \param device The device id
+    /// \param edge The edge
+    /// \param weight The weight
+    void
+    insert_weight(std::size_t device, Edge_Type const &edge, Weight_Type const &weight)
+    {
+      auto const id = find_edge_id(edge);
+
+      if (!id)
+        {
+          throw std::runtime_error("MWGraph::set_weight : the edge " + Utilities::custom_to_string(edge) +
+                                   " was added after the construction of the graph");
+        }
+
+      if constexpr (Parallel_Edges)
+        {
+          auto &weights = weigth_map[device][*id];
+          weights.insert(std::upper_bound(weights.cbegin(), weights.cend(), weight), weight);
+        }
+      else
+        {
+          weigth_map[device][*id] = weight;
+          std::atomic_ref<std::uint64_t>(weight_bitmaps[device][*id / bitmap_word_size])
+            .fetch_or(std::uint64_t{1} << (*id % bitmap_word_size), std::memory_order_relaxed);
+        }
+    }
+
   public:
     /// It constructs (using perfect forwarding) a MWGraph
     /// \param num_maps The number of weight collections to store
@@ -68,10 +235,7 @@ namespace network_butcher::types
         }
 
       weigth_map.resize(num_maps);
-      for (auto &map : weigth_map)
-        {
-          map.resize(Parent_Type::size());
-        }
+      index_edges();
     }
 
 
@@ -101,7 +265,9 @@ namespace network_butcher::types
     [[nodiscard]] auto
     check_weight(std::size_t device, Edge_Type const &edge) const -> bool
     {
-      return weigth_map[device][edge.first].contains(edge.second);
+      auto const id = find_edge_id(edge);
+
+      return id && has_weight(device, *id);
     }
 
 
@@ -112,47 +278,43 @@ namespace network_butcher::types
     [[nodiscard]] auto
     get_weight(std::size_t device, Edge_Type const &edge) const
     {
-      if (device >= weigth_map.size())
-        {
-          throw std::runtime_error("MWGraph::get_weight : the device " + Utilities::custom_to_string(device) +
-                                   " does not exist");
-        }
-
-      auto const &map = weigth_map[device][edge.first];
-      auto        it  = map.find(edge.second);
-
-      Edge_Weight_Type res;
-      if (it == map.cend())
-        {
-          if (Parent_Type::check_edge(edge))
-            {
-              throw std::runtime_error("MWGraph::get_weight : the edge " + Utilities::custom_to_string(edge) +
-                                       " was not associated with any weight of device " +
-                                       Utilities::custom_to_string(device));
-            }
-          else
-            {
-              throw std::runtime_error("MWGraph::get_weight : the edge " + Utilities::custom_to_string(edge) +
-                                       " does not exist");
-            }
-        }
+      auto const weights = find_weights(device, edge);
 
       if constexpr (Parallel_Edges)
         {
-          for (; it != map.cend() && it->first == edge.second; ++it)
-            res.insert(it->second);
+          return Edge_Weight_Type(weights.begin(), weights.end());
         }
       else
         {
-          res = it->second;
+          return weights.front();
         }
+    }
+
 
-      return res;
+    /// Get a view of the weight(s) for the given edge on the given device, without copying them
+    /// \param device The device id
+    /// \param edge The edge
+    /// \return The weight(s), sorted in ascending order
+    [[nodiscard]] auto
+    get_weights(std::size_t device, Edge_Type const &edge) const -> Edge_Weight_View_Type
+    {
+      return find_weights(device, edge);
+    }
+
+
+    /// Get the smallest weight for the given edge on the given device
+    /// \param device The device id
+    /// \param edge The edge
+    /// \return The smallest weight
+    [[nodiscard]] auto
+    min_weight(std::size_t device, Edge_Type const &edge) const -> Weight_Type
+    {
+      return find_weights(device, edge).front();
     }
 
 
     /// Sets the weight for the given edge on the given device. If parallel edges are allowed, it will add it to the
-    /// collection of weights for the associated edge
+    /// collection of weights for the associated edge. The weights of different edges can be set concurrently
     /// \param device The device id
     /// \param edge The edge
     /// \param weight The weight
@@ -165,14 +327,7 @@ namespace network_butcher::types
                                    " does not exist");
         }
 
-      if constexpr (Parallel_Edges)
-        {
-          weigth_map[device][edge.first].emplace(edge.second, weight);
-        }
-      else
-        {
-          weigth_map[device][edge.first][edge.second] = weight;
-        }
+      insert_weight(device, edge, weight);
     }
 
     /// Adds to the chosen edge the collection of weights. They will be considered as the cost of the extra edges
@@ -186,7 +341,7 @@ namespace network_butcher::types
       if (Parent_Type::check_edge(edge))
         {
           for (auto const &weight : weights)
-            weigth_map[device][edge.first].emplace(edge.second, weight);
+            insert_weight(device, edge, weight);
         }
       else
         {
@@ -204,6 +359,52 @@ namespace network_butcher::types
       return weigth_map.size();
     }
 
+
+    /// Gets the number of edges (when the graph was built)
+    /// \return Number of edges
+    [[nodiscard]] auto
+    get_num_edges() const -> std::size_t
+    {
+      return edge_heads.size();
+    }
+
+
+    /// Gets the id of the given edge. The edges leaving a node have consecutive ids
+    /// \param edge The edge
+    /// \return The id of the edge
+    [[nodiscard]] auto
+    get_edge_id(Edge_Type const &edge) const -> std::size_t
+    {
+      auto const id = find_edge_id(edge);
+
+      if (!id)
+        {
+          throw std::runtime_error("MWGraph::get_edge_id : the edge " + Utilities::custom_to_string(edge) +
+                                   " does not exist");
+        }
+
+      return *id;
+    }
+
+
+    /// Gets the weights of all the edges on the given device, addressed by the edge id. The weights of the edges
+    /// without a weight are default constructed (see check_weight)
+    /// \param device The device id
+    /// \return The weights, stored contiguously
+    [[nodiscard]] auto
+    get_device_weights(std::size_t device) const -> std::span<Weight_Type const>
+      requires(!Parallel_Edges)
+    {
+      if (device >= weigth_map.size())
+        {
+          throw std::runtime_error("MWGraph::get_device_weights : the device " + Utilities::custom_to_string(device) +
+                                   " does not exist");
+        }
+
+      return weigth_map[device];
+    }
+
+
     /// Simple helper function that will print the graph
     /// \return The graph description
     [[nodiscard]] virtual auto
@@ -212,27 +413,23 @@ namespace network_butcher::types
       std::stringstream builder;
       builder << "In Out Weight_Map_Id Weight" << std::endl;
 
-      std::set<std::pair<Node_Id_Type, Node_Id_Type>> recorded_edges;
       for (auto const &node : Parent_Type::nodes)
         {
           for (auto const &out : Parent_Type::get_output_nodes(node.get_id()))
             {
-              recorded_edges.emplace_hint(recorded_edges.end(), std::make_pair(node.get_id(), out));
+              auto const  edge = std::make_pair(node.get_id(), out);
               std::string base_tmp =
                 Utilities::custom_to_string(node.get_id()) + " " + Utilities::custom_to_string(out) + " ";
               for (std::size_t i = 0; i < weigth_map.size(); ++i)
                 {
-                  auto const &map = weigth_map[i];
-
                   if constexpr (Parallel_Edges)
                     {
                       std::string new_base = base_tmp + Utilities::custom_to_string(i) + " ";
-                      auto        it       = map[node.get_id()].find(out);
-                      if (it != map[node.get_id()].cend())
+                      if (check_weight(i, edge))
                         {
-                          for (; it != map[node.get_id()].cend() && it->first == out; ++it)
+                          for (auto const &weight : find_weights(i, edge))
                             {
-                              builder << new_base << Utilities::custom_to_string(it->second) << std::endl;
+                              builder << new_base << Utilities::custom_to_string(weight) << std::endl;
                             }
                         }
                       else
@@ -244,11 +441,9 @@ namespace network_butcher::types
                     {
                       builder << base_tmp << Utilities::custom_to_string(i) << " ";
 
-                      auto it = map[node.get_id()].find(out);
-
-                      if (it != map[node.get_id()].cend())
+                      if (check_weight(i, edge))
                         {
-                          builder << Utilities::custom_to_string(it->second);
+                          builder << Utilities::custom_to_string(find_weights(i, edge).front());
                         }
                       else
                         {
@@ -294,26 +489,188 @@ namespace network_butcher::types
     using Weight_Type = Time_Type;
 
   private:
-    /// Helper alias for the weight collection: a vector containing for each node a map to the edge weights, indexed by
-    /// the head node in the edge
-    using single_edge_weight_container = std::vector<std::map<Node_Id_Type, Weight_Type>>;
+    /// Helper alias for the weight collection of a device: the weight of every edge, addressed by the edge id
+    using single_edge_weight_container = std::vector<Weight_Type>;
+
+    /// Helper alias for the weight collection of a device: the weights of every edge (sorted in ascending order),
+    /// addressed by the edge id
+    using multi_edge_weight_container = std::vector<std::vector<Weight_Type>>;
 
-    /// Helper alias for the weight collection: a vector containing for each node a multimap to the edge weights,
-    /// indexed by the head node in the edge
-    using multi_edge_weight_container = std::vector<std::multimap<Node_Id_Type, Weight_Type>>;
+    /// Number of edges recorded by a word of the presence bitmaps
+    static constexpr std::size_t bitmap_word_size = 64;
 
   public:
     /// Collection type for the weights of a given pair of nodes
     using Edge_Weight_Type = std::conditional_t<Parallel_Edges, std::multiset<Weight_Type>, Weight_Type>;
 
+    /// Read-only view of the weights of a given pair of nodes, sorted in ascending order. It refers directly to the
+    /// internal weight collection, thus it's invalidated by set_weight (with parallel edges)
+    using Edge_Weight_View_Type = std::span<Weight_Type const>;
+
     /// The actual weight collection type
     using Weight_Collection_Type =
       std::conditional_t<Parallel_Edges, multi_edge_weight_container, single_edge_weight_container>;
 
   protected:
-    /// The weight collection
+    /// The edges leaving a node have consecutive ids (in ascending order of their head), starting from the offset
+    /// of the node. The ids are assigned when the graph is built
+    std::vector<std::size_t> edge_offsets;
+
+    /// The head of every edge, addressed by the edge id
+    std::vector<Node_Id_Type> edge_heads;
+
+    /// The weight collection: for every device, the weights addressed by the edge id
     std::vector<Weight_Collection_Type> weigth_map;
 
+    /// For every device, the bitmap of the edges with a weight (only without parallel edges: otherwise, an edge has a
+    /// weight if its collection isn't empty)
+    std::vector<std::vector<std::uint64_t>> weight_bitmaps;
+
+  private:
+    /// It assigns the ids to the edges of the graph and it allocates the (empty) weight collections
+    void
+    index_edges()
+    {
+      auto const num_nodes = Parent_Type::size();
+
+      edge_offsets.assign(num_nodes + 1, 0);
+      for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+        edge_offsets[tail + 1] = edge_offsets[tail] + Parent_Type::get_output_nodes(tail).size();
+
+      edge_heads.clear();
+      edge_heads.reserve(edge_offsets.back());
+      for (Node_Id_Type tail = 0; tail < num_nodes; ++tail)
+        {
+          auto const &heads = Parent_Type::get_output_nodes(tail);
+          edge_heads.insert(edge_heads.end(), heads.cbegin(), heads.cend());
+        }
+
+      for (auto &weights : weigth_map)
+        weights.assign(edge_heads.size(), typename Weight_Collection_Type::value_type{});
+
+      if constexpr (!Parallel_Edges)
+        {
+          weight_bitmaps.assign(weigth_map.size(),
+                                std::vector<std::uint64_t>((edge_heads.size() + bitmap_word_size - 1) /
+                                                           bitmap_word_size));
+        }
+    }
+
+    /// It finds the id of the given edge (binary search among the edges leaving its tail)
+    /// \param edge The edge
+    /// \return The id of the edge, if it existed when the graph was built
+    [[nodiscard]] auto
+    find_edge_id(Edge_Type const &edge) const -> std::optional<std::size_t>
+    {
+      if (edge.first >= Parent_Type::size())
+        {
+          return std::nullopt;
+        }
+
+      auto const first = edge_heads.cbegin() + edge_offsets[edge.first];
+      auto const last  = edge_heads.cbegin() + edge_offsets[edge.first + 1];
+      auto const it    = std::lower_bound(first, last, edge.second);
+
+      if (it == last || *it != edge.second)
+        {
+          return std::nullopt;
+        }
+
+      return static_cast<std::size_t>(it - edge_heads.cbegin());
+    }
+
+    /// Checks if the edge with the given id has a weight on the given device. The word of the bitmap is read
+    /// atomically, since the weights of other edges may be set concurrently
+    /// \param device The device id
+    /// \param id The edge id
+    /// \return True if the edge has a weight
+    [[nodiscard]] auto
+    has_weight(std::size_t device, std::size_t id) const -> bool
+    {
+      if constexpr (Parallel_Edges)
+        {
+          return !weigth_map[device][id].empty();
+        }
+      else
+        {
+          // std::atomic_ref requires a non-const object, but the word is only read
+          auto      &word = const_cast<std::uint64_t &>(weight_bitmaps[device][id / bitmap_word_size]);
+          auto const bits = std::atomic_ref<std::uint64_t>(word).load(std::memory_order_relaxed);
+
+          return (bits >> (id % bitmap_word_size)) & 1U;
+        }
+    }
+
+    /// It finds the weights associated to the given edge on the given device
+    /// \param device The device id
+    /// \param edge The edge
+    /// \return The (non-empty) weights, sorted in ascending order
+    [[nodiscard]] auto
+    find_weights(std::size_t device, Edge_Type const &edge) const -> Edge_Weight_View_Type
+    {
+      if (device >= weigth_map.size())
+        {
+          throw std::runtime_error("MWGraph::get_weight : the device " + Utilities::custom_to_string(device) +
+                                   " does not exist");
+        }
+
+      auto const id = find_edge_id(edge);
+
+      if (!id || !has_weight(device, *id))
+        {
+          if (Parent_Type::check_edge(edge))
+            {
+              throw std::runtime_error("MWGraph::get_weight : the edge " + Utilities::custom_to_string(edge) +
+                                       " was not associated with any weight of device " +
+                                       Utilities::custom_to_string(device));
+            }
+          else
+            {
+              throw std::runtime_error("MWGraph::get_weight : the edge " + Utilities::custom_to_string(edge) +
+                                       " does not exist");
+            }
+        }
+
+      if constexpr (Parallel_Edges)
+        {
+          return weigth_map[device][*id];
+        }
+      else
+        {
+          return Edge_Weight_View_Type(&weigth_map[device][*id], 1);
+        }
+    }
+
+    /// It stores the weight of the given edge. The weights of parallel edges are kept sorted in ascending order, so
+    /// that the first one is always the smallest one. Only the storage of the given edge is modified (and, without
+    /// parallel edges, its bit is set atomically), thus the weights of different edges can be set concurrently
+    /// \param device The device id
+    /// \param edge The edge
+    /// \param weight The weight
+    void
+    insert_weight(std::size_t device, Edge_Type const &edge, Weight_Type const &weight)
+    {
+      auto const id = find_edge_id(edge);
+
+      if (!id)
+        {
+          throw std::runtime_error("MWGraph::set_weight : the edge " + Utilities::custom_to_string(edge) +
+                                   " was added after the construction of the graph");
+        }
+
+      if constexpr (Parallel_Edges)
+        {
+          auto &weights = weigth_map[device][*id];
+          weights.insert(std::upper_bound(weights.cbegin(), weights.cend(), weight), weight);
+        }
+      else
+        {
+          weigth_map[device][*id] = weight;
+          std::atomic_ref<std::uint64_t>(weight_bitmaps[device][*id / bitmap_word_size])
+            .fetch_or(std::uint64_t{1} << (*id % bitmap_word_size), std::memory_order_relaxed);
+        }
+    }
+
   public:
     /// It constructs (using perfect forwarding) a MWGraph
     /// \param num_maps The number of weight collections to store
@@ -330,10 +687,7 @@ namespace network_butcher::types
         }
 
       weigth_map.resize(num_maps);
-      for (auto &map : weigth_map)
-        {
-          map.resize(Parent_Type::size());
-        }
+      index_edges();
     }
 
     /// It constructs (using perfect forwarding) a MWGraph. The neighbours of each node are computed using the
@@ -349,11 +703,9 @@ namespace network_butcher::types
         {
           throw std::runtime_error("MWGraph: the number of maps must be greater than 0");
         }
+
       weigth_map.resize(num_maps);
-      for (auto &map : weigth_map)
-        {
-          map.resize(Parent_Type::size());
-        }
+      index_edges();
     }
 
     /// Copy constructor
@@ -382,7 +734,9 @@ namespace network_butcher::types
     [[nodiscard]] auto
     check_weight(std::size_t device, Edge_Type const &edge) const -> bool
     {
-      return weigth_map[device][edge.first].contains(edge.second);
+      auto const id = find_edge_id(edge);
+
+      return id && has_weight(device, *id);
     }
 
 
@@ -393,47 +747,43 @@ namespace network_butcher::types
     [[nodiscard]] auto
     get_weight(std::size_t device, Edge_Type const &edge) const -> Edge_Weight_Type
     {
-      if (device >= weigth_map.size())
-        {
-          throw std::runtime_error("MWGraph::get_weight : the device " + Utilities::custom_to_string(device) +
-                                   " does not exist");
-        }
-
-      auto const &map = weigth_map[device][edge.first];
-      auto        it  = map.find(edge.second);
-
-      Edge_Weight_Type res;
-      if (it == map.cend())
-        {
-          if (Parent_Type::check_edge(edge))
-            {
-              throw std::runtime_error("MWGraph::get_weight : the edge " + Utilities::custom_to_string(edge) +
-                                       " was not associated with any weight of device " +
-                                       Utilities::custom_to_string(device));
-            }
-          else
-            {
-              throw std::runtime_error("MWGraph::get_weight : the edge " + Utilities::custom_to_string(edge) +
-                                       " does not exist");
-            }
-        }
+      auto const weights = find_weights(device, edge);
 
       if constexpr (Parallel_Edges)
         {
-          for (; it != map.cend() && it->first == edge.second; ++it)
-            res.insert(it->second);
+          return Edge_Weight_Type(weights.begin(), weights.end());
         }
       else
         {
-          res = it->second;
+          return weights.front();
         }
+    }
+
 
-      return res;
+    /// Get a view of the weight(s) for the given edge on the given device, without copying them
+    /// \param device The device id
+    /// \param edge The edge
+    /// \return The weight(s), sorted in ascending order
+    [[nodiscard]] auto
+    get_weights(std::size_t device, Edge_Type const &edge) const -> Edge_Weight_View_Type
+    {
+      return find_weights(device, edge);
+    }
+
+
+    /// Get the smallest weight for the given edge on the given device
+    /// \param device The device id
+    /// \param edge The edge
+    /// \return The smallest weight
+    [[nodiscard]] auto
+    min_weight(std::size_t device, Edge_Type const &edge) const -> Weight_Type
+    {
+      return find_weights(device, edge).front();
     }
 
 
     /// Sets the weight for the given edge on the given device. If parallel edges are allowed, it will add it to the
-    /// collection of weights for the associated edge
+    /// collection of weights for the associated edge. The weights of different edges can be set concurrently
     /// \param device The device id
     /// \param edge The edge
     /// \param weight The weight
@@ -446,17 +796,9 @@ namespace network_butcher::types
                                    " does not exist");
         }
 
-      if constexpr (Parallel_Edges)
-        {
-          weigth_map[device][edge.first].emplace(edge.second, weight);
-        }
-      else
-        {
-          weigth_map[device][edge.first][edge.second] = weight;
-        }
+      insert_weight(device, edge, weight);
     }
 
-
     /// Adds to the chosen edge the collection of weights. They will be considered as the cost of the extra edges
     /// \param device The device id
     /// \param edge The edge
@@ -468,7 +810,7 @@ namespace network_butcher::types
       if (Parent_Type::check_edge(edge))
         {
           for (auto const &weight : weights)
-            weigth_map[device][edge.first].emplace(edge.second, weight);
+            insert_weight(device, edge, weight);
         }
       else
         {
@@ -487,6 +829,51 @@ namespace network_butcher::types
     }
 
 
+    /// Gets the number of edges (when the graph was built)
+    /// \return Number of edges
+    [[nodiscard]] auto
+    get_num_edges() const -> std::size_t
+    {
+      return edge_heads.size();
+    }
+
+
+    /// Gets the id of the given edge. The edges leaving a node have consecutive ids
+    /// \param edge The edge
+    /// \return The id of the edge
+    [[nodiscard]] auto
+    get_edge_id(Edge_Type const &edge) const -> std::size_t
+    {
+      auto const id = find_edge_id(edge);
+
+      if (!id)
+        {
+          throw std::runtime_error("MWGraph::get_edge_id : the edge " + Utilities::custom_to_string(edge) +
+                                   " does not exist");
+        }
+
+      return *id;
+    }
+
+
+    /// Gets the weights of all the edges on the given device, addressed by the edge id. The weights of the edges
+    /// without a weight are default constructed (see check_weight)
+    /// \param device The device id
+    /// \return The weights, stored contiguously
+    [[nodiscard]] auto
+    get_device_weights(std::size_t device) const -> std::span<Weight_Type const>
+      requires(!Parallel_Edges)
+    {
+      if (device >= weigth_map.size())
+        {
+          throw std::runtime_error("MWGraph::get_device_weights : the device " + Utilities::custom_to_string(device) +
+                                   " does not exist");
+        }
+
+      return weigth_map[device];
+    }
+
+
     /// Simple helper function that will print the graph
     /// \return The graph description
     [[nodiscard]] virtual auto
@@ -495,27 +882,23 @@ namespace network_butcher::types
       std::stringstream builder;
       builder << "In Out Weight_Map_Id Weight" << std::endl;
 
-      std::set<std::pair<Node_Id_Type, Node_Id_Type>> recorded_edges;
       for (auto const &node : Parent_Type::nodes)
         {
           for (auto const &out : Parent_Type::get_output_nodes(node.get_id()))
             {
-              recorded_edges.emplace_hint(recorded_edges.end(), std::make_pair(node.get_id(), out));
+              auto const  edge = std::make_pair(node.get_id(), out);
               std::string base_tmp =
                 Utilities::custom_to_string(node.get_id()) + " " + Utilities::custom_to_string(out) + " ";
               for (std::size_t i = 0; i < weigth_map.size(); ++i)
                 {
-                  auto const &map = weigth_map[i];
-
                   if constexpr (Parallel_Edges)
                     {
                       std::string new_base = base_tmp + Utilities::custom_to_string(i) + " ";
-                      auto        it       = map[node.get_id()].find(out);
-                      if (it != map.cend())
+                      if (check_weight(i, edge))
                         {
-                          for (; it != map[node.get_id()].cend() && it->first == out; ++it)
+                          for (auto const &weight : find_weights(i, edge))
                             {
-                              builder << new_base << Utilities::custom_to_string(it->second) << std::endl;
+                              builder << new_base << Utilities::custom_to_string(weight) << std::endl;
                             }
                         }
                       else
@@ -527,10 +910,9 @@ namespace network_butcher::types
                     {
                       builder << base_tmp << Utilities::custom_to_string(i) << " ";
 
-                      auto it = map[node.get_id()].find(out);
-                      if (it != map[node.get_id()].cend())
+                      if (check_weight(i, edge))
                         {
-                          builder << Utilities::custom_to_string(it->second);
+                          builder << Utilities::custom_to_string(find_weights(i, edge).front());
                         }
                       else
                         {
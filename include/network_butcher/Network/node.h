@@ -17,7 +17,9 @@ namespace network_butcher::types
     Node_Id_Type id;
 
   public:
-    /// Name of the node
+    /// Name of the node. Unlike the tensor names, it's not interned in the Symbol_Table: it's only read at the
+    /// boundaries of the program (e.g., to match the nodes with the onnx_tool report), never hashed or compared while
+    /// the graph is processed
     std::string name;
 
     /// Basic constructor
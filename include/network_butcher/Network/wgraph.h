@@ -31,6 +31,12 @@ namespace network_butcher::types
     /// (under the hood, it will just call this method with the num_device=0)
     using Parent_Type::get_weight;
 
+    /// Hidden for the same reason of get_weight
+    using Parent_Type::get_weights;
+
+    /// Hidden for the same reason of get_weight
+    using Parent_Type::min_weight;
+
     /// Hidden because it is not applicable
     using Parent_Type::print_graph;
 
@@ -55,6 +61,9 @@ namespace network_butcher::types
     /// Alias for the type of the container containing for each pair of nodes the associated weights
     using Edge_Weight_Type = Parent_Type::Edge_Weight_Type;
 
+    /// Alias for the type of the read-only view of the weights of a pair of nodes
+    using Edge_Weight_View_Type = Parent_Type::Edge_Weight_View_Type;
+
     /// (Perfect forwarding) constructor of WGraph
     /// \param v The nodes
     /// \param dep The neighbours
@@ -102,6 +111,26 @@ namespace network_butcher::types
     }
 
 
+    /// Get a view of the weight(s) for the given edge, without copying them
+    /// \param edge The edge
+    /// \return The weight(s), sorted in ascending order
+    [[nodiscard]] auto
+    get_weights(Edge_Type const &edge) const -> Edge_Weight_View_Type
+    {
+      return Parent_Type::get_weights(0, edge);
+    }
+
+
+    /// Get the smallest weight for the given edge
+    /// \param edge The edge
+    /// \return The smallest weight
+    [[nodiscard]] auto
+    min_weight(Edge_Type const &edge) const -> Weight_Type
+    {
+      return Parent_Type::min_weight(0, edge);
+    }
+
+
     /// Sets the weight for the given edge. If parallel edges are allowed, it will add it to the
     /// collection of weights for the associated edge
     /// \param edge The edge
@@ -191,6 +220,12 @@ namespace network_butcher::types
     /// (under the hood, it will just call this method with the num_device=0)
     using Parent_Type::get_weight;
 
+    /// Hidden for the same reason of get_weight
+    using Parent_Type::get_weights;
+
+    /// Hidden for the same reason of get_weight
+    using Parent_Type::min_weight;
+
     /// Hidden because it is not applicable
     using Parent_Type::print_graph;
 
@@ -215,6 +250,9 @@ namespace network_butcher::types
     /// Alias for the type of the container containing for each pair of nodes the associated weights
     using Edge_Weight_Type = Parent_Type::Edge_Weight_Type;
 
+    /// Alias for the type of the read-only view of the weights of a pair of nodes
+    using Edge_Weight_View_Type = Parent_Type::Edge_Weight_View_Type;
+
     /// (Perfect forwarding) constructor of WGraph
     /// \param v The nodes
     /// \param dep The neighbours
@@ -276,6 +314,26 @@ namespace network_butcher::types
     }
 
 
+    /// Get a view of the weight(s) for the given edge, without copying them
+    /// \param edge The edge
+    /// \return The weight(s), sorted in ascending order
+    [[nodiscard]] auto
+    get_weights(Edge_Type const &edge) const -> Edge_Weight_View_Type
+    {
+      return Parent_Type::get_weights(0, edge);
+    }
+
+
+    /// Get the smallest weight for the given edge
+    /// \param edge The edge
+    /// \return The smallest weight
+    [[nodiscard]] auto
+    min_weight(Edge_Type const &edge) const -> Weight_Type
+    {
+      return Parent_Type::min_weight(0, edge);
+    }
+
+
     /// Sets the weight for the given edge. If parallel edges are allowed, it will add it to the
     /// collection of weights for the associated edge
     /// \param edge The edge
@@ -345,20 +403,24 @@ namespace network_butcher::kfinder
 {
   /// (Partial) Specialization of Weighted_Graph
   /// \tparam T The internal type of WGraph
-  template <bool Parallel_Edges, typename t_Node_Type, bool t_Reversed>
-  class Weighted_Graph<network_butcher::types::WGraph<Parallel_Edges, t_Node_Type>,
-                       t_Reversed,
-                       typename network_butcher::types::WGraph<Parallel_Edges, t_Node_Type>::Node_Type,
-                       typename network_butcher::types::WGraph<Parallel_Edges, t_Node_Type>::Node_Collection_Type,
-                       Time_Type> : Base_Weighted_Graph
+  /// \tparam t_Weight_Type The weight type of WGraph (e.g., Time_Type or a fixed-point integer type)
+  template <bool Parallel_Edges, typename t_Node_Type, bool t_Reversed, typename t_Weight_Type>
+  class Weighted_Graph<
+    network_butcher::types::WGraph<Parallel_Edges, t_Node_Type, t_Weight_Type>,
+    t_Reversed,
+    typename network_butcher::types::WGraph<Parallel_Edges, t_Node_Type, t_Weight_Type>::Node_Type,
+    typename network_butcher::types::WGraph<Parallel_Edges, t_Node_Type, t_Weight_Type>::Node_Collection_Type,
+    t_Weight_Type> : Base_Weighted_Graph
   {
   public:
-    using Weight_Type = Time_Type;
+    using Weight_Type = t_Weight_Type;
 
     using Edge_Type = std::pair<Node_Id_Type, Node_Id_Type>;
 
-    using Graph_Type       = network_butcher::types::WGraph<Parallel_Edges, t_Node_Type>;
-    using Weight_Edge_Type = std::multiset<Weight_Type>;
+    using Graph_Type = network_butcher::types::WGraph<Parallel_Edges, t_Node_Type, t_Weight_Type>;
+
+    /// The weights of an edge are a view of the ones stored in the graph (sorted in ascending order)
+    using Weight_Edge_Type = typename Graph_Type::Edge_Weight_View_Type;
 
     using Node_Type            = t_Node_Type;
     using Node_Collection_Type = std::vector<Node_Type>;
@@ -367,21 +429,26 @@ namespace network_butcher::kfinder
     [[nodiscard]] auto
     get_weight(Edge_Type const &edge) const -> Weight_Edge_Type
     {
-      if constexpr (t_Reversed && Parallel_Edges)
+      if constexpr (t_Reversed)
         {
-          return graph.get_weight(std::make_pair(edge.second, edge.first));
+          return graph.get_weights(std::make_pair(edge.second, edge.first));
         }
-      else if constexpr (t_Reversed)
+      else
         {
-          return {graph.get_weight(std::make_pair(edge.second, edge.first))};
+          return graph.get_weights(edge);
         }
-      else if constexpr (Parallel_Edges)
+    }
+
+    [[nodiscard]] auto
+    min_weight(Edge_Type const &edge) const -> Weight_Type
+    {
+      if constexpr (t_Reversed)
         {
-          return graph.get_weight(edge);
+          return graph.min_weight(std::make_pair(edge.second, edge.first));
         }
       else
         {
-          return {graph.get_weight(edge)};
+          return graph.min_weight(edge);
         }
     }
 
@@ -398,7 +465,7 @@ namespace network_butcher::kfinder
     };
 
     [[nodiscard]] auto
-    get_output_nodes(Node_Id_Type const &id) const -> std::set<Node_Id_Type> const &
+    get_output_nodes(Node_Id_Type const &id) const -> Neighbour_Id_Collection_Type const &
     {
       if constexpr (t_Reversed)
         {
@@ -449,127 +516,6 @@ namespace network_butcher::kfinder
     }
 
 
-    explicit Weighted_Graph(Graph_Type const &g)
-      : Base_Weighted_Graph()
-      , graph(g)
-    {}
-
-    ~Weighted_Graph() override = default;
-
-  private:
-    Graph_Type const &graph;
-  };
-
-
-  /// Specialization of the weighted graph for WGraph with simple Node
-  /// \tparam Parallel_Edges Whether the graph has parallel edges or not
-  /// \tparam Reversed Whether the graph is reversed or not
-  template <bool Parallel_Edges, bool Reversed>
-  class Weighted_Graph<
-    network_butcher::types::WGraph<Parallel_Edges, network_butcher::types::Node, unsigned long long int>,
-    Reversed,
-    network_butcher::types::Node,
-    std::vector<network_butcher::types::Node>,
-    unsigned long long int> : Base_Weighted_Graph
-  {
-  public:
-    using Weight_Type = unsigned long long int;
-
-    using Edge_Type = std::pair<Node_Id_Type, Node_Id_Type>;
-
-    using Graph_Type =
-      network_butcher::types::WGraph<Parallel_Edges, network_butcher::types::Node, unsigned long long int>;
-    using Weight_Edge_Type = std::multiset<Weight_Type>;
-
-    using Node_Type            = typename Graph_Type::Node_Type;
-    using Node_Collection_Type = std::vector<Node_Type>;
-
-
-    [[nodiscard]] auto
-    get_weight(Edge_Type const &edge) const -> Weight_Edge_Type
-    {
-      if constexpr (Reversed && Parallel_Edges)
-        {
-          return graph.get_weight(std::make_pair(edge.second, edge.first));
-        }
-      else if constexpr (Reversed)
-        {
-          return {graph.get_weight(std::make_pair(edge.second, edge.first))};
-        }
-      else if constexpr (Parallel_Edges)
-        {
-          return graph.get_weight(edge);
-        }
-      else
-        {
-          return {graph.get_weight(edge)};
-        }
-    }
-
-    [[nodiscard]] auto
-    size() const -> std::size_t
-    {
-      return graph.size();
-    };
-
-    [[nodiscard]] auto
-    empty() const -> bool
-    {
-      return graph.empty();
-    };
-
-    [[nodiscard]] auto
-    get_output_nodes(Node_Id_Type const &id) const -> std::set<Node_Id_Type> const &
-    {
-      if constexpr (Reversed)
-        {
-          return graph.get_input_nodes(id);
-        }
-      else
-        {
-          return graph.get_output_nodes(id);
-        }
-    };
-
-
-    auto
-    operator[](Node_Id_Type const &id) const -> Node_Type const &
-    {
-      return graph[id];
-    };
-
-    [[nodiscard]] auto
-    cbegin() const
-    {
-      return graph.cbegin();
-    }
-
-    [[nodiscard]] auto
-    cend() const
-    {
-      return graph.cend();
-    }
-
-    [[nodiscard]] auto
-    begin() const
-    {
-      return cbegin();
-    }
-
-    [[nodiscard]] auto
-    end() const
-    {
-      return cend();
-    }
-
-
-    auto
-    reverse() const -> Weighted_Graph<Graph_Type, !Reversed, Node_Type, Node_Collection_Type, Weight_Type>
-    {
-      return Weighted_Graph<Graph_Type, !Reversed, Node_Type, Node_Collection_Type, Weight_Type>(graph);
-    }
-
-
     explicit Weighted_Graph(Graph_Type const &g)
       : Base_Weighted_Graph()
       , graph(g)
@@ -1,13 +1,26 @@
 #ifndef NETWORK_BUTCHER_STARTING_TRAITS_H
 #define NETWORK_BUTCHER_STARTING_TRAITS_H
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 namespace network_butcher
 {
   /// Type used to store the length in byte of a tensor
   using Memory_Type = unsigned long long;
 
+#if NETWORK_BUTCHER_FIXED_POINT_WEIGHTS
+  /// Basic weight type (fixed-point, nanoseconds, ns)
+  using Time_Type   = std::int64_t;
+#else
   /// Basic weight type (seconds, s)
   using Time_Type   = long double;
+#endif
+
+  /// Type used to represent a time outside the graphs, e.g., the values read from the weight files and the costs of
+  /// the final partitionings (seconds, s)
+  using Seconds_Type = long double;
 
   /// Bandwidth speed value type (megabit per second, MBit/s)
   using Bandwidth_Value_Type    = double;
@@ -17,6 +30,47 @@ namespace network_butcher
 
   /// The id of a node in a graph. Used also to represent device ids
   using Node_Id_Type = long unsigned int;
+
+#if NETWORK_BUTCHER_FIXED_POINT_WEIGHTS
+  /// The largest (absolute) weight produced by to_time_type (about 39 hours). The weights are summed along the paths
+  /// without any check: the headroom allows the sum of 2^16 saturated weights without overflowing. Moreover, the
+  /// maximum value of Time_Type is still reserved to the unreachable nodes
+  inline constexpr Time_Type max_time_weight = std::numeric_limits<Time_Type>::max() >> 16;
+#endif
+
+  /// It converts a time in seconds to a weight. With fixed-point weights, the time is rounded to the closest
+  /// nanosecond (and saturated to max_time_weight, e.g., the infinite time of a null bandwidth)
+  /// \param seconds The time in seconds
+  /// \return The weight
+  inline auto
+  to_time_type(Seconds_Type seconds) -> Time_Type
+  {
+#if NETWORK_BUTCHER_FIXED_POINT_WEIGHTS
+    auto const nanoseconds = std::round(seconds * static_cast<Seconds_Type>(1e9));
+
+    if (nanoseconds >= static_cast<Seconds_Type>(max_time_weight))
+      return max_time_weight;
+    if (nanoseconds <= static_cast<Seconds_Type>(-max_time_weight))
+      return -max_time_weight;
+
+    return static_cast<Time_Type>(nanoseconds);
+#else
+    return seconds;
+#endif
+  }
+
+  /// It converts a weight to a time in seconds
+  /// \param weight The weight
+  /// \return The time in seconds
+  inline auto
+  to_seconds(Time_Type weight) -> Seconds_Type
+  {
+#if NETWORK_BUTCHER_FIXED_POINT_WEIGHTS
+    return static_cast<Seconds_Type>(weight) / static_cast<Seconds_Type>(1e9);
+#else
+    return weight;
+#endif
+  }
 } // namespace network_butcher
 
 #endif // NETWORK_BUTCHER_STARTING_TRAITS_H
@@ -6,6 +6,9 @@
 #include <memory>
 
 #include <network_butcher/Traits/starting_traits.h>
+#include <network_butcher/Types/flat_set.h>
+#include <network_butcher/Types/io_collection.h>
+#include <network_butcher/Types/symbol_table.h>
 #include <network_butcher/Types/type_info.h>
 
 #include <network_butcher/onnx_proto/onnx.pb.h>
@@ -23,15 +26,22 @@ namespace network_butcher
   /// Collection of node ids
   using Node_Id_Collection_Type = std::set<Node_Id_Type>;
 
+  /// Collection of the (input or output) neighbours of a node of a graph. It's a sorted vector, since most of the nodes
+  /// have one or two neighbours
+  using Neighbour_Id_Collection_Type = types::Flat_Set<Node_Id_Type>;
+
   /// Edge in a graph. Simple pair of node ids
   using Edge_Type               = std::pair<Node_Id_Type, Node_Id_Type>;
 
   /// Shared pointer to a Type_info
   using Type_Info_Pointer = std::shared_ptr<network_butcher::types::Type_Info const>;
 
-  /// Simple map that stores objects of type T indexed by a string
+  /// Dense id of an interned tensor name (or operation id)
+  using Symbol_Id_Type = types::Symbol_Table::Symbol_Id_Type;
+
+  /// Collection that stores objects of type T indexed by a name (interned in the global symbol table)
   template <class T = Type_Info_Pointer>
-  using Io_Collection_Type = std::map<std::string, T>;
+  using Io_Collection_Type = types::Io_Collection<T>;
 
   /// Simple alias for google::protobuf::RepeatedPtrField<T>
   template <typename T>
@@ -33,6 +33,20 @@ namespace network_butcher::types
                  bool                                 constant = false);
 
 
+    /// Construct the tensor from its name, the memory usage of its element type and its shape (e.g., when it is read
+    /// back from a snapshot of the graph)
+    /// \param in_name Name of the tensor
+    /// \param in_type_tensor_memory Memory usage of the element type of the tensor
+    /// \param in_shape Shape of the tensor
+    /// \param given Is it already initialized?
+    /// \param constant Is it constant?
+    Dense_tensor(std::string const                   &in_name,
+                 Memory_Type                          in_type_tensor_memory,
+                 std::vector<Onnx_Element_Shape_Type> in_shape,
+                 bool                                 given    = false,
+                 bool                                 constant = false);
+
+
     /// Construct the tensor from a onnx::ValueInfoProto object
     /// \param info onnx::ValueInfoProto object
     /// \param given Is it already initialized?
@@ -77,6 +91,15 @@ namespace network_butcher::types
     compute_shape_volume() const -> Onnx_Element_Shape_Type override;
 
 
+    /// Basic getter for the memory usage of the element type
+    /// \return The memory usage of a single element of the tensor
+    [[nodiscard]] inline auto
+    get_type_tensor_memory() const -> Memory_Type
+    {
+      return type_tensor_memory;
+    }
+
+
     /// Basic getter for shape
     /// \return The shape
     [[nodiscard]] inline auto
@@ -0,0 +1,352 @@
+#ifndef NETWORK_BUTCHER_FLAT_SET_H
+#define NETWORK_BUTCHER_FLAT_SET_H
+
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace network_butcher::types
+{
+  /// A set stored as a sorted vector (without duplicates). It exposes the same interface of std::set that is used by
+  /// the graphs, but its elements are stored contiguously: a node of a graph usually has one or two neighbours, thus a
+  /// small sorted vector takes a fraction of the memory of a red-black tree, it's visited without chasing pointers and
+  /// the lookups are binary searches. The insertions (and the removals) are linear in the size of the set, unless the
+  /// inserted elements are appended in ascending order (e.g., with end() as hint).
+  /// \tparam T The type of the elements
+  /// \tparam Compare The comparison function
+  template <typename T, typename Compare = std::less<T>>
+  class Flat_Set
+  {
+  private:
+    /// The type of the underlying storage
+    using Storage_Type = std::vector<T>;
+
+    /// The (sorted) elements
+    Storage_Type elements;
+
+    /// The comparison function
+    [[no_unique_address]] Compare compare{};
+
+    /// Checks if two elements are equivalent
+    /// \param lhs The first element
+    /// \param rhs The second element
+    /// \return True if they're equivalent
+    [[nodiscard]] auto
+    equivalent(T const &lhs, T const &rhs) const -> bool
+    {
+      return !compare(lhs, rhs) && !compare(rhs, lhs);
+    }
+
+    /// Sorts the elements from the given position (that were appended in any order) and merges them with the
+    /// previous ones, removing the duplicates
+    /// \param first The position of the first appended element
+    void
+    merge_appended(std::size_t first)
+    {
+      auto const middle = elements.begin() + static_cast<typename Storage_Type::difference_type>(first);
+
+      std::sort(middle, elements.end(), compare);
+      std::inplace_merge(elements.begin(), middle, elements.end(), compare);
+
+      elements.erase(std::unique(elements.begin(),
+                                 elements.end(),
+                                 [this](T const &lhs, T const &rhs) { return equivalent(lhs, rhs); }),
+                     elements.end());
+    }
+
+  public:
+    using key_type               = T;
+    using value_type             = T;
+    using size_type              = typename Storage_Type::size_type;
+    using difference_type        = typename Storage_Type::difference_type;
+    using key_compare            = Compare;
+    using value_compare          = Compare;
+    using reference              = value_type const &;
+    using const_reference        = value_type const &;
+    using iterator               = typename Storage_Type::const_iterator;
+    using const_iterator         = typename Storage_Type::const_iterator;
+    using reverse_iterator       = typename Storage_Type::const_reverse_iterator;
+    using const_reverse_iterator = typename Storage_Type::const_reverse_iterator;
+
+    /// Default constructor. Empty set!
+    Flat_Set() = default;
+
+    /// Constructs the set from the elements in the given range
+    /// \param first The begin of the range
+    /// \param last The end of the range
+    template <std::input_iterator Input_Iterator>
+    Flat_Set(Input_Iterator first, Input_Iterator last)
+    {
+      insert(first, last);
+    }
+
+    /// Constructs the set from the given elements
+    /// \param list The elements
+    Flat_Set(std::initializer_list<value_type> list)
+      : Flat_Set(list.begin(), list.end())
+    {}
+
+
+    /// Inserts an element
+    /// \param value The element
+    /// \return The position of the element and true if it was inserted (false if it was already in the set)
+    auto
+    insert(value_type const &value) -> std::pair<iterator, bool>
+    {
+      auto it = std::lower_bound(elements.begin(), elements.end(), value, compare);
+
+      if (it != elements.end() && !compare(value, *it))
+        {
+          return {it, false};
+        }
+
+      return {elements.insert(it, value), true};
+    }
+
+    /// Inserts an element. If the element belongs right before the hint, the insertion doesn't require any search
+    /// (appending an element greater than all the others with end() as hint is O(1))
+    /// \param hint The suggested position
+    /// \param value The element
+    /// \return The position of the element
+    auto
+    insert(const_iterator hint, value_type const &value) -> iterator
+    {
+      auto const after_previous = hint == elements.cbegin() || compare(*std::prev(hint), value);
+      auto const before_hint    = hint == elements.cend() || compare(value, *hint);
+
+      if (after_previous && before_hint)
+        {
+          return elements.insert(hint, value);
+        }
+
+      return insert(value).first;
+    }
+
+    /// Inserts the elements in the given range
+    /// \param first The begin of the range
+    /// \param last The end of the range
+    template <std::input_iterator Input_Iterator>
+    void
+    insert(Input_Iterator first, Input_Iterator last)
+    {
+      auto const old_size = elements.size();
+
+      elements.insert(elements.end(), first, last);
+      merge_appended(old_size);
+    }
+
+    /// Inserts the given elements
+    /// \param list The elements
+    void
+    insert(std::initializer_list<value_type> list)
+    {
+      insert(list.begin(), list.end());
+    }
+
+
+    /// Removes an element
+    /// \param value The element
+    /// \return The number of removed elements (zero or one)
+    auto
+    erase(key_type const &value) -> size_type
+    {
+      auto const it = find(value);
+
+      if (it == elements.cend())
+        {
+          return 0;
+        }
+
+      elements.erase(it);
+      return 1;
+    }
+
+    /// Removes the element at the given position
+    /// \param position The position
+    /// \return The position following the removed element
+    auto
+    erase(const_iterator position) -> iterator
+    {
+      return elements.erase(position);
+    }
+
+
+    /// Finds the first element not less than the given one
+    /// \param value The element
+    /// \return The position
+    [[nodiscard]] auto
+    lower_bound(key_type const &value) const -> const_iterator
+    {
+      return std::lower_bound(elements.cbegin(), elements.cend(), value, compare);
+    }
+
+    /// Finds an element (binary search)
+    /// \param value The element
+    /// \return The position of the element (end() if it's not in the set)
+    [[nodiscard]] auto
+    find(key_type const &value) const -> const_iterator
+    {
+      auto const it = lower_bound(value);
+
+      return it != elements.cend() && !compare(value, *it) ? it : elements.cend();
+    }
+
+    /// Checks if an element is in the set (binary search)
+    /// \param value The element
+    /// \return True if the element is in the set
+    [[nodiscard]] auto
+    contains(key_type const &value) const -> bool
+    {
+      return find(value) != elements.cend();
+    }
+
+    /// Counts the occurrences of an element (binary search)
+    /// \param value The element
+    /// \return One if the element is in the set, zero otherwise
+    [[nodiscard]] auto
+    count(key_type const &value) const -> size_type
+    {
+      return contains(value) ? 1 : 0;
+    }
+
+
+    /// Reserves the storage for the given number of elements
+    /// \param new_capacity The number of elements
+    void
+    reserve(size_type new_capacity)
+    {
+      elements.reserve(new_capacity);
+    }
+
+    /// Releases the unused storage
+    void
+    shrink_to_fit()
+    {
+      elements.shrink_to_fit();
+    }
+
+    /// Removes all the elements
+    void
+    clear() noexcept
+    {
+      elements.clear();
+    }
+
+
+    /// Get the number of elements
+    /// \return The number of elements
+    [[nodiscard]] auto
+    size() const noexcept -> size_type
+    {
+      return elements.size();
+    }
+
+    /// Checks if the set is empty
+    /// \return True if there are no elements
+    [[nodiscard]] auto
+    empty() const noexcept -> bool
+    {
+      return elements.empty();
+    }
+
+    /// Get the elements as a contiguous (sorted) array
+    /// \return The pointer to the first element
+    [[nodiscard]] auto
+    data() const noexcept -> value_type const *
+    {
+      return elements.data();
+    }
+
+
+    /// Get the begin iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    begin() const noexcept -> const_iterator
+    {
+      return elements.cbegin();
+    }
+
+    /// Get the end iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    end() const noexcept -> const_iterator
+    {
+      return elements.cend();
+    }
+
+    /// Get the begin iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    cbegin() const noexcept -> const_iterator
+    {
+      return elements.cbegin();
+    }
+
+    /// Get the end iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    cend() const noexcept -> const_iterator
+    {
+      return elements.cend();
+    }
+
+    /// Get the reverse begin iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    rbegin() const noexcept -> const_reverse_iterator
+    {
+      return elements.crbegin();
+    }
+
+    /// Get the reverse end iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    rend() const noexcept -> const_reverse_iterator
+    {
+      return elements.crend();
+    }
+
+    /// Get the reverse begin iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    crbegin() const noexcept -> const_reverse_iterator
+    {
+      return elements.crbegin();
+    }
+
+    /// Get the reverse end iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    crend() const noexcept -> const_reverse_iterator
+    {
+      return elements.crend();
+    }
+
+
+    /// Checks if two sets contain the same elements
+    /// \param lhs The first set
+    /// \param rhs The second set
+    /// \return True if they contain the same elements
+    friend auto
+    operator==(Flat_Set const &lhs, Flat_Set const &rhs) -> bool
+    {
+      return lhs.elements == rhs.elements;
+    }
+
+    /// Compares two sets lexicographically
+    /// \param lhs The first set
+    /// \param rhs The second set
+    /// \return The result of the comparison
+    friend auto
+    operator<=>(Flat_Set const &lhs, Flat_Set const &rhs)
+    {
+      return lhs.elements <=> rhs.elements;
+    }
+  };
+} // namespace network_butcher::types
+
+#endif // NETWORK_BUTCHER_FLAT_SET_H
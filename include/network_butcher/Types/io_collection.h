@@ -0,0 +1,203 @@
+#ifndef NETWORK_BUTCHER_IO_COLLECTION_H
+#define NETWORK_BUTCHER_IO_COLLECTION_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <network_butcher/Types/symbol_table.h>
+
+namespace network_butcher::types
+{
+  /// A collection of objects (e.g., the input, output or parameter tensors of a node) indexed by their name. The names
+  /// are interned in the global Symbol_Table: the collection stores the (32-bit) ids of the names, sorted in ascending
+  /// order, together with the objects in a contiguous vector.
+  /// \tparam T The type of the objects
+  template <typename T>
+  class Io_Collection
+  {
+  public:
+    /// Type of the id of a name
+    using Symbol_Id_Type = Symbol_Table::Symbol_Id_Type;
+
+    /// Type of an element of the collection: the id of the name and the object
+    using value_type = std::pair<Symbol_Id_Type, T>;
+
+    using size_type      = std::size_t;
+    using iterator       = typename std::vector<value_type>::const_iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+  private:
+    /// The elements, sorted by id
+    std::vector<value_type> elements;
+
+    /// Finds the first element whose id is not less than the given one
+    /// \param id The id
+    /// \return The position
+    [[nodiscard]] auto
+    lower_bound(Symbol_Id_Type id) const -> const_iterator
+    {
+      return std::lower_bound(elements.cbegin(), elements.cend(), id, [](value_type const &el, Symbol_Id_Type key) {
+        return el.first < key;
+      });
+    }
+
+  public:
+    /// Default constructor. Empty collection!
+    Io_Collection() = default;
+
+    /// Constructs the collection from the given (name, object) pairs. If a name is repeated, only the first object is
+    /// stored
+    /// \param list The pairs
+    Io_Collection(std::initializer_list<std::pair<std::string_view, T>> list)
+    {
+      elements.reserve(list.size());
+
+      for (auto const &[name, value] : list)
+        emplace(name, value);
+    }
+
+
+    /// Get the name associated to the given id
+    /// \param id The id
+    /// \return The name
+    [[nodiscard]] static auto
+    get_name(Symbol_Id_Type id) -> std::string const &
+    {
+      return Symbol_Table::global().get_name(id);
+    }
+
+
+    /// Inserts an object, if its id isn't already in the collection
+    /// \param id The id of the name of the object
+    /// \param value The object
+    /// \return The position of the element with the given id and true if the object was inserted
+    auto
+    emplace(Symbol_Id_Type id, T value) -> std::pair<iterator, bool>
+    {
+      auto const it = lower_bound(id);
+
+      if (it != elements.cend() && it->first == id)
+        {
+          return {it, false};
+        }
+
+      return {elements.emplace(it, id, std::move(value)), true};
+    }
+
+    /// Inserts an object, if its name isn't already in the collection
+    /// \param name The name of the object
+    /// \param value The object
+    /// \return The position of the element with the given name and true if the object was inserted
+    auto
+    emplace(std::string_view name, T value) -> std::pair<iterator, bool>
+    {
+      return emplace(Symbol_Table::global().intern(name), std::move(value));
+    }
+
+    /// Inserts an object, if its name isn't already in the collection
+    /// \param element The name and the object
+    /// \return The position of the element with the given name and true if the object was inserted
+    auto
+    insert(std::pair<std::string_view, T> element) -> std::pair<iterator, bool>
+    {
+      return emplace(element.first, std::move(element.second));
+    }
+
+
+    /// Finds the object with the given id (binary search)
+    /// \param id The id
+    /// \return The position of the element (end() if it's not in the collection)
+    [[nodiscard]] auto
+    find(Symbol_Id_Type id) const -> const_iterator
+    {
+      auto const it = lower_bound(id);
+
+      return it != elements.cend() && it->first == id ? it : elements.cend();
+    }
+
+    /// Finds the object with the given name
+    /// \param name The name
+    /// \return The position of the element (end() if it's not in the collection)
+    [[nodiscard]] auto
+    find(std::string_view name) const -> const_iterator
+    {
+      auto const id = Symbol_Table::global().find(name);
+
+      return id ? find(*id) : elements.cend();
+    }
+
+    /// Checks if the collection contains an object with the given id
+    /// \param id The id
+    /// \return True if it's in the collection
+    [[nodiscard]] auto
+    contains(Symbol_Id_Type id) const -> bool
+    {
+      return find(id) != elements.cend();
+    }
+
+    /// Checks if the collection contains an object with the given name
+    /// \param name The name
+    /// \return True if it's in the collection
+    [[nodiscard]] auto
+    contains(std::string_view name) const -> bool
+    {
+      return find(name) != elements.cend();
+    }
+
+
+    /// Get the number of objects
+    /// \return The number of objects
+    [[nodiscard]] auto
+    size() const noexcept -> size_type
+    {
+      return elements.size();
+    }
+
+    /// Checks if the collection is empty
+    /// \return True if there are no objects
+    [[nodiscard]] auto
+    empty() const noexcept -> bool
+    {
+      return elements.empty();
+    }
+
+
+    /// Get the begin iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    begin() const noexcept -> const_iterator
+    {
+      return elements.cbegin();
+    }
+
+    /// Get the end iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    end() const noexcept -> const_iterator
+    {
+      return elements.cend();
+    }
+
+    /// Get the begin iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    cbegin() const noexcept -> const_iterator
+    {
+      return elements.cbegin();
+    }
+
+    /// Get the end iterator
+    /// \return The iterator
+    [[nodiscard]] auto
+    cend() const noexcept -> const_iterator
+    {
+      return elements.cend();
+    }
+  };
+} // namespace network_butcher::types
+
+#endif // NETWORK_BUTCHER_IO_COLLECTION_H
@@ -0,0 +1,170 @@
+#ifndef NETWORK_BUTCHER_NODE_COLUMNS_H
+#define NETWORK_BUTCHER_NODE_COLUMNS_H
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <network_butcher/Traits/traits.h>
+
+namespace network_butcher::types
+{
+  /// Columnar (structure of arrays) store of the nodes of a graph. Every column is a contiguous array indexed by the
+  /// node id: the (interned) operation ids, the memory usage of the inputs, of the outputs and of the parameters of the
+  /// nodes and the offsets of their names in a single buffer. The passes that only need the ids and the sizes of the
+  /// nodes (e.g., the memory constraint or the transmission weights) read these arrays instead of visiting the nodes
+  /// with all their tensors and attributes. It's built alongside the nodes (see Computer_memory::compute_node_columns)
+  /// and it's not updated if the nodes are changed afterwards
+  class Node_Columns
+  {
+  private:
+    /// The id (in the global symbol table) of the operation of every node
+    std::vector<Symbol_Id_Type> operation_ids;
+
+    /// The memory usage of the inputs of every node
+    std::vector<Memory_Type> input_memory;
+
+    /// The memory usage of the outputs of every node
+    std::vector<Memory_Type> output_memory;
+
+    /// The memory usage of the parameters of every node
+    std::vector<Memory_Type> parameters_memory;
+
+    /// The name of the node i is names[name_offsets[i], name_offsets[i + 1])
+    std::vector<std::size_t> name_offsets{0};
+
+    /// The names of the nodes, one after the other
+    std::string names;
+
+  public:
+    /// Default constructor. No nodes!
+    Node_Columns() = default;
+
+    /// Constructs the columns of the given nodes, given their memory usages
+    /// \param nodes The nodes (they must expose the name and the operation id of their content)
+    /// \param in_input_memory The memory usage of the inputs of every node
+    /// \param in_output_memory The memory usage of the outputs of every node
+    /// \param in_parameters_memory The memory usage of the parameters of every node
+    template <typename Node_Collection>
+    Node_Columns(Node_Collection const   &nodes,
+                 std::vector<Memory_Type> in_input_memory,
+                 std::vector<Memory_Type> in_output_memory,
+                 std::vector<Memory_Type> in_parameters_memory)
+      : input_memory(std::move(in_input_memory))
+      , output_memory(std::move(in_output_memory))
+      , parameters_memory(std::move(in_parameters_memory))
+    {
+      if (input_memory.size() != nodes.size() || output_memory.size() != nodes.size() ||
+          parameters_memory.size() != nodes.size())
+        {
+          throw std::runtime_error("Node_Columns: the memory usages and the nodes must have the same size");
+        }
+
+      operation_ids.reserve(nodes.size());
+      name_offsets.reserve(nodes.size() + 1);
+
+      auto &symbols = Symbol_Table::global();
+      for (auto const &node : nodes)
+        {
+          operation_ids.push_back(symbols.intern(node.content.get_operation_id()));
+
+          names += node.name;
+          name_offsets.push_back(names.size());
+        }
+    }
+
+
+    /// Get the number of nodes
+    /// \return The number of nodes
+    [[nodiscard]] auto
+    size() const -> std::size_t
+    {
+      return operation_ids.size();
+    }
+
+
+    /// Get the id (in the global symbol table) of the operation of the given node
+    /// \param id The id of the node
+    /// \return The id of the operation
+    [[nodiscard]] auto
+    get_operation_id(Node_Id_Type id) const -> Symbol_Id_Type
+    {
+      return operation_ids[id];
+    }
+
+    /// Get the name of the operation of the given node
+    /// \param id The id of the node
+    /// \return The name of the operation
+    [[nodiscard]] auto
+    get_operation_name(Node_Id_Type id) const -> std::string const &
+    {
+      return Symbol_Table::global().get_name(operation_ids[id]);
+    }
+
+    /// Get the name of the given node
+    /// \param id The id of the node
+    /// \return The name
+    [[nodiscard]] auto
+    get_name(Node_Id_Type id) const -> std::string_view
+    {
+      return std::string_view(names).substr(name_offsets[id], name_offsets[id + 1] - name_offsets[id]);
+    }
+
+
+    /// Get the memory usage of the inputs of every node
+    /// \return The memory usages, indexed by node id
+    [[nodiscard]] auto
+    get_input_memory() const -> std::span<Memory_Type const>
+    {
+      return input_memory;
+    }
+
+    /// Get the memory usage of the outputs of every node
+    /// \return The memory usages, indexed by node id
+    [[nodiscard]] auto
+    get_output_memory() const -> std::span<Memory_Type const>
+    {
+      return output_memory;
+    }
+
+    /// Get the memory usage of the parameters of every node
+    /// \return The memory usages, indexed by node id
+    [[nodiscard]] auto
+    get_parameters_memory() const -> std::span<Memory_Type const>
+    {
+      return parameters_memory;
+    }
+
+
+    /// Get the memory usage of the inputs of the given node
+    /// \param id The id of the node
+    /// \return The memory usage
+    [[nodiscard]] auto
+    get_input_memory(Node_Id_Type id) const -> Memory_Type
+    {
+      return input_memory[id];
+    }
+
+    /// Get the memory usage of the outputs of the given node
+    /// \param id The id of the node
+    /// \return The memory usage
+    [[nodiscard]] auto
+    get_output_memory(Node_Id_Type id) const -> Memory_Type
+    {
+      return output_memory[id];
+    }
+
+    /// Get the memory usage of the parameters of the given node
+    /// \param id The id of the node
+    /// \return The memory usage
+    [[nodiscard]] auto
+    get_parameters_memory(Node_Id_Type id) const -> Memory_Type
+    {
+      return parameters_memory[id];
+    }
+  };
+} // namespace network_butcher::types
+
+#endif // NETWORK_BUTCHER_NODE_COLUMNS_H
@@ -1,6 +1,8 @@
 #ifndef NETWORK_BUTCHER_PARAMETERS_H
 #define NETWORK_BUTCHER_PARAMETERS_H
 
+#include <optional>
+
 #include <network_butcher/Network/graph_traits.h>
 #include <network_butcher/K-shortest_path/ksp_method.h>
 
@@ -122,6 +124,10 @@ namespace network_butcher::parameters
 
       /// The config path
       std::string config_path;
+
+      /// The directory of the binary snapshots of the imported models (see Graph_Snapshot). If empty, the snapshots
+      /// are not used
+      std::string snapshot_directory;
     };
 
     /// Structure used to contain all the parameters related to the K shortest path method
@@ -132,6 +138,11 @@ namespace network_butcher::parameters
 
       /// The KSP method
       KSP_Method method;
+
+      /// The maximum relative gap between the length (i.e., the time) of a returned path and the length of the
+      /// shortest one, e.g., 0.05 to return only the partitionings within 5% of the optimum (at most K of them). If
+      /// it's not set, only K bounds the number of paths
+      std::optional<double> max_relative_gap;
     };
 
     /// Structure used to contain all the parameters related to the Block Graph Generation
@@ -143,6 +154,14 @@ namespace network_butcher::parameters
       /// End device
       std::size_t ending_device_id;
 
+      /// The candidate starting devices of Butcher::compute_k_shortest_path_multi_terminal. If it's empty, only
+      /// starting_device_id is considered
+      std::vector<std::size_t> starting_device_ids;
+
+      /// The candidate ending devices of Butcher::compute_k_shortest_path_multi_terminal. If it's empty, only
+      /// ending_device_id is considered
+      std::vector<std::size_t> ending_device_ids;
+
       /// Block Graph Generation mode for Butcher.
       Block_Graph_Generation_Mode block_graph_mode;
 
@@ -1,6 +1,7 @@
 #ifndef NETWORK_BUTCHER_PATHS_H
 #define NETWORK_BUTCHER_PATHS_H
 
+#include <map>
 #include <set>
 #include <vector>
 
@@ -15,8 +16,18 @@ namespace network_butcher::types
   /// An actual partitioning
   using Real_Path      = std::vector<Real_Partition>;
 
-  /// A partitioning with the time cost
-  using Weighted_Real_Path  = std::pair<Time_Type, Real_Path>;
+  /// A partitioning with the time cost (in seconds)
+  using Weighted_Real_Path  = std::pair<Seconds_Type, Real_Path>;
+
+  /// The partitionings found by a single search over several starting and ending devices
+  struct Multi_Terminal_Real_Paths
+  {
+    /// The best partitionings overall, in nondecreasing order of time
+    std::vector<Weighted_Real_Path> paths;
+
+    /// The best partitioning for every (starting device, ending device) pair connected by at least one partitioning
+    std::map<std::pair<std::size_t, std::size_t>, Weighted_Real_Path> best_per_pair;
+  };
 
   bool
   path_comparison(Weighted_Real_Path const &rhs, Weighted_Real_Path const &lhs);
@@ -0,0 +1,142 @@
+#ifndef NETWORK_BUTCHER_SYMBOL_TABLE_H
+#define NETWORK_BUTCHER_SYMBOL_TABLE_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace network_butcher::types
+{
+  /// A string interner: it associates to every tensor name (and operation id) a dense 32-bit id, so that the names are
+  /// stored once and they're compared and hashed as integers. The node names aren't interned. The ids are assigned in
+  /// order of first appearance and they're never released. It's thread-safe.
+  class Symbol_Table
+  {
+  public:
+    /// Type of the id of a name
+    using Symbol_Id_Type = std::uint32_t;
+
+  private:
+    /// Transparent hash, used to look up a std::string_view without constructing a std::string
+    struct Name_Hash
+    {
+      using is_transparent = void;
+
+      [[nodiscard]] auto
+      operator()(std::string_view name) const noexcept -> std::size_t
+      {
+        return std::hash<std::string_view>{}(name);
+      }
+    };
+
+    /// The names, addressed by their id. A deque never moves its elements, thus the references to the names (and the
+    /// views used as keys of ids) stay valid when new names are added
+    std::deque<std::string> names;
+
+    /// The id of every name
+    std::unordered_map<std::string_view, Symbol_Id_Type, Name_Hash, std::equal_to<>> ids;
+
+    /// Mutex guarding names and ids
+    mutable std::shared_mutex mutex;
+
+  public:
+    /// Default constructor. Empty table!
+    Symbol_Table() = default;
+
+    /// The table is referenced by the ids, thus it cannot be copied
+    Symbol_Table(Symbol_Table const &) = delete;
+
+    /// The table is referenced by the ids, thus it cannot be copied
+    auto
+    operator=(Symbol_Table const &) -> Symbol_Table & = delete;
+
+
+    /// Get the id of the given name, adding it to the table if it's not already there
+    /// \param name The name
+    /// \return The id of the name
+    auto
+    intern(std::string_view name) -> Symbol_Id_Type
+    {
+      if (auto const id = find(name))
+        {
+          return *id;
+        }
+
+      std::unique_lock lock(mutex);
+
+      // Another thread may have added it in the meantime
+      if (auto const it = ids.find(name); it != ids.cend())
+        {
+          return it->second;
+        }
+
+      auto const id = static_cast<Symbol_Id_Type>(names.size());
+      names.emplace_back(name);
+      ids.emplace(names.back(), id);
+
+      return id;
+    }
+
+    /// Get the id of the given name
+    /// \param name The name
+    /// \return The id of the name, if it's in the table
+    [[nodiscard]] auto
+    find(std::string_view name) const -> std::optional<Symbol_Id_Type>
+    {
+      std::shared_lock lock(mutex);
+
+      auto const it = ids.find(name);
+      if (it == ids.cend())
+        {
+          return std::nullopt;
+        }
+
+      return it->second;
+    }
+
+    /// Get the name associated to the given id
+    /// \param id The id
+    /// \return The name
+    [[nodiscard]] auto
+    get_name(Symbol_Id_Type id) const -> std::string const &
+    {
+      std::shared_lock lock(mutex);
+
+      if (id >= names.size())
+        {
+          throw std::out_of_range("Symbol_Table::get_name: the id " + std::to_string(id) + " does not exist");
+        }
+
+      return names[id];
+    }
+
+    /// Get the number of names in the table. The ids are in [0, size())
+    /// \return The number of names
+    [[nodiscard]] auto
+    size() const -> std::size_t
+    {
+      std::shared_lock lock(mutex);
+
+      return names.size();
+    }
+
+
+    /// The table shared by all the models (and used by the IO collections of the nodes)
+    /// \return The table
+    static auto
+    global() -> Symbol_Table &
+    {
+      static Symbol_Table table;
+      return table;
+    }
+  };
+} // namespace network_butcher::types
+
+#endif // NETWORK_BUTCHER_SYMBOL_TABLE_H
@@ -76,6 +76,15 @@ namespace network_butcher::types
     }
 
 
+    /// Get if the value of this type is constant
+    /// \return True if it is constant
+    [[nodiscard]] auto
+    is_constant() const -> bool
+    {
+      return constant;
+    }
+
+
     /// Virtual method to compute the total memory of the type
     /// \return Memory usage of the associated type
     [[nodiscard]] virtual auto
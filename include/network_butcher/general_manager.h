@@ -18,10 +18,12 @@ namespace network_butcher::io
       /// Based on the information related to the bandwidth between devices, it will produce the transmission function
       /// \param weights_params The collection of weight parameters
       /// \param graph The graph
+      /// \param columns The columnar store of the nodes of the graph (see compute_node_columns)
       /// \return  The transmission function
       auto
       generate_bandwidth_transmission_function(const network_butcher::parameters::Parameters::Weights &weights_params,
-                                               const Converted_Onnx_Graph_Type                        &graph)
+                                               const Converted_Onnx_Graph_Type                        &graph,
+                                               std::shared_ptr<types::Node_Columns const>              columns)
         -> std::function<Time_Type(const Edge_Type &, size_t, size_t)>;
 
 
@@ -3,6 +3,7 @@
 
 #include <ranges>
 
+#include <network_butcher/IO_Interaction/graph_snapshot.h>
 #include <network_butcher/IO_Interaction/onnx_importer_helpers.h>
 #include <network_butcher/IO_Interaction/onnx_model_reconstructor_helpers.h>
 
@@ -66,6 +67,27 @@ namespace network_butcher::io::IO_Manager
     -> std::tuple<Converted_Onnx_Graph_Type, onnx::ModelProto, std::map<Node_Id_Type, Node_Id_Type>>;
 
 
+  /// It will import an Onnx model as a graph, reading it from its binary snapshot in the given directory if the .onnx
+  /// file didn't change since the snapshot was stored. Otherwise, the .onnx file is imported and its snapshot is
+  /// stored. If the snapshot cannot be stored (e.g., the directory is not writable), the imported graph is returned
+  /// anyway. Notice that the onnx::ModelProto is not returned: it must be parsed when it's needed (e.g., for the
+  /// export)
+  /// \param path The file path of the .onnx file
+  /// \param snapshot_directory The directory containing the snapshots
+  /// \param add_input_padding  If true, a padding node will be added at the beginning of the network, so that
+  /// the resulting graph has a single input
+  /// \param add_output_padding If true, a padding nodes will be added at the at the end of the network, so that
+  /// the resulting graph has a single output
+  /// \param num_devices The number of devices
+  /// \return The graph and a map associating every node in the graph to every node in the model (through their ids)
+  auto
+  import_from_onnx_snapshot(std::string const &path,
+                            std::string const &snapshot_directory,
+                            bool               add_input_padding  = true,
+                            bool               add_output_padding = true,
+                            std::size_t        num_devices        = 1) -> Graph_Snapshot::Snapshot_Content_Type;
+
+
   /// It will export a given onnx::ModelProto to a file
   /// \param model The onnx::ModelProto
   /// \param path The export file path
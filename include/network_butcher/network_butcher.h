@@ -12,7 +12,9 @@
 #include <network_butcher/Butcher/butcher.h>
 #include <network_butcher/io_manager.h>
 #include <network_butcher/Computer/computer_memory.h>
+#include <network_butcher/K-shortest_path/csr_weighted_graph.h>
 #include <network_butcher/K-shortest_path/kfinder_factory.h>
+#include <network_butcher/K-shortest_path/scenario_weighted_graph.h>
 #include <network_butcher/utilities.h>
 
 #include <network_butcher/APSC/GetPot>
@@ -118,10 +118,10 @@ generate_parameters()
   res.block_graph_generation_params.use_bandwidth_to_manage_connections = true;
 
   g_type::Neighbours_Type deps(4);
-  deps[0] = std::make_pair(std::set<Node_Id_Type>{0}, std::set<Node_Id_Type>{0, 1, 3});
-  deps[1] = std::make_pair(std::set<Node_Id_Type>{0, 1, 2}, std::set<Node_Id_Type>{1, 2});
-  deps[2] = std::make_pair(std::set<Node_Id_Type>{1, 2}, std::set<Node_Id_Type>{1, 2, 3});
-  deps[3] = std::make_pair(std::set<Node_Id_Type>{0, 2, 3}, std::set<Node_Id_Type>{3});
+  deps[0] = std::make_pair(Neighbour_Id_Collection_Type{0}, Neighbour_Id_Collection_Type{0, 1, 3});
+  deps[1] = std::make_pair(Neighbour_Id_Collection_Type{0, 1, 2}, Neighbour_Id_Collection_Type{1, 2});
+  deps[2] = std::make_pair(Neighbour_Id_Collection_Type{1, 2}, Neighbour_Id_Collection_Type{1, 2, 3});
+  deps[3] = std::make_pair(Neighbour_Id_Collection_Type{0, 2, 3}, Neighbour_Id_Collection_Type{3});
 
   res.weights_params.bandwidth = std::make_unique<g_type>(g_type::Node_Collection_Type(4), std::move(deps));
 
@@ -186,7 +186,7 @@ main(int argc, char **argv)
   } /* All threads join master thread and disband */
 #endif
 
-  std::vector<std::tuple<std::string, Time_Type>> results;
+  std::vector<std::tuple<std::string, long double>> results;
   std::size_t                                     num_tests = command_line("num_tests", 10);
   std::size_t                                     max_power = command_line("max_power", 22);
 
@@ -200,7 +200,7 @@ main(int argc, char **argv)
   for (std::size_t power = 10; power <= max_power; ++power)
     {
       std::size_t nodes = simple_pow(2, power);
-      Time_Type   time  = 0.;
+      long double time  = 0.;
 
       auto params       = generate_parameters();
       auto graph        = basic_graph(nodes);
@@ -218,7 +218,7 @@ main(int argc, char **argv)
           builder.construct_block_graph();
           crono.stop();
 
-          Time_Type local_time = crono.wallTime();
+          long double local_time = crono.wallTime();
           time += local_time;
 
           std::cout << "Test #" << Utilities::custom_to_string(test_num + 1) << ": " << local_time / 1000. << " ms"
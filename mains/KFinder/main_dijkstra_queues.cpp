@@ -0,0 +1,182 @@
+#include <network_butcher/network_butcher.h>
+
+#include <fstream>
+
+
+
+/*
+ * This file compares the priority queue policies of the Dijkstra algorithm (std::set, pairing heap and radix heap) on
+ * the graphs used by main_kfinder. As in the K shortest path methods, the shortest path tree is computed on the
+ * reversed graph, starting from the sink.
+ * */
+
+
+
+using namespace network_butcher;
+using namespace types;
+using namespace network_butcher::kfinder;
+
+using Node_type           = types::Node;
+using Test_Weight_Type    = unsigned long long int;
+using Graph_type_Parallel = types::WGraph<true, Node_type, Test_Weight_Type>;
+
+template <bool Reversed>
+using Weighted_Graph_Parallel_type = Weighted_Graph<Graph_type_Parallel,
+                                                    Reversed,
+                                                    Graph_type_Parallel::Node_Type,
+                                                    Graph_type_Parallel::Node_Collection_Type,
+                                                    Test_Weight_Type>;
+
+
+std::tuple<Graph_type_Parallel, Node_Id_Type, Node_Id_Type, Node_Id_Type>
+import_graph(const std::string &file_path)
+{
+  std::size_t                N, M, s, t, k, u, v;
+  Test_Weight_Type           tmp_weight;
+
+  std::ifstream in_file(file_path);
+  in_file >> N >> M >> s >> t >> k;
+
+  std::vector<network_butcher::types::Node>    nodes(N);
+  Converted_Onnx_Graph_Type::Neighbours_Type   deps(N);
+  std::vector<std::pair<std::pair<network_butcher::Node_Id_Type, network_butcher::Node_Id_Type>, Test_Weight_Type>>
+    edges;
+  edges.reserve(M);
+
+  for (std::size_t i = 0; i < M; ++i)
+    {
+      in_file >> u >> v >> tmp_weight;
+      edges.push_back({{u, v}, tmp_weight});
+
+      deps[v].first.insert(u);
+      deps[u].second.insert(v);
+    }
+
+  Graph_type_Parallel graph(nodes, deps);
+  for (auto const &[edge, weight] : edges)
+    graph.set_weight(edge, weight);
+
+  return std::tie(graph, s, t, k);
+}
+
+// The initial files were generated by: https://github.com/yosupo06/library-checker-problems
+std::vector<std::string>
+get_test_names()
+{
+  return {"dense_00",
+          "dense_01",
+          "almost_path_00",
+          "almost_path_01",
+          "almost_path_02",
+          "example_00",
+          "loop_00",
+          "max_random_00",
+          "max_random_01",
+          "max_random_02",
+          "max_random_03",
+          "max_random_04",
+          "path_00",
+          "random_00",
+          "random_01",
+          "random_02",
+          "random_04",
+          "small_random_00",
+          "small_random_01",
+          "small_random_02",
+          "smallest_random_00",
+          "smallest_random_01",
+          "smallest_random_02",
+          "sparse_00",
+          "sparse_01"};
+}
+
+
+/// It executes Dijkstra num_tests times with the given queue policy
+/// \param graph The graph
+/// \param sink The sink
+/// \param num_tests The number of repetitions
+/// \param crono The chronometer
+/// \return The average time (in ms) and the computed distances
+template <typename Queue_Type>
+auto
+time_dijkstra(Weighted_Graph_Parallel_type<true> const &graph, Node_Id_Type sink, std::size_t num_tests, Chrono &crono)
+  -> std::pair<long double, std::vector<Test_Weight_Type>>
+{
+  long double                   total = 0.;
+  std::vector<Test_Weight_Type> distances;
+
+  for (std::size_t i = 0; i < num_tests; ++i)
+    {
+      crono.start();
+      auto res = Shortest_path_finder::dijkstra<Weighted_Graph_Parallel_type<true>, Queue_Type>(graph, sink);
+      crono.stop();
+
+      total += crono.wallTime();
+      distances = std::move(res.second);
+    }
+
+  return {total / (num_tests * static_cast<long double>(1000.)), distances};
+}
+
+
+int
+main(int argc, char **argv)
+{
+  GetPot command_line(argc, argv);
+
+  std::size_t num_tests = command_line("num_tests", 10);
+
+  Chrono crono;
+
+  std::vector<std::tuple<std::string, long double, long double, long double>> results;
+  for (auto const &file_name : get_test_names())
+    {
+      std::string input = "../google_tests/test_data/kfinder/in/" + file_name + ".in";
+
+      if (!Utilities::file_exists(input))
+        {
+          std::cout << "Missing file: " << input << std::endl;
+          continue;
+        }
+
+      std::cout << "Processing file: " << input << std::endl;
+
+      auto [graph, root, sink, k] = import_graph(input);
+
+      auto const weighted_graph = Weighted_Graph_Parallel_type<false>(graph).reverse();
+
+      auto const [set_time, set_res] =
+        time_dijkstra<Shortest_path_finder::Dijkstra_Set_Queue<Test_Weight_Type>>(weighted_graph,
+                                                                                  sink,
+                                                                                  num_tests,
+                                                                                  crono);
+      auto const [pairing_time, pairing_res] =
+        time_dijkstra<Shortest_path_finder::Dijkstra_Pairing_Heap<Test_Weight_Type>>(weighted_graph,
+                                                                                     sink,
+                                                                                     num_tests,
+                                                                                     crono);
+      auto const [radix_time, radix_res] =
+        time_dijkstra<Shortest_path_finder::Dijkstra_Radix_Heap<Test_Weight_Type>>(weighted_graph,
+                                                                                   sink,
+                                                                                   num_tests,
+                                                                                   crono);
+
+      if (set_res != pairing_res || set_res != radix_res)
+        {
+          std::cout << "The distances computed by the queues are different!" << std::endl;
+        }
+
+      std::cout << "Set " << set_time << " ms, Pairing heap " << pairing_time << " ms, Radix heap " << radix_time
+                << " ms" << std::endl
+                << std::endl;
+
+      results.emplace_back(file_name, set_time, pairing_time, radix_time);
+    }
+
+  std::string   export_path = "report_dijkstra_queues.txt";
+  std::ofstream out_file(export_path);
+
+  out_file << "Test,Set,PairingHeap,RadixHeap" << std::endl;
+  for (auto const &[name, set_time, pairing_time, radix_time] : results)
+    out_file << name << "," << set_time << "," << pairing_time << "," << radix_time << std::endl;
+}
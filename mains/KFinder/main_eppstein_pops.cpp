@@ -0,0 +1,166 @@
+#include <network_butcher/network_butcher.h>
+
+#include <fstream>
+
+
+
+/*
+ * This file measures how many paths per second the Eppstein and Lazy Eppstein algorithms extract from the queue of the
+ * path graph (pops/s), on the graphs of main_kfinder with at least a path. The heaps are constructed before starting the
+ * chronometer (through enumerate), thus only the main loop of the algorithms is measured (for Lazy Eppstein, it includes
+ * the construction of the H_gs on demand).
+ * */
+
+
+
+using namespace network_butcher;
+using namespace types;
+using namespace network_butcher::kfinder;
+
+using Node_type           = types::Node;
+using Test_Weight_Type    = unsigned long long int;
+using Graph_type_Parallel = types::WGraph<true, Node_type, Test_Weight_Type>;
+
+using Weighted_Graph_Parallel_type = Weighted_Graph<Graph_type_Parallel,
+                                                    false,
+                                                    Graph_type_Parallel::Node_Type,
+                                                    Graph_type_Parallel::Node_Collection_Type,
+                                                    Test_Weight_Type>;
+
+
+std::tuple<Graph_type_Parallel, Node_Id_Type, Node_Id_Type, Node_Id_Type>
+import_graph(const std::string &file_path)
+{
+  std::size_t                N, M, s, t, k, u, v;
+  Test_Weight_Type           tmp_weight;
+
+  std::ifstream in_file(file_path);
+  in_file >> N >> M >> s >> t >> k;
+
+  std::vector<network_butcher::types::Node>    nodes(N);
+  Converted_Onnx_Graph_Type::Neighbours_Type   deps(N);
+  std::vector<std::pair<std::pair<network_butcher::Node_Id_Type, network_butcher::Node_Id_Type>, Test_Weight_Type>>
+    edges;
+  edges.reserve(M);
+
+  for (std::size_t i = 0; i < M; ++i)
+    {
+      in_file >> u >> v >> tmp_weight;
+      edges.push_back({{u, v}, tmp_weight});
+
+      deps[v].first.insert(u);
+      deps[u].second.insert(v);
+    }
+
+  Graph_type_Parallel graph(nodes, deps);
+  for (auto const &[edge, weight] : edges)
+    graph.set_weight(edge, weight);
+
+  return std::tie(graph, s, t, k);
+}
+
+// The initial files were generated by: https://github.com/yosupo06/library-checker-problems
+std::vector<std::string>
+get_test_names()
+{
+  return {"example_00",
+          "random_03",
+          "small_random_01",
+          "small_random_02",
+          "smallest_random_00",
+          "smallest_random_01",
+          "smallest_random_02"};
+}
+
+
+/// It extracts (num_tests times) the K shortest paths with the given method, after the construction of the heaps
+/// \param method The name of the method
+/// \param graph The graph
+/// \param root The root
+/// \param sink The sink
+/// \param k The number of paths
+/// \param num_tests The number of repetitions
+/// \param crono The chronometer
+/// \return The number of pops per second and the total number of pops
+auto
+pops_per_second(std::string const         &method,
+                Graph_type_Parallel const &graph,
+                Node_Id_Type               root,
+                Node_Id_Type               sink,
+                std::size_t                k,
+                std::size_t                num_tests,
+                Chrono                    &crono) -> std::pair<long double, std::size_t>
+{
+  auto &factory = KFinder_Factory<Graph_type_Parallel, true, Weighted_Graph_Parallel_type>::Instance();
+
+  long double total_time = 0.;
+  std::size_t total_pops = 0;
+
+  for (std::size_t i = 0; i < num_tests; ++i)
+    {
+      auto const kfinder = factory.create(method, graph, root, sink);
+
+      // Construct the heaps (the enumerator is not used)
+      [[maybe_unused]] auto const enumerator = kfinder->enumerate();
+
+      crono.start();
+      auto const res = kfinder->compute(k);
+      crono.stop();
+
+      total_time += crono.wallTime();
+
+      // The shortest path is not extracted from the queue
+      total_pops += res.empty() ? 0 : res.size() - 1;
+    }
+
+  // wallTime is in microseconds
+  return {total_time > 0 ? total_pops / (total_time / static_cast<long double>(1000000.)) : 0., total_pops};
+}
+
+
+int
+main(int argc, char **argv)
+{
+  GetPot command_line(argc, argv);
+
+  std::size_t num_tests = command_line("num_tests", 10);
+
+  Chrono crono;
+
+  std::vector<std::tuple<std::string, std::size_t, long double, long double>> results;
+  for (auto const &file_name : get_test_names())
+    {
+      std::string input = "../google_tests/test_data/kfinder/in/" + file_name + ".in";
+
+      if (!Utilities::file_exists(input))
+        {
+          std::cout << "Missing file: " << input << std::endl;
+          continue;
+        }
+
+      std::cout << "Processing file: " << input << std::endl;
+
+      auto [graph, root, sink, k] = import_graph(input);
+
+      auto const [eppstein_pops, num_pops] = pops_per_second("eppstein", graph, root, sink, k, num_tests, crono);
+      auto const [lazy_pops, lazy_num_pops] = pops_per_second("lazy_eppstein", graph, root, sink, k, num_tests, crono);
+
+      if (num_pops != lazy_num_pops)
+        {
+          std::cout << "The number of paths found by the methods is different!" << std::endl;
+        }
+
+      std::cout << "Pops: " << num_pops / num_tests << ", Eppstein " << eppstein_pops << " pops/s, Lazy Eppstein "
+                << lazy_pops << " pops/s" << std::endl
+                << std::endl;
+
+      results.emplace_back(file_name, num_pops / num_tests, eppstein_pops, lazy_pops);
+    }
+
+  std::string   export_path = "report_eppstein_pops.txt";
+  std::ofstream out_file(export_path);
+
+  out_file << "Test,Pops,EppsteinPopsPerSecond,LazyEppsteinPopsPerSecond" << std::endl;
+  for (auto const &[name, num_pops, eppstein_pops, lazy_pops] : results)
+    out_file << name << "," << num_pops << "," << eppstein_pops << "," << lazy_pops << std::endl;
+}
@@ -0,0 +1,255 @@
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+#include <network_butcher/network_butcher.h>
+
+
+/*
+ * In this file, we compare the floating-point weights (long double, seconds) with the fixed-point ones (64-bit
+ * integers, nanoseconds, see USE_FIXED_POINT_WEIGHTS) on the "synthetic" graph of main_synthetic_graph, i.e., an
+ * emulation of the block graph. For both the weight types, we measure how long does it take to store the weights in
+ * the graph, to compute the shortest path tree and to find the K shortest paths with the Eppstein algorithm (both in
+ * the only distance and path case). The lengths of the paths found with the two weight types are checked to be the
+ * same (up to the quantization error).
+ * */
+
+using namespace network_butcher;
+using namespace network_butcher::types;
+using namespace network_butcher::kfinder;
+
+
+using Float_Weight_Type = long double;
+using Fixed_Weight_Type = std::int64_t;
+
+template <typename Weight_Type>
+using Synthetic_Graph_Type = WGraph<false, Node, Weight_Type>;
+
+template <typename Weight_Type>
+using Synthetic_Weighted_Graph_Type = Weighted_Graph<Synthetic_Graph_Type<Weight_Type>,
+                                                     false,
+                                                     typename Synthetic_Graph_Type<Weight_Type>::Node_Type,
+                                                     typename Synthetic_Graph_Type<Weight_Type>::Node_Collection_Type,
+                                                     Weight_Type>;
+
+
+/// The times measured (in ms) for a weight type
+struct Phase_Times
+{
+  /// Storage of the weights in the graph
+  long double weights = 0.;
+
+  /// Shortest path tree
+  long double tree = 0.;
+
+  /// K shortest paths (only distance)
+  long double dist = 0.;
+
+  /// K shortest paths (paths)
+  long double path = 0.;
+};
+
+
+/// It generates the synthetic graph (with base_nodes "linear" nodes and num_devices devices)
+/// \param base_nodes The number of linear nodes
+/// \param num_devices The number of devices
+/// \return The dependencies of the graph
+auto
+basic_dependencies(std::size_t base_nodes, std::size_t num_devices = 3)
+  -> Synthetic_Graph_Type<Float_Weight_Type>::Neighbours_Type
+{
+  if (base_nodes < 4)
+    {
+      throw std::runtime_error("Number of nodes must be at least 4");
+    }
+
+  Synthetic_Graph_Type<Float_Weight_Type>::Neighbours_Type deps(2 + (base_nodes - 2) * num_devices);
+
+  for (std::size_t i = 1; i < 1 + num_devices; ++i)
+    {
+      deps[0].second.insert(i);
+      deps[i].first.insert(0);
+    }
+
+  for (std::size_t i = 2; i < base_nodes - 1; ++i)
+    {
+      for (std::size_t k = 1; k <= num_devices; ++k)
+        {
+          for (std::size_t j = 1; j <= num_devices; ++j)
+            {
+              deps[(i - 1) * num_devices + k].first.insert((i - 2) * num_devices + j);
+              deps[(i - 2) * num_devices + j].second.insert((i - 1) * num_devices + k);
+            }
+        }
+    }
+
+  for (std::size_t k = 1; k < 1 + num_devices; ++k)
+    {
+      deps[(base_nodes - 2) * num_devices + 1].first.insert((base_nodes - 3) * num_devices + k);
+      deps[(base_nodes - 3) * num_devices + k].second.insert((base_nodes - 2) * num_devices + 1);
+    }
+
+  return deps;
+}
+
+
+/// It generates the weights (in seconds) of the edges of the graph, in the order they're visited
+/// \param deps The dependencies of the graph
+/// \return The weights
+auto
+basic_weights(Synthetic_Graph_Type<Float_Weight_Type>::Neighbours_Type const &deps) -> std::vector<long double>
+{
+  std::default_random_engine                  random_engine{0};
+  std::uniform_real_distribution<long double> weights_generator(0., 0.1);
+
+  std::vector<long double> res;
+  for (auto const &[inputs, outputs] : deps)
+    for (std::size_t i = 0; i < outputs.size(); ++i)
+      res.push_back(weights_generator(random_engine));
+
+  return res;
+}
+
+
+/// It measures the different phases for the given weight type
+/// \tparam Weight_Type The weight type
+/// \param deps The dependencies of the graph
+/// \param seconds The weights (in seconds)
+/// \param convert The function converting a time in seconds to a weight
+/// \param K The number of paths
+/// \param num_tests The number of repetitions
+/// \param crono The chronometer
+/// \return The times and the lengths of the paths (in seconds)
+template <typename Weight_Type, typename Convert_Function>
+auto
+measure(Synthetic_Graph_Type<Float_Weight_Type>::Neighbours_Type const &deps,
+        std::vector<long double> const                                 &seconds,
+        Convert_Function const                                         &convert,
+        std::size_t                                                     K,
+        std::size_t                                                     num_tests,
+        Chrono                                                         &crono)
+  -> std::pair<Phase_Times, std::vector<long double>>
+{
+  using Graph_Type          = Synthetic_Graph_Type<Weight_Type>;
+  using Weighted_Graph_Type = Synthetic_Weighted_Graph_Type<Weight_Type>;
+
+  Phase_Times              times;
+  std::vector<long double> lengths;
+
+  Graph_Type graph(std::vector<Node>(deps.size()), deps);
+  auto const sink = graph.get_nodes().back().get_id();
+
+  for (std::size_t test_num = 0; test_num < num_tests; ++test_num)
+    {
+      // Store (and quantize) the weights, as the weight importers do
+      crono.start();
+      std::size_t i = 0;
+      for (std::size_t tail = 0; tail < deps.size(); ++tail)
+        for (auto const &head : deps[tail].second)
+          graph.set_weight(std::make_pair(tail, head), convert(seconds[i++]));
+      crono.stop();
+      times.weights += crono.wallTime();
+
+      Weighted_Graph_Type const weighted_graph(graph);
+
+      crono.start();
+      auto const tree = Shortest_path_finder::shortest_path_tree(weighted_graph.reverse(), sink);
+      crono.stop();
+      times.tree += crono.wallTime();
+
+      if (tree.second.front() == std::numeric_limits<Weight_Type>::max())
+        throw std::runtime_error("The sink cannot be reached");
+
+      crono.start();
+      auto const dist = KFinder_Eppstein<Graph_Type, true, Weighted_Graph_Type>(graph, 0, sink).compute(K);
+      crono.stop();
+      times.dist += crono.wallTime();
+
+      crono.start();
+      auto const paths = KFinder_Eppstein<Graph_Type, false, Weighted_Graph_Type>(graph, 0, sink).compute(K);
+      crono.stop();
+      times.path += crono.wallTime();
+
+      if (dist.size() < K || paths.size() < K)
+        throw std::runtime_error("The number of paths does not match the expected one!");
+
+      lengths.clear();
+      for (auto const &length : dist)
+        lengths.push_back(static_cast<long double>(length));
+    }
+
+  auto const to_ms = static_cast<long double>(num_tests) * 1000.;
+
+  times.weights /= to_ms;
+  times.tree /= to_ms;
+  times.dist /= to_ms;
+  times.path /= to_ms;
+
+  return {times, lengths};
+}
+
+
+int
+main(int argc, char **argv)
+{
+  GetPot command_line(argc, argv);
+
+  std::size_t num_tests       = command_line("num_tests", 5);
+  std::size_t max_power_nodes = command_line("max_power_nodes", 15);
+  std::size_t K               = command_line("K", 10000);
+
+  std::string export_path = "report_fixed_point_weights.txt";
+
+  Chrono crono;
+
+  std::ofstream out_file(export_path);
+  out_file << "NumNodes,K,FloatWeights,FixedWeights,FloatTree,FixedTree,FloatDist,FixedDist,FloatPath,FixedPath,"
+              "FloatBytes,FixedBytes"
+           << std::endl;
+
+  for (std::size_t power_nodes = 7; power_nodes <= max_power_nodes; power_nodes += 4)
+    {
+      auto const deps    = basic_dependencies(std::size_t{1} << power_nodes);
+      auto const seconds = basic_weights(deps);
+
+      auto const [float_times, float_lengths] = measure<Float_Weight_Type>(
+        deps, seconds, [](long double value) { return value; }, K, num_tests, crono);
+
+      auto const [fixed_times, fixed_lengths] = measure<Fixed_Weight_Type>(
+        deps,
+        seconds,
+        [](long double value) { return static_cast<Fixed_Weight_Type>(std::round(value * 1e9)); },
+        K,
+        num_tests,
+        crono);
+
+      // The quantization error of a path is at most half a nanosecond per edge
+      auto const tolerance = 0.5e-9 * static_cast<long double>(deps.size());
+      for (std::size_t i = 0; i < float_lengths.size(); ++i)
+        {
+          if (std::abs(float_lengths[i] - fixed_lengths[i] / 1e9) > tolerance)
+            {
+              std::cout << "The lengths of the paths are different!" << std::endl;
+              break;
+            }
+        }
+
+      std::cout << "Nodes: " << deps.size() << ", K: " << K << std::endl
+                << "Weights: long double " << float_times.weights << " ms, int64 " << fixed_times.weights << " ms"
+                << std::endl
+                << "Shortest path tree: long double " << float_times.tree << " ms, int64 " << fixed_times.tree
+                << " ms" << std::endl
+                << "Eppstein Dist: long double " << float_times.dist << " ms, int64 " << fixed_times.dist << " ms"
+                << std::endl
+                << "Eppstein Path: long double " << float_times.path << " ms, int64 " << fixed_times.path << " ms"
+                << std::endl
+                << std::endl;
+
+      out_file << deps.size() << "," << K << "," << float_times.weights << "," << fixed_times.weights << ","
+               << float_times.tree << "," << fixed_times.tree << "," << float_times.dist << "," << fixed_times.dist
+               << "," << float_times.path << "," << fixed_times.path << "," << sizeof(Float_Weight_Type) << ","
+               << sizeof(Fixed_Weight_Type) << std::endl;
+    }
+}
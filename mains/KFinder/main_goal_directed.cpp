@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+#include <network_butcher/network_butcher.h>
+#include <network_butcher/K-shortest_path/kastar.h>
+
+
+/*
+ * In this file, we compare the goal-directed (A*) search with the Eppstein and Lazy Eppstein algorithms on the
+ * "synthetic" graph of main_synthetic_graph, i.e., an emulation of the block graph, for small values of K. The A*
+ * search is guided either by the lower bounds computed from the smallest weights leaving every node and entering every
+ * layer (AStarLayer, the time includes the computation of the bounds) or by the exact distances from the sink
+ * (AStarExact). The lengths of the paths found by the different methods are checked to be the same.
+ * */
+
+using namespace network_butcher;
+using namespace network_butcher::types;
+using namespace network_butcher::kfinder;
+
+using GraphType = WGraph<false, Node>;
+
+
+/// The times measured (in ms) for every method
+struct Method_Times
+{
+  /// Eppstein
+  long double eppstein = 0.;
+
+  /// Lazy Eppstein
+  long double lazy = 0.;
+
+  /// A* guided by the per-layer lower bounds
+  long double layer = 0.;
+
+  /// A* guided by the exact distances
+  long double exact = 0.;
+};
+
+
+/// It generates the synthetic graph (with base_nodes "linear" nodes and num_devices devices) and the layer of every
+/// node
+/// \param base_nodes The number of linear nodes
+/// \param num_devices The number of devices
+/// \return The graph and the layers of its nodes
+auto
+basic_graph(std::size_t base_nodes, std::size_t num_devices) -> std::pair<GraphType, std::vector<std::size_t>>
+{
+  if (base_nodes < 4)
+    {
+      throw std::runtime_error("Number of nodes must be at least 4");
+    }
+
+  auto const num_nodes = 2 + (base_nodes - 2) * num_devices;
+
+  GraphType::Neighbours_Type deps(num_nodes);
+  std::vector<std::size_t>   layers(num_nodes, 0);
+
+  for (std::size_t i = 1; i < 1 + num_devices; ++i)
+    {
+      deps[0].second.insert(i);
+      deps[i].first.insert(0);
+    }
+
+  for (std::size_t i = 2; i < base_nodes - 1; ++i)
+    {
+      for (std::size_t k = 1; k <= num_devices; ++k)
+        {
+          for (std::size_t j = 1; j <= num_devices; ++j)
+            {
+              deps[(i - 1) * num_devices + k].first.insert((i - 2) * num_devices + j);
+              deps[(i - 2) * num_devices + j].second.insert((i - 1) * num_devices + k);
+            }
+        }
+    }
+
+  for (std::size_t k = 1; k < 1 + num_devices; ++k)
+    {
+      deps[(base_nodes - 2) * num_devices + 1].first.insert((base_nodes - 3) * num_devices + k);
+      deps[(base_nodes - 3) * num_devices + k].second.insert((base_nodes - 2) * num_devices + 1);
+    }
+
+  // The copies of a linear node on the different devices form a layer
+  for (std::size_t node = 1; node < num_nodes; ++node)
+    layers[node] = 1 + (node - 1) / num_devices;
+
+  GraphType graph(std::vector<Node>(num_nodes), std::move(deps));
+
+  std::default_random_engine                   random_engine{0};
+  std::uniform_real_distribution<Seconds_Type> weights_generator(0., 100.);
+
+  for (std::size_t tail = 0; tail < num_nodes; ++tail)
+    for (auto const &head : graph.get_output_nodes(tail))
+      graph.set_weight(std::make_pair(tail, head), to_time_type(weights_generator(random_engine)));
+
+  return {std::move(graph), std::move(layers)};
+}
+
+
+/// It measures the time taken by a K shortest path search, checking the lengths of the paths
+/// \param search The function performing the search
+/// \param expected The expected lengths (if empty, they are set)
+/// \param crono The chronometer
+/// \return The time (in ms)
+template <typename Search_Function>
+auto
+measure(Search_Function const &search, std::vector<Time_Type> &expected, Chrono &crono) -> long double
+{
+  crono.start();
+  auto const res = search();
+  crono.stop();
+
+  std::vector<Time_Type> lengths;
+  for (auto const &path : res)
+    lengths.push_back(path.length);
+
+  if (expected.empty())
+    {
+      expected = lengths;
+    }
+  else
+    {
+      // The lengths are accumulated in a different order by the different methods
+      auto const same_length = [](Time_Type lhs, Time_Type rhs) {
+        auto const tolerance = 1e-12L * std::max(1.L, std::abs(static_cast<long double>(lhs)));
+        return std::abs(static_cast<long double>(lhs) - static_cast<long double>(rhs)) <= tolerance;
+      };
+
+      if (!std::ranges::equal(expected, lengths, same_length))
+        throw std::runtime_error("The lengths of the paths are different!");
+    }
+
+  return crono.wallTime() / 1000.;
+}
+
+
+int
+main(int argc, char **argv)
+{
+  GetPot command_line(argc, argv);
+
+  std::size_t num_tests       = command_line("num_tests", 5);
+  std::size_t max_power_nodes = command_line("max_power_nodes", 19);
+  std::size_t num_devices     = command_line("num_devices", 3);
+
+  std::string export_path = "report_goal_directed.txt";
+
+  Chrono crono;
+
+  std::ofstream out_file(export_path);
+  out_file << "NumNodes,K,Eppstein,LazyEppstein,AStarLayer,AStarExact" << std::endl;
+
+  for (std::size_t power_nodes = 7; power_nodes <= max_power_nodes; power_nodes += 4)
+    {
+      auto const  synthetic_graph = basic_graph(std::size_t{1} << power_nodes, num_devices);
+      auto const &graph           = synthetic_graph.first;
+      auto const &layers          = synthetic_graph.second;
+      auto const  sink            = graph.get_nodes().back().get_id();
+
+      for (std::size_t K : {1, 2, 5, 10})
+        {
+          Method_Times times;
+
+          for (std::size_t test_num = 0; test_num < num_tests; ++test_num)
+            {
+              std::vector<Time_Type> expected;
+
+              times.eppstein +=
+                measure([&]() { return KFinder_Eppstein<GraphType>(graph, 0, sink).compute(K); }, expected, crono);
+
+              times.lazy += measure(
+                [&]() { return KFinder_Lazy_Eppstein<GraphType>(graph, 0, sink).compute(K); }, expected, crono);
+
+              times.layer += measure(
+                [&]() {
+                  KFinder_A_Star<GraphType> kfinder(graph, 0, sink);
+
+                  auto bounds =
+                    Shortest_path_finder::layered_lower_bounds(Weighted_Graph<GraphType>(graph), layers, sink);
+                  if (!bounds)
+                    throw std::runtime_error("The graph is not layered!");
+
+                  kfinder.set_lower_bounds(std::move(*bounds));
+                  return kfinder.compute(K);
+                },
+                expected,
+                crono);
+
+              times.exact +=
+                measure([&]() { return KFinder_A_Star<GraphType>(graph, 0, sink).compute(K); }, expected, crono);
+            }
+
+          times.eppstein /= num_tests;
+          times.lazy /= num_tests;
+          times.layer /= num_tests;
+          times.exact /= num_tests;
+
+          std::cout << "Nodes: " << graph.size() << ", K: " << K << std::endl
+                    << "Eppstein: " << times.eppstein << " ms, Lazy Eppstein: " << times.lazy << " ms" << std::endl
+                    << "A* (layers): " << times.layer << " ms, A* (exact): " << times.exact << " ms" << std::endl
+                    << std::endl;
+
+          out_file << graph.size() << "," << K << "," << times.eppstein << "," << times.lazy << "," << times.layer
+                   << "," << times.exact << std::endl;
+        }
+    }
+}
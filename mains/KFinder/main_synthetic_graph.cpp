@@ -1,14 +1,22 @@
 #include <iostream>
 #include <random>
 
+#if __has_include(<sys/resource.h>)
+#  include <sys/resource.h>
+#endif
+
 #include <network_butcher/network_butcher.h>
+#include <network_butcher/K-shortest_path/keppstein_frederickson.h>
 
 
 /*
  * In this file, we test how long does the Eppstein and Lazy Eppstein algorithm take to compute the K shortest paths on
  * a "synthetic" graph, that is an emulation of the block graph. We, in particular, test how long does the algortihm
  * take to generate K paths both in the only distance and path case, and both for Eppstein and Lazy Eppstein given the
- * number of nodes
+ * number of nodes. The only distance case is also measured for the Eppstein algorithm with the heap selection of
+ * Frederickson (FredDist), for the Eppstein algorithm with the bounded queue (BoundDist) and for the Yen algorithm
+ * (YenDist). For each method, the peak resident set size reached during the calls is reported as well (only on Linux,
+ * where the peak can be reset).
  * */
 
 using namespace network_butcher;
@@ -35,13 +43,13 @@ basic_weight(Graph &graph, bool fully_random = false)
     }
   std::default_random_engine random_engine{seed};
 
-  std::uniform_real_distribution<GraphType::Weight_Type> node_weights_generator(0., 100.);
+  std::uniform_real_distribution<Seconds_Type> node_weights_generator(0., 100.);
 
   for (std::size_t tail = 0; tail < graph.get_nodes().size(); ++tail)
     for (auto const &head : graph.get_output_nodes(tail))
       {
         auto const tmp_weight = node_weights_generator(random_engine);
-        graph.set_weight(std::make_pair(tail, head), tmp_weight);
+        graph.set_weight(std::make_pair(tail, head), to_time_type(tmp_weight));
       }
 }
 
@@ -83,6 +91,29 @@ basic_graph(std::size_t base_nodes, std::size_t num_devices = 3)
   return GraphType(std::vector<Node_type>(2 + (base_nodes - 2) * num_devices), std::move(deps));
 };
 
+/// It resets the peak resident set size of the process. It has no effect outside Linux
+void
+reset_peak_rss()
+{
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  if (clear_refs)
+    clear_refs << "5";
+}
+
+/// It returns the peak resident set size of the process (in kB), or 0 if it cannot be retrieved
+/// \return The peak RSS
+long
+peak_rss()
+{
+#if __has_include(<sys/resource.h>)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    return usage.ru_maxrss;
+#endif
+
+  return 0;
+}
+
 std::size_t
 simple_pow(std::size_t base, std::size_t exp)
 {
@@ -101,7 +132,7 @@ main(int argc, char **argv)
   GetPot      command_line(argc, argv);
   std::string export_path = "report_Synthetic_Graph.txt";
 
-  std::vector<std::tuple<std::string, Time_Type>> results;
+  std::vector<std::tuple<std::string, long double>> results;
   std::size_t                                     num_tests       = command_line("num_tests", 10);
   std::size_t                                     max_power_nodes = command_line("max_power_nodes", 19);
   std::size_t                                     max_power_K     = command_line("max_power_K", 13);
@@ -133,7 +164,9 @@ main(int argc, char **argv)
 
   {
     std::ofstream out_file(export_path);
-    out_file << "NumNodes,K,EppDist,EppPath,LazyDist,LazyPath" << std::endl;
+    out_file << "NumNodes,K,EppDist,EppPath,LazyDist,LazyPath,EppDistRSS,EppPathRSS,LazyDistRSS,LazyPathRSS,FredDist,"
+                "FredDistRSS,YenDist,YenDistRSS,BoundDist,BoundDistRSS"
+             << std::endl;
     out_file.close();
   }
 
@@ -152,84 +185,174 @@ main(int argc, char **argv)
 
           std::cout << "K: " << K << std::endl;
 
-          Time_Type time_eppstein_dist = 0., time_lazy_dist = 0.;
-          Time_Type time_eppstein_path = 0., time_lazy_path = 0.;
+          long double time_eppstein_dist = 0., time_lazy_dist = 0.;
+          long double time_eppstein_path = 0., time_lazy_path = 0.;
+          long double time_frederickson_dist = 0., time_yen_dist = 0., time_bounded_dist = 0.;
+
+          // Peak RSS (in kB) for every method
+          long rss_eppstein_dist = 0, rss_lazy_dist = 0;
+          long rss_eppstein_path = 0, rss_lazy_path = 0;
+          long rss_frederickson_dist = 0, rss_yen_dist = 0, rss_bounded_dist = 0;
 
           bool end_prematurely = false;
 
           for (std::size_t test_num = 0; test_num < num_tests; ++test_num)
             {
-              Time_Type local_eppstein_dist = 0., local_lazy_dist = 0.;
-              Time_Type local_eppstein_path = 0., local_lazy_path = 0.;
+              long double local_eppstein_dist = 0., local_lazy_dist = 0.;
+              long double local_eppstein_path = 0., local_lazy_path = 0.;
+              long double local_frederickson_dist = 0., local_yen_dist = 0., local_bounded_dist = 0.;
 
               {
+                reset_peak_rss();
+
                 crono.start();
                 auto const res = network_butcher::kfinder::KFinder_Factory<GraphType, false>::Instance()
                                    .create("eppstein", graph, 0, graph.get_nodes().back().get_id())
                                    ->compute(K);
                 crono.stop();
 
+                rss_eppstein_path = std::max(rss_eppstein_path, peak_rss());
+
                 if (res.size() < K)
                   {
                     end_prematurely = true;
                     break;
                   }
 
-                Time_Type local_time = crono.wallTime();
+                long double local_time = crono.wallTime();
                 local_eppstein_path += local_time;
                 time_eppstein_path += local_time;
               }
 
               {
+                reset_peak_rss();
+
                 crono.start();
                 auto const res = network_butcher::kfinder::KFinder_Factory<GraphType, true>::Instance()
                                    .create("eppstein", graph, 0, graph.get_nodes().back().get_id())
                                    ->compute(K);
                 crono.stop();
 
+                rss_eppstein_dist = std::max(rss_eppstein_dist, peak_rss());
+
                 if (res.size() < K)
                   {
                     throw std::runtime_error(
                       "Eppstein Dist failed: the number of paths does not match the expected one!");
                   }
 
-                Time_Type local_time = crono.wallTime();
+                long double local_time = crono.wallTime();
                 local_eppstein_dist += local_time;
                 time_eppstein_dist += local_time;
               }
 
               {
+                reset_peak_rss();
+
+                crono.start();
+                network_butcher::kfinder::KFinder_Eppstein<GraphType, true> kfinder(
+                  graph, 0, graph.get_nodes().back().get_id());
+                kfinder.set_bounded_queue(true);
+
+                auto const res = kfinder.compute(K);
+                crono.stop();
+
+                rss_bounded_dist = std::max(rss_bounded_dist, peak_rss());
+
+                if (res.size() < K)
+                  {
+                    throw std::runtime_error(
+                      "Eppstein Bounded Dist failed: the number of paths does not match the expected one!");
+                  }
+
+                long double local_time = crono.wallTime();
+                local_bounded_dist += local_time;
+                time_bounded_dist += local_time;
+              }
+
+              {
+                reset_peak_rss();
+
+                crono.start();
+                auto const res = network_butcher::kfinder::KFinder_Eppstein_Frederickson<GraphType, true>(
+                                   graph, 0, graph.get_nodes().back().get_id())
+                                   .compute(K);
+                crono.stop();
+
+                rss_frederickson_dist = std::max(rss_frederickson_dist, peak_rss());
+
+                if (res.size() < K)
+                  {
+                    throw std::runtime_error(
+                      "Eppstein Frederickson Dist failed: the number of paths does not match the expected one!");
+                  }
+
+                long double local_time = crono.wallTime();
+                local_frederickson_dist += local_time;
+                time_frederickson_dist += local_time;
+              }
+
+              {
+                reset_peak_rss();
+
+                crono.start();
+                auto const res = network_butcher::kfinder::KFinder_Factory<GraphType, true>::Instance()
+                                   .create("yen", graph, 0, graph.get_nodes().back().get_id())
+                                   ->compute(K);
+                crono.stop();
+
+                rss_yen_dist = std::max(rss_yen_dist, peak_rss());
+
+                if (res.size() < K)
+                  {
+                    throw std::runtime_error("Yen Dist failed: the number of paths does not match the expected one!");
+                  }
+
+                long double local_time = crono.wallTime();
+                local_yen_dist += local_time;
+                time_yen_dist += local_time;
+              }
+
+              {
+                reset_peak_rss();
+
                 crono.start();
                 auto const res = network_butcher::kfinder::KFinder_Factory<GraphType, false>::Instance()
                                    .create("lazy_eppstein", graph, 0, graph.get_nodes().back().get_id())
                                    ->compute(K);
                 crono.stop();
 
+                rss_lazy_path = std::max(rss_lazy_path, peak_rss());
+
                 if (res.size() < K)
                   {
                     throw std::runtime_error(
                       "Lazy Eppstein Path failed: the number of paths does not match the expected one!");
                   }
 
-                Time_Type local_time = crono.wallTime();
+                long double local_time = crono.wallTime();
                 local_lazy_path += local_time;
                 time_lazy_path += local_time;
               }
 
               {
+                reset_peak_rss();
+
                 crono.start();
                 auto const res = network_butcher::kfinder::KFinder_Factory<GraphType, true>::Instance()
                                    .create("lazy_eppstein", graph, 0, graph.get_nodes().back().get_id())
                                    ->compute(K);
                 crono.stop();
 
+                rss_lazy_dist = std::max(rss_lazy_dist, peak_rss());
+
                 if (res.size() < K)
                   {
                     throw std::runtime_error(
                       "Lazy Eppstein Dist failed: the number of paths does not match the expected one!");
                   }
 
-                Time_Type local_time = crono.wallTime();
+                long double local_time = crono.wallTime();
                 local_lazy_dist += local_time;
                 time_lazy_dist += local_time;
               }
@@ -238,7 +361,9 @@ main(int argc, char **argv)
               std::cout << "Test #" << Utilities::custom_to_string(test_num + 1) << ": EppDist "
                         << local_eppstein_dist / 1000. << " ms, EppPath " << local_eppstein_path / 1000.
                         << " ms, LazyDist " << local_lazy_dist / 1000. << " ms, LazyPath " << local_lazy_path / 1000.
-                        << " ms" << std::endl;
+                        << " ms, FredDist " << local_frederickson_dist / 1000. << " ms, YenDist "
+                        << local_yen_dist / 1000. << " ms, BoundDist " << local_bounded_dist / 1000. << " ms"
+                        << std::endl;
             }
 
           if (end_prematurely)
@@ -254,15 +379,28 @@ main(int argc, char **argv)
           time_lazy_dist /= (num_tests * static_cast<long double>(1000.));
           time_lazy_path /= (num_tests * static_cast<long double>(1000.));
 
+          time_frederickson_dist /= (num_tests * static_cast<long double>(1000.));
+          time_yen_dist /= (num_tests * static_cast<long double>(1000.));
+          time_bounded_dist /= (num_tests * static_cast<long double>(1000.));
+
           std::cout << std::endl
                     << "Total time average for " << graph.size() << " nodes and K: " << K << " is: "
                     << "EppDist " << time_eppstein_dist << " ms, EppPath " << time_eppstein_path << " ms, LazyDist "
-                    << time_lazy_dist << " ms, LazyPath " << time_lazy_path << " ms" << std::endl
+                    << time_lazy_dist << " ms, LazyPath " << time_lazy_path << " ms, FredDist "
+                    << time_frederickson_dist << " ms, YenDist " << time_yen_dist << " ms, BoundDist "
+                    << time_bounded_dist << " ms" << std::endl
+                    << "Peak RSS: EppDist " << rss_eppstein_dist << " kB, EppPath " << rss_eppstein_path
+                    << " kB, LazyDist " << rss_lazy_dist << " kB, LazyPath " << rss_lazy_path << " kB, FredDist "
+                    << rss_frederickson_dist << " kB, YenDist " << rss_yen_dist << " kB, BoundDist " << rss_bounded_dist
+                    << " kB" << std::endl
                     << std::endl;
 
           std::ofstream out_file(export_path, std::ios_base::app);
           out_file << graph.size() << "," << K << "," << time_eppstein_dist << "," << time_eppstein_path << ","
-                   << time_lazy_dist << "," << time_lazy_path << std::endl;
+                   << time_lazy_dist << "," << time_lazy_path << "," << rss_eppstein_dist << "," << rss_eppstein_path
+                   << "," << rss_lazy_dist << "," << rss_lazy_path << "," << time_frederickson_dist << ","
+                   << rss_frederickson_dist << "," << time_yen_dist << "," << rss_yen_dist << "," << time_bounded_dist
+                   << "," << rss_bounded_dist << std::endl;
           out_file.close();
         }
     }
@@ -22,7 +22,7 @@ namespace network_butcher::io::Weight_importer_helpers
           tmp_vec.reserve(value.size());
           for (auto const &val : value)
             {
-              tmp_vec.push_back(std::max(std::stod(val), 0.));
+              tmp_vec.push_back(to_time_type(std::max(std::stod(val), 0.)));
             }
           return tmp_vec;
         };
@@ -34,7 +34,7 @@ namespace network_butcher::io::Weight_importer_helpers
           tmp_vec.reserve(value.size());
           for (auto const &val : value)
             {
-              tmp_vec.push_back(std::stod(val));
+              tmp_vec.push_back(to_time_type(std::stod(val)));
             }
           return tmp_vec;
         };
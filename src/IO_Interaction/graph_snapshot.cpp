@@ -0,0 +1,652 @@
+#include <network_butcher/IO_Interaction/graph_snapshot.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace network_butcher::io::Graph_Snapshot
+{
+  namespace
+  {
+    /// The first bytes of every snapshot
+    constexpr std::array<char, 8> magic{'N', 'B', 'S', 'N', 'A', 'P', '\0', '\0'};
+
+    /// Every entry is aligned to this number of bytes
+    constexpr std::size_t alignment = 8;
+
+    /// Index used to represent a missing tensor
+    constexpr std::uint64_t null_index = std::numeric_limits<std::uint64_t>::max();
+
+    /// Flags of the header: padding options
+    constexpr std::uint64_t input_padding_flag  = 1;
+    constexpr std::uint64_t output_padding_flag = 2;
+
+    /// Flags of a tensor
+    constexpr std::uint64_t initialized_flag = 1;
+    constexpr std::uint64_t constant_flag    = 2;
+
+
+    /// It returns the number of padding bytes required to align an entry of the given size
+    /// \param size The size of the entry (in bytes)
+    /// \return The number of padding bytes
+    constexpr auto
+    padding(std::size_t size) -> std::size_t
+    {
+      return (alignment - size % alignment) % alignment;
+    }
+
+
+    /// Simple class used to write the entries of a snapshot to a buffer
+    class Snapshot_Writer
+    {
+    private:
+      /// The buffer
+      std::string buffer;
+
+    public:
+      /// It appends the given bytes, followed by the padding
+      /// \param data The bytes
+      /// \param size The number of bytes
+      void
+      write_bytes(void const *data, std::size_t size)
+      {
+        buffer.append(static_cast<char const *>(data), size);
+        buffer.append(padding(size), '\0');
+      }
+
+      /// It appends an integer
+      /// \param value The integer
+      void
+      write(std::uint64_t value)
+      {
+        write_bytes(&value, sizeof(value));
+      }
+
+      /// It appends an array, prefixed by its size
+      /// \param values The array
+      template <typename T>
+        requires std::is_trivially_copyable_v<T>
+      void
+      write_array(std::span<T const> values)
+      {
+        write(values.size());
+        write_bytes(values.data(), values.size_bytes());
+      }
+
+      /// It appends a string, prefixed by its size
+      /// \param value The string
+      void
+      write_string(std::string_view value)
+      {
+        write_array(std::span<char const>(value.data(), value.size()));
+      }
+
+      /// Getter for the buffer
+      /// \return The buffer
+      [[nodiscard]] auto
+      get_buffer() const -> std::string const &
+      {
+        return buffer;
+      }
+    };
+
+
+    /// Simple class used to read the entries of a snapshot from a buffer. It throws if the buffer is shorter than
+    /// expected
+    class Snapshot_Reader
+    {
+    private:
+      /// The buffer
+      std::span<char const> data;
+
+      /// The position of the next entry
+      std::size_t position = 0;
+
+      /// It checks that the given number of bytes can be read
+      /// \param size The number of bytes
+      void
+      check_size(std::size_t size) const
+      {
+        if (size > data.size() - position)
+          throw std::runtime_error("Graph_Snapshot::import_snapshot: the snapshot is truncated");
+      }
+
+    public:
+      /// Constructs the reader of the given buffer
+      /// \param data The buffer
+      explicit Snapshot_Reader(std::span<char const> data)
+        : data(data)
+      {}
+
+      /// It reads the given number of bytes, skipping the padding
+      /// \param out The destination
+      /// \param size The number of bytes
+      void
+      read_bytes(void *out, std::size_t size)
+      {
+        check_size(size);
+
+        if (size > 0)
+          std::memcpy(out, data.data() + position, size);
+
+        position = std::min(data.size(), position + size + padding(size));
+      }
+
+      /// It reads an integer
+      /// \return The integer
+      auto
+      read() -> std::uint64_t
+      {
+        std::uint64_t value;
+        read_bytes(&value, sizeof(value));
+
+        return value;
+      }
+
+      /// It reads the number of entries of a collection. Since every entry takes at least entry_size bytes, it checks
+      /// that they can be read before anything is allocated
+      /// \param entry_size The minimum size of an entry (in bytes)
+      /// \return The number of entries
+      auto
+      read_count(std::size_t entry_size) -> std::size_t
+      {
+        auto const size = read();
+
+        if (size > (data.size() - position) / entry_size)
+          throw std::runtime_error("Graph_Snapshot::import_snapshot: the snapshot is truncated");
+
+        return static_cast<std::size_t>(size);
+      }
+
+      /// It reads an array prefixed by its size
+      /// \return The array
+      template <typename T>
+        requires std::is_trivially_copyable_v<T>
+      auto
+      read_array() -> std::vector<T>
+      {
+        std::vector<T> res(read_count(sizeof(T)));
+        read_bytes(res.data(), res.size() * sizeof(T));
+
+        return res;
+      }
+
+      /// It reads a string prefixed by its size
+      /// \return The string
+      auto
+      read_string() -> std::string
+      {
+        auto const size = read();
+        check_size(size);
+
+        std::string res(data.data() + position, size);
+        position = std::min(data.size(), position + size + padding(size));
+
+        return res;
+      }
+
+      /// It checks if the whole buffer was read
+      /// \return True if there is nothing else to read
+      [[nodiscard]] auto
+      at_end() const -> bool
+      {
+        return position == data.size();
+      }
+    };
+
+
+    /// It returns the flags of the header
+    /// \param add_input_padding Was the input padding node added?
+    /// \param add_output_padding Was the output padding node added?
+    /// \return The flags
+    auto
+    padding_flags(bool add_input_padding, bool add_output_padding) -> std::uint64_t
+    {
+      return (add_input_padding ? input_padding_flag : 0) | (add_output_padding ? output_padding_flag : 0);
+    }
+
+
+    /// The tables of the interned names and of the tensors referenced by the nodes of a graph
+    struct Tables_Type
+    {
+      /// The ids of the interned names, in order of first appearance
+      std::vector<Symbol_Id_Type> symbols;
+
+      /// The position of every interned name in symbols
+      std::unordered_map<Symbol_Id_Type, std::uint64_t> symbol_positions;
+
+      /// The tensors, in order of first appearance
+      std::vector<types::Dense_tensor const *> tensors;
+
+      /// The position of every tensor in tensors
+      std::unordered_map<types::Type_Info const *, std::uint64_t> tensor_positions;
+    };
+
+
+    /// It collects the interned names and the tensors referenced by the nodes of the graph. Tensors shared by
+    /// different nodes are stored once
+    /// \param graph The graph
+    /// \return The tables
+    auto
+    collect_tables(Converted_Onnx_Graph_Type const &graph) -> Tables_Type
+    {
+      Tables_Type res;
+
+      auto const add_collection = [&res](Io_Collection_Type<Type_Info_Pointer> const &collection) {
+        for (auto const &[symbol, tensor] : collection)
+          {
+            if (res.symbol_positions.emplace(symbol, res.symbols.size()).second)
+              res.symbols.push_back(symbol);
+
+            if (!tensor || res.tensor_positions.contains(tensor.get()))
+              continue;
+
+            auto const dense_tensor = dynamic_cast<types::Dense_tensor const *>(tensor.get());
+            if (dense_tensor == nullptr)
+              throw std::runtime_error("Graph_Snapshot::export_snapshot: only Dense_tensor can be stored");
+
+            res.tensor_positions.emplace(tensor.get(), res.tensors.size());
+            res.tensors.push_back(dense_tensor);
+          }
+      };
+
+      for (auto const &node : graph.get_nodes())
+        {
+          add_collection(node.content.get_input());
+          add_collection(node.content.get_output());
+          add_collection(node.content.get_parameters());
+        }
+
+      return res;
+    }
+
+
+    /// A node read from a snapshot. The interned names are referred to by their position in the table of the
+    /// snapshot, since they're added to the Symbol_Table only once the whole snapshot is read
+    struct Snapshot_Node_Type
+    {
+      /// The name of the node
+      std::string name;
+
+      /// The operation id of the node
+      std::string operation_id;
+
+      /// The inputs, outputs and parameters of the node: pairs of (position of the name, position of the tensor)
+      std::array<std::vector<std::pair<std::uint64_t, std::uint64_t>>, 3> collections;
+
+      /// The attributes of the node
+      std::unordered_map<std::string, types::Variant_Attribute> attributes;
+    };
+
+
+    /// It writes an attribute of a node
+    /// \param writer The writer
+    /// \param attribute The attribute
+    void
+    write_attribute(Snapshot_Writer &writer, types::Variant_Attribute const &attribute)
+    {
+      writer.write(attribute.index());
+
+      std::visit(
+        [&writer]<typename T>(std::vector<T> const &values) {
+          if constexpr (std::is_same_v<T, std::string>)
+            {
+              writer.write(values.size());
+              for (auto const &value : values)
+                writer.write_string(value);
+            }
+          else
+            {
+              writer.write_array(std::span<T const>(values));
+            }
+        },
+        attribute);
+    }
+
+
+    /// It reads an attribute of a node
+    /// \param reader The reader
+    /// \return The attribute
+    auto
+    read_attribute(Snapshot_Reader &reader) -> types::Variant_Attribute
+    {
+      switch (reader.read())
+        {
+            case 0: {
+              return reader.read_array<long int>();
+            }
+            case 1: {
+              return reader.read_array<float>();
+            }
+            case 2: {
+              // Every string is prefixed by its size
+              std::vector<std::string> values(reader.read_count(sizeof(std::uint64_t)));
+              for (auto &value : values)
+                value = reader.read_string();
+
+              return values;
+            }
+            default: {
+              throw std::runtime_error("Graph_Snapshot::import_snapshot: unknown attribute type");
+            }
+        }
+    }
+  } // namespace
+
+
+  auto
+  compute_file_hash(std::string const &path) -> std::uint64_t
+  {
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file)
+      throw std::runtime_error("Graph_Snapshot::compute_file_hash: cannot open the file " + path);
+
+    std::uint64_t hash = 14695981039346656037ULL;
+
+    std::vector<char> chunk(1 << 20);
+    while (file)
+      {
+        file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+
+        for (std::streamsize i = 0; i < file.gcount(); ++i)
+          {
+            hash ^= static_cast<unsigned char>(chunk[i]);
+            hash *= 1099511628211ULL;
+          }
+      }
+
+    return hash;
+  }
+
+
+  auto
+  get_snapshot_path(std::string const &snapshot_directory,
+                    std::uint64_t      model_hash,
+                    bool               add_input_padding,
+                    bool               add_output_padding) -> std::string
+  {
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << model_hash << "_"
+         << padding_flags(add_input_padding, add_output_padding) << extension;
+
+    return Utilities::combine_path(snapshot_directory, name.str());
+  }
+
+
+  void
+  export_snapshot(std::string const                          &path,
+                  std::uint64_t                               model_hash,
+                  bool                                        add_input_padding,
+                  bool                                        add_output_padding,
+                  Converted_Onnx_Graph_Type const            &graph,
+                  std::map<Node_Id_Type, Node_Id_Type> const &link_id_nodeproto)
+  {
+    auto const tables = collect_tables(graph);
+
+    Snapshot_Writer writer;
+
+    // Header
+    writer.write_bytes(magic.data(), magic.size());
+    writer.write(format_version);
+    writer.write(model_hash);
+    writer.write(padding_flags(add_input_padding, add_output_padding));
+
+    // Interned names
+    writer.write(tables.symbols.size());
+    for (auto const &symbol : tables.symbols)
+      writer.write_string(types::Symbol_Table::global().get_name(symbol));
+
+    // Tensors
+    writer.write(tables.tensors.size());
+    for (auto const &tensor : tables.tensors)
+      {
+        writer.write_string(tensor->get_name());
+        writer.write(tensor->get_type_tensor_memory());
+        writer.write((tensor->is_initialized() ? initialized_flag : 0) | (tensor->is_constant() ? constant_flag : 0));
+        writer.write_array(std::span<Onnx_Element_Shape_Type const>(tensor->get_shape()));
+      }
+
+    // Nodes
+    auto const write_collection = [&writer, &tables](Io_Collection_Type<Type_Info_Pointer> const &collection) {
+      writer.write(collection.size());
+      for (auto const &[symbol, tensor] : collection)
+        {
+          writer.write(tables.symbol_positions.at(symbol));
+          writer.write(tensor ? tables.tensor_positions.at(tensor.get()) : null_index);
+        }
+    };
+
+    writer.write(graph.size());
+    for (auto const &node : graph.get_nodes())
+      {
+        auto const &content = node.content;
+
+        writer.write_string(node.name);
+        writer.write_string(content.get_operation_id());
+
+        write_collection(content.get_input());
+        write_collection(content.get_output());
+        write_collection(content.get_parameters());
+
+        writer.write(content.get_attributes().size());
+        for (auto const &[name, attribute] : content.get_attributes())
+          {
+            writer.write_string(name);
+            write_attribute(writer, attribute);
+          }
+      }
+
+    // Neighbours
+    for (Node_Id_Type id = 0; id < graph.size(); ++id)
+      {
+        auto const &inputs  = graph.get_input_nodes(id);
+        auto const &outputs = graph.get_output_nodes(id);
+
+        writer.write_array(std::span<Node_Id_Type const>(inputs.data(), inputs.size()));
+        writer.write_array(std::span<Node_Id_Type const>(outputs.data(), outputs.size()));
+      }
+
+    // Links to the nodes of the onnx model
+    writer.write(link_id_nodeproto.size());
+    for (auto const &[node_id, onnx_node_id] : link_id_nodeproto)
+      {
+        writer.write(node_id);
+        writer.write(onnx_node_id);
+      }
+
+    // Write to a temporary file and then replace the snapshot
+    auto const temporary_path = path + ".tmp";
+    try
+      {
+        {
+          std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+          if (!file)
+            throw std::runtime_error("Graph_Snapshot::export_snapshot: cannot write the file " + temporary_path);
+
+          auto const &buffer = writer.get_buffer();
+          file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+          if (!file)
+            throw std::runtime_error("Graph_Snapshot::export_snapshot: cannot write the file " + temporary_path);
+        }
+
+        std::filesystem::rename(temporary_path, path);
+      }
+    catch (...)
+      {
+        // Never leave a partially written file behind
+        std::error_code error;
+        std::filesystem::remove(temporary_path, error);
+
+        throw;
+      }
+  }
+
+
+  auto
+  import_snapshot(std::string const &path,
+                  std::uint64_t      model_hash,
+                  bool               add_input_padding,
+                  bool               add_output_padding,
+                  std::size_t        num_devices) -> std::optional<Snapshot_Content_Type>
+  {
+    // The path may also be something that is not a snapshot at all (e.g., a directory)
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error))
+      return std::nullopt;
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+      return std::nullopt;
+
+    std::vector<char> buffer(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+      return std::nullopt;
+
+    try
+      {
+        Snapshot_Reader reader(buffer);
+
+        // Header
+        std::array<char, magic.size()> file_magic{};
+        reader.read_bytes(file_magic.data(), file_magic.size());
+
+        if (file_magic != magic || reader.read() != format_version || reader.read() != model_hash ||
+            reader.read() != padding_flags(add_input_padding, add_output_padding))
+          {
+            return std::nullopt;
+          }
+
+        // Interned names. They're added to the Symbol_Table only if the whole snapshot is valid
+        std::vector<std::string> names(reader.read_count(sizeof(std::uint64_t)));
+        for (auto &name : names)
+          name = reader.read_string();
+
+        // Tensors (every tensor takes at least four integers)
+        std::vector<Type_Info_Pointer> tensors(reader.read_count(4 * sizeof(std::uint64_t)));
+        for (auto &tensor : tensors)
+          {
+            auto       name                 = reader.read_string();
+            auto const type_tensor_memory   = reader.read();
+            auto const flags                = reader.read();
+            auto       shape                = reader.read_array<Onnx_Element_Shape_Type>();
+
+            tensor = std::make_shared<types::Dense_tensor>(name,
+                                                           type_tensor_memory,
+                                                           std::move(shape),
+                                                           (flags & initialized_flag) != 0,
+                                                           (flags & constant_flag) != 0);
+          }
+
+        // Nodes
+        auto const read_collection = [&reader, num_names = names.size(), num_tensors = tensors.size()]() {
+          std::vector<std::pair<std::uint64_t, std::uint64_t>> res(reader.read_count(2 * sizeof(std::uint64_t)));
+
+          for (auto &[symbol, tensor] : res)
+            {
+              symbol = reader.read();
+              tensor = reader.read();
+
+              if (symbol >= num_names || (tensor != null_index && tensor >= num_tensors))
+                throw std::runtime_error("Graph_Snapshot::import_snapshot: invalid tensor");
+            }
+
+          return res;
+        };
+
+        // Every node takes at least the sizes of its name, operation id, collections and attributes
+        std::vector<Snapshot_Node_Type> snapshot_nodes(reader.read_count(6 * sizeof(std::uint64_t)));
+
+        for (auto &node : snapshot_nodes)
+          {
+            node.name         = reader.read_string();
+            node.operation_id = reader.read_string();
+
+            for (auto &collection : node.collections)
+              collection = read_collection();
+
+            for (std::size_t i = 0, size = reader.read_count(2 * sizeof(std::uint64_t)); i < size; ++i)
+              {
+                auto attribute_name = reader.read_string();
+                node.attributes.emplace(std::move(attribute_name), read_attribute(reader));
+              }
+          }
+
+        // Neighbours
+        auto const read_neighbours = [&reader, num_nodes = snapshot_nodes.size()]() {
+          auto const ids = reader.read_array<Node_Id_Type>();
+
+          if (std::ranges::any_of(ids, [num_nodes](Node_Id_Type id) { return id >= num_nodes; }))
+            throw std::runtime_error("Graph_Snapshot::import_snapshot: invalid neighbour");
+
+          return Neighbour_Id_Collection_Type(ids.cbegin(), ids.cend());
+        };
+
+        Converted_Onnx_Graph_Type::Neighbours_Type neighbours(snapshot_nodes.size());
+        for (auto &[inputs, outputs] : neighbours)
+          {
+            inputs  = read_neighbours();
+            outputs = read_neighbours();
+          }
+
+        // Links to the nodes of the onnx model
+        std::map<Node_Id_Type, Node_Id_Type> link_id_nodeproto;
+        for (std::size_t i = 0, size = reader.read_count(2 * sizeof(std::uint64_t)); i < size; ++i)
+          {
+            auto const node_id      = reader.read();
+            auto const onnx_node_id = reader.read();
+
+            link_id_nodeproto.emplace_hint(link_id_nodeproto.end(), node_id, onnx_node_id);
+          }
+
+        if (!reader.at_end())
+          return std::nullopt;
+
+        // The snapshot is valid: the names can be interned and the nodes built
+        std::vector<Symbol_Id_Type> symbols;
+        symbols.reserve(names.size());
+
+        auto &symbol_table = types::Symbol_Table::global();
+        for (auto const &name : names)
+          symbols.push_back(symbol_table.intern(name));
+
+        std::vector<Converted_Onnx_Graph_Type::Node_Type> nodes;
+        nodes.reserve(snapshot_nodes.size());
+
+        for (auto &snapshot_node : snapshot_nodes)
+          {
+            std::array<Io_Collection_Type<Type_Info_Pointer>, 3> collections;
+            for (std::size_t i = 0; i < collections.size(); ++i)
+              for (auto const &[symbol, tensor] : snapshot_node.collections[i])
+                collections[i].emplace(symbols[symbol], tensor == null_index ? nullptr : tensors[tensor]);
+
+            auto &node = nodes.emplace_back(types::Content<Type_Info_Pointer>(std::move(collections[0]),
+                                                                              std::move(collections[1]),
+                                                                              std::move(collections[2]),
+                                                                              std::move(snapshot_node.attributes),
+                                                                              std::move(snapshot_node.operation_id)));
+            node.name  = std::move(snapshot_node.name);
+          }
+
+        return Snapshot_Content_Type{.graph = Converted_Onnx_Graph_Type(num_devices,
+                                                                        std::move(nodes),
+                                                                        std::move(neighbours)),
+                                     .link_id_nodeproto = std::move(link_id_nodeproto)};
+      }
+    catch (std::exception const &)
+      {
+        // A corrupted snapshot is simply ignored: the model will be imported again
+        return std::nullopt;
+      }
+  }
+} // namespace network_butcher::io::Graph_Snapshot
@@ -120,24 +120,14 @@ namespace network_butcher::io
                                              Io_Collection_Type<Type_Info_Pointer> &io_collection)
     -> std::vector<Type_Info_Pointer>
   {
-    std::set<std::string>    in_keys;
-    std::vector<std::string> tmp;
-
-    std::transform(io_collection.begin(),
-                   io_collection.end(),
-                   std::inserter(in_keys, in_keys.end()),
-                   [](auto const &pair) { return pair.first; });
-    tmp.resize(std::max(onnx_io_ids.size(), in_keys.size()));
-
-    auto it =
-      std::set_intersection(onnx_io_ids.cbegin(), onnx_io_ids.cend(), in_keys.cbegin(), in_keys.cend(), tmp.begin());
-    tmp.resize(it - tmp.begin());
-
     std::vector<Type_Info_Pointer> res;
-    res.reserve(tmp.size());
 
-    for (auto const &tensor_name : tmp)
-      res.push_back(io_collection[tensor_name]);
+    // The names of onnx_io_ids are sorted, thus the result is sorted by name
+    for (auto const &tensor_name : onnx_io_ids)
+      {
+        if (auto const it = io_collection.find(tensor_name); it != io_collection.cend())
+          res.push_back(it->second);
+      }
 
     return res;
   }
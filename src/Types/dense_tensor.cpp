@@ -9,6 +9,17 @@ namespace network_butcher::types
   {}
 
 
+  Dense_tensor::Dense_tensor(std::string const                   &in_name,
+                             Memory_Type                          in_type_tensor_memory,
+                             std::vector<Onnx_Element_Shape_Type> in_shape,
+                             bool                                 given,
+                             bool                                 constant)
+    : Type_Info(given, constant, in_name)
+    , type_tensor_memory(in_type_tensor_memory)
+    , shape(std::move(in_shape))
+  {}
+
+
   Dense_tensor::Dense_tensor(const onnx::ValueInfoProto &info, bool given, bool constant)
     : Type_Info(given, constant, info.name())
   {
@@ -5,9 +5,15 @@ namespace network_butcher::io
   auto
   General_Manager::Helper_Functions::generate_bandwidth_transmission_function(
     const network_butcher::parameters::Parameters::Weights &weights_params,
-    const Converted_Onnx_Graph_Type &graph) -> std::function<Time_Type(const Edge_Type &, size_t, size_t)>
+    const Converted_Onnx_Graph_Type                        &graph,
+    std::shared_ptr<types::Node_Columns const>              columns)
+    -> std::function<Time_Type(const Edge_Type &, size_t, size_t)>
   {
-    return [&weights_params, &graph](Edge_Type const &edge, std::size_t first_device, std::size_t second_device) {
+    // The memory usages of the outputs of the nodes are read from the columnar store of the nodes. It's shared by the
+    // copies of the function
+    return [&weights_params, &graph, columns = std::move(columns)](Edge_Type const &edge,
+                                                                    std::size_t      first_device,
+                                                                    std::size_t      second_device) {
       auto const device_pair = std::make_pair(first_device, second_device);
 
       auto const &bandwidth = weights_params.bandwidth;
@@ -48,18 +54,18 @@ namespace network_butcher::io
         }
 
       // The memory dimension of the output tensor for the given node in bytes
-      auto const mem = network_butcher::computer::Computer_memory::compute_memory_usage_output(graph[tail]);
+      auto const mem = columns->get_output_memory(tail);
 
       if (mem > 0)
         {
           // Conversion from MBit to Bytes
-          constexpr auto MBit_to_Bytes = static_cast<Time_Type>(1000000.) / 8;
+          constexpr auto MBit_to_Bytes = static_cast<Seconds_Type>(1000000.) / 8;
 
-          return (mem / MBit_to_Bytes) / bdw + acc;
+          return to_time_type((mem / MBit_to_Bytes) / bdw + acc);
         }
       else
         {
-          return static_cast<Time_Type>(acc);
+          return to_time_type(acc);
         }
     };
   }
@@ -94,9 +100,25 @@ namespace network_butcher::io
     Chrono crono;
     crono.start();
 
-    // Import the onnx model and populate the graph
-    auto [graph, model, link_graph_model] =
-      IO_Manager::import_from_onnx(params.model_params.model_path, true, true, params.devices.size());
+    auto const &model_params = params.model_params;
+
+    // Import the onnx model and populate the graph. If the snapshots are used, the graph is read from the snapshot of
+    // the model (if it didn't change) and the model itself is parsed only for the export
+    auto [graph, model, link_graph_model] = [&params, &model_params]()
+      -> std::tuple<Converted_Onnx_Graph_Type, std::optional<onnx::ModelProto>, std::map<Node_Id_Type, Node_Id_Type>> {
+      if (model_params.snapshot_directory.empty())
+        {
+          auto [graph, model, link_graph_model] =
+            IO_Manager::import_from_onnx(model_params.model_path, true, true, params.devices.size());
+
+          return {std::move(graph), std::move(model), std::move(link_graph_model)};
+        }
+
+      auto [graph, link_graph_model] = IO_Manager::import_from_onnx_snapshot(
+        model_params.model_path, model_params.snapshot_directory, true, true, params.devices.size());
+
+      return {std::move(graph), std::nullopt, std::move(link_graph_model)};
+    }();
     crono.stop();
 
     double const import_time = crono.wallTime();
@@ -121,9 +143,17 @@ namespace network_butcher::io
 
     crono.start();
 
-    // Start the butchering... (compute the k shortest paths)
-    auto const paths = butcher.compute_k_shortest_path(
-      Helper_Functions::generate_bandwidth_transmission_function(params.weights_params, butcher.get_graph()), params);
+    // Start the butchering... (compute the k shortest paths). If there are several candidate starting or ending
+    // devices, a single search is performed over all of them
+    auto const &block_params = params.block_graph_generation_params;
+    auto const  transmission_weights =
+      Helper_Functions::generate_bandwidth_transmission_function(params.weights_params,
+                                                                 butcher.get_graph(),
+                                                                 butcher.get_node_columns());
+
+    auto const paths = block_params.starting_device_ids.empty() && block_params.ending_device_ids.empty() ?
+                         butcher.compute_k_shortest_path(transmission_weights, params) :
+                         butcher.compute_k_shortest_path_multi_terminal(transmission_weights, params).paths;
     crono.stop();
 
     double const butcher_time = crono.wallTime();
@@ -138,7 +168,10 @@ namespace network_butcher::io
 
     crono.start();
     // Export the butchered networks... (export the different partitions)
-    IO_Manager::export_network_partitions(params, model, link_graph_model, paths);
+    if (!model)
+      model = Utilities::parse_onnx_file(model_params.model_path);
+
+    IO_Manager::export_network_partitions(params, *model, link_graph_model, paths);
     crono.stop();
 
     if (performance)
@@ -215,6 +215,45 @@ namespace network_butcher::io::IO_Manager
   }
 
 
+  auto
+  import_from_onnx_snapshot(std::string const &path,
+                            std::string const &snapshot_directory,
+                            bool               add_input_padding,
+                            bool               add_output_padding,
+                            std::size_t        num_devices) -> Graph_Snapshot::Snapshot_Content_Type
+  {
+    if (!Utilities::file_exists(path))
+      throw std::runtime_error("The model in the specified path " + path + " doesn't exist");
+
+    auto const model_hash = Graph_Snapshot::compute_file_hash(path);
+    auto const snapshot_path =
+      Graph_Snapshot::get_snapshot_path(snapshot_directory, model_hash, add_input_padding, add_output_padding);
+
+    auto snapshot =
+      Graph_Snapshot::import_snapshot(snapshot_path, model_hash, add_input_padding, add_output_padding, num_devices);
+
+    if (snapshot)
+      {
+        return std::move(*snapshot);
+      }
+
+    auto [graph, model, link_id_nodeproto] = import_from_onnx(path, add_input_padding, add_output_padding, num_devices);
+
+    // The snapshot is only a cache: if it cannot be stored (e.g., the directory is not writable), the imported graph
+    // is still returned
+    try
+      {
+        Utilities::create_directory(snapshot_directory);
+        Graph_Snapshot::export_snapshot(
+          snapshot_path, model_hash, add_input_padding, add_output_padding, graph, link_id_nodeproto);
+      }
+    catch (std::exception const &)
+      {}
+
+    return {.graph = std::move(graph), .link_id_nodeproto = std::move(link_id_nodeproto)};
+  }
+
+
   auto
   read_parameters(const std::string &path) -> network_butcher::parameters::Parameters
   {
@@ -361,7 +400,8 @@ namespace network_butcher::io::IO_Manager
                 }
               else if (i == j)
                 {
-                  weights[std::make_pair(i, j)] = std::make_pair(std::numeric_limits<Time_Type>::infinity(), 0.);
+                  weights[std::make_pair(i, j)] =
+                    std::make_pair(std::numeric_limits<Bandwidth_Value_Type>::infinity(), 0.);
 
                   connections[i].second.insert(j);
                   connections[j].first.insert(i);
@@ -392,6 +432,10 @@ namespace network_butcher::io::IO_Manager
         {
           return network_butcher::parameters::KSP_Method::Lazy_Eppstein;
         }
+      else if (method == "yen")
+        {
+          return network_butcher::parameters::KSP_Method::Yen;
+        }
       else
         {
           throw std::invalid_argument("Parameters: unsupported K-shortest path method");
@@ -448,14 +492,29 @@ namespace network_butcher::io::IO_Manager
       };
 
     auto const basic_infos_func = [path, basic_infos, &read_block_graph_mode](auto &file, auto &params) {
-      params.model_params.model_name       = file(basic_infos + "/model_name", "model");
-      params.model_params.model_path       = file(basic_infos + "/model_path", "");
-      params.model_params.export_directory = file(basic_infos + "/export_directory", "ksp_result");
-      params.model_params.config_path      = path;
+      params.model_params.model_name         = file(basic_infos + "/model_name", "model");
+      params.model_params.model_path         = file(basic_infos + "/model_path", "");
+      params.model_params.export_directory   = file(basic_infos + "/export_directory", "ksp_result");
+      params.model_params.config_path        = path;
+      params.model_params.snapshot_directory = file(basic_infos + "/snapshot_directory", "");
 
       params.block_graph_generation_params.starting_device_id = file(basic_infos + "/starting_device_id", 0);
       params.block_graph_generation_params.ending_device_id   = file(basic_infos + "/ending_device_id", 0);
 
+      // The candidate devices of the multi terminal search, e.g. '0 1'
+      auto const read_devices = [&file, &basic_infos](std::string const &entry) {
+        std::string const        location = basic_infos + "/" + entry;
+        std::vector<std::size_t> res(file.vector_variable_size(location));
+
+        for (std::size_t i = 0; i < res.size(); ++i)
+          res[i] = file(location, i, std::size_t{0});
+
+        return res;
+      };
+
+      params.block_graph_generation_params.starting_device_ids = read_devices("starting_device_ids");
+      params.block_graph_generation_params.ending_device_ids   = read_devices("ending_device_ids");
+
       params.block_graph_generation_params.use_bandwidth_to_manage_connections =
         file(basic_infos + "/use_bandwidth_to_manage_connections", false);
 
@@ -466,6 +525,11 @@ namespace network_butcher::io::IO_Manager
     auto const k_shortest_path_params_func = [basic_infos, weight_infos, &read_k_method](auto &file, auto &params) {
       params.ksp_params.K      = file(basic_infos + "/K", 100);
       params.ksp_params.method = read_k_method(file);
+
+      // A negative gap disables the bound
+      double const max_relative_gap = file(basic_infos + "/max_relative_gap", -1.);
+      if (max_relative_gap >= 0.)
+        params.ksp_params.max_relative_gap = max_relative_gap;
     };
 
 